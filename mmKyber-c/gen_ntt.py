@@ -0,0 +1,442 @@
+#   gen_ntt.py
+#   === Generator for straight-line NTT / INTT code (mm_ntt_gen.h).
+
+#   Emits fully unrolled forward and inverse negacyclic NTTs that are
+#   bit-identical to the loops of mm_ntt.c (same butterflies, same
+#   reductions), with the twiddle factors as constants:
+#
+#   -   generic C: layers merged in groups (radix 2^r), each group works
+#       on 2^r coefficients held in local variables;
+#   -   AVX2 intrinsics: layers of distance >= 8 on whole vectors (merged
+#       like the above), the last three on vector pairs with shuffles.
+#
+#   The final INTT layer is fused with the normalization by MONT_DI. The
+#   AVX2 inverse hands its final vectors to an inlined out() instead of
+#   storing them (ntt_gen_inv_out_x8(), for polyr_intt_ct()).
+#
+#   python3 gen_ntt.py [d q root] > mm_ntt_gen.h
+
+import sys
+
+MM_D    = 256           #   base polynomial x^d + 1
+MM_Q    = 33550337      #   2**25 - 2**12 + 1
+MM_H    = 8433925       #   2d'th root of unity
+MERGE   = 3             #   at most this many layers per group (radix 8)
+
+#   layers per group: generic C (d = 256: 3, 3, 2), AVX2 vector layers
+
+def radix(n):
+    return [ MERGE ] * (n // MERGE) + ([ n % MERGE ] if n % MERGE else [])
+
+RADIX_C = radix(MM_D.bit_length() - 1)
+RADIX_V = radix(MM_D.bit_length() - 4)
+
+#   Montgomery constants as in mm_ring.h
+
+def mont_param(d, q):
+    r   = (1 << 32) % q
+    qi  = (-pow(q, -1, 1 << 32)) % (1 << 32)
+    di  = (r * r * pow(d, -1, q)) % q
+    return r, qi, di
+
+def bitrev(i, b):
+    return int(format(i, '0%db' % b)[::-1], 2)
+
+#   mm_w[]: R * h^bitrev(i)
+
+def twiddles(d, q, h):
+    r, _, _ = mont_param(d, q)
+    lg = d.bit_length() - 1
+    return [ (r * pow(h, bitrev(i, lg), q)) % q for i in range(d) ]
+
+#   layer "l" of the forward transform: (distance, twiddle of position x)
+
+def fwd_layer(d, w, l):
+    j = d >> (l + 1)
+    return j, lambda x: w[(1 << l) + x // (2 * j)]
+
+#   layer "l" of the inverse transform (l = 0 has distance 1)
+
+def inv_layer(d, w, l):
+    j = 1 << l
+    k = d >> (l + 1)
+    return j, lambda x: w[2 * k - 1 - x // (2 * j)]
+
+#   groups of "rad" layers starting at layer 0
+
+def groups(rad):
+    l = 0
+    for r in rad:
+        yield l, r
+        l += r
+
+#   element sets of a layer group: distances j_hi > .. > j_lo, "n" elements
+
+def blocks(n, j_hi, r):
+    j_lo = j_hi >> (r - 1)
+    sb = 2 * j_hi
+    for s in range(0, n, sb):
+        for o in range(j_lo):
+            yield [ s + o + t * j_lo for t in range(1 << r) ]
+
+#   "x0 = f[..];  x1 = f[..]; .." (or the stores), "n" per line;
+#   vectors "v" may be unaligned
+
+def ldst(a, e, load, n=4):
+    if a == 'v':
+        fmt = 'x%d = _mm256_loadu_si256(v + %d);' if load else \
+                '_mm256_storeu_si256(v + %d, x%d);'
+        n = 2
+    else:
+        fmt = 'x%d = f[%d];' if load else 'f[%d] = x%d;'
+    st = [ fmt % ((t, e[t]) if load else (e[t], t)) for t in range(len(e)) ]
+    return [ '    ' + '  '.join(st[i:i + n]) for i in range(0, len(st), n) ]
+
+#   === generic C
+
+def gen_c_fwd(d, w):
+    out = []
+    for l0, r in groups(RADIX_C):
+        j_hi, _ = fwd_layer(d, w, l0)
+        for e in blocks(d, j_hi, r):
+            out += ldst('f', e, True)
+            for u in range(r):
+                j, tw = fwd_layer(d, w, l0 + u)
+                dt = j // (e[1] - e[0]) if r > 1 else 1
+                for t in range(len(e)):
+                    if t & dt:
+                        continue
+                    out.append('    y = mont_mulq(x%d, %d);  x%d = x%d - y;'
+                                '  x%d = x%d + y;' % (t + dt, tw(e[t]),
+                                t + dt, t, t, t))
+            out += ldst('f', e, False)
+    return out
+
+def gen_c_inv(d, w, q, di):
+    out = []
+    lg = d.bit_length() - 1
+    for l0, r in groups(RADIX_C[::-1]):
+        j_lo, _ = inv_layer(d, w, l0)
+        j_hi = j_lo << (r - 1)
+        for e in blocks(d, j_hi, r):
+            e = sorted(e)
+            out += ldst('f', e, True)
+            for u in range(r):
+                j, tw = inv_layer(d, w, l0 + u)
+                dt = j // (e[1] - e[0]) if r > 1 else 1
+                for t in range(len(e)):
+                    if t & dt:
+                        continue
+                    a, b = t, t + dt
+                    if l0 + u == lg - 1:        #   fused normalization
+                        zd = (tw(e[a]) * di * pow(1 << 32, -1, q)) % q
+                        out.append('    y = x%d - x%d;  x%d = mont_cadd('
+                                    'mont_mulq(x%d + x%d, MONT_DI));'
+                                    % (b, a, a, a, b))
+                        out.append('    x%d = mont_cadd(mont_mulq(y, %d));'
+                                    % (b, zd))
+                    else:
+                        out.append('    y = x%d - x%d;  x%d = mont_red1(x%d + '
+                                    'x%d);  x%d = mont_mulq(y, %d);'
+                                    % (b, a, a, a, b, b, tw(e[a])))
+            out += ldst('f', e, False)
+    return out
+
+#   === AVX2: vectors of 8 coefficients, v[i] = f[8i .. 8i+7]
+
+def vset(z):
+    return '_mm256_setr_epi32(\n            %s,\n            %s)' % (
+            ', '.join(str(x) for x in z[:4]), ', '.join(str(x) for x in z[4:]))
+
+#   lane order of the (lo, hi) operands of the shuffled layers, j = 4, 2, 1
+#   for the vector pair (a, b) = f[16m .. 16m+15]; c(i) = 16m + i
+
+SH_LO = {   4: [ 0, 1, 2, 3, 8, 9, 10, 11 ],
+            2: [ 0, 1, 8, 9, 4, 5, 12, 13 ],
+            1: [ 0, 2, 8, 10, 4, 6, 12, 14 ] }
+
+SH_IN = {   4: [ 'lo = _mm256_permute2x128_si256(a, b, 0x20);',
+                 'hi = _mm256_permute2x128_si256(a, b, 0x31);' ],
+            2: [ 'lo = _mm256_unpacklo_epi64(a, b);',
+                 'hi = _mm256_unpackhi_epi64(a, b);' ],
+            1: [ 'a = _mm256_shuffle_epi32(a, 0xD8);  '
+                 'b = _mm256_shuffle_epi32(b, 0xD8);',
+                 'lo = _mm256_unpacklo_epi64(a, b);',
+                 'hi = _mm256_unpackhi_epi64(a, b);' ] }
+
+SH_OUT = {  4: [ '_mm256_permute2x128_si256(lo, hi, 0x20)',
+                 '_mm256_permute2x128_si256(lo, hi, 0x31)' ],
+            2: [ '_mm256_unpacklo_epi64(lo, hi)',
+                 '_mm256_unpackhi_epi64(lo, hi)' ],
+            1: [ '_mm256_unpacklo_epi32(lo, hi)',
+                 '_mm256_unpackhi_epi32(lo, hi)' ] }
+
+def gen_v_fwd(d, w):
+    out = []
+    nv = d // 8
+    lg = d.bit_length() - 1
+    for l0, r in groups(RADIX_V):
+        j_hi, _ = fwd_layer(d, w, l0)
+        for e in blocks(nv, j_hi // 8, r):
+            out += ldst('v', e, True)
+            for u in range(r):
+                j, tw = fwd_layer(d, w, l0 + u)
+                dt = (j // 8) // (e[1] - e[0]) if r > 1 else 1
+                for t in range(len(e)):
+                    if t & dt:
+                        continue
+                    out.append('    y = mulq_x8(x%d, _mm256_set1_epi32(%d));'
+                                % (t + dt, tw(8 * e[t])))
+                    out.append('    x%d = _mm256_sub_epi32(x%d, y);  '
+                                'x%d = _mm256_add_epi32(x%d, y);'
+                                % (t + dt, t, t, t))
+            out += ldst('v', e, False)
+    #   j = 4, 2, 1
+    for m in range(nv // 2):
+        out.append('    a = _mm256_loadu_si256(v + %d);  '
+                    'b = _mm256_loadu_si256(v + %d);'
+                    % (2 * m, 2 * m + 1))
+        for l in range(lg - 3, lg):
+            j, tw = fwd_layer(d, w, l)
+            out += [ '    ' + x for x in SH_IN[j] ]
+            out.append('    y = mulq_x8(hi, %s);' %
+                        vset([ tw(16 * m + i) for i in SH_LO[j] ]))
+            out.append('    hi = _mm256_sub_epi32(lo, y);  '
+                        'lo = _mm256_add_epi32(lo, y);')
+            out.append('    a = %s;' % SH_OUT[j][0])
+            out.append('    b = %s;' % SH_OUT[j][1])
+        out.append('    _mm256_storeu_si256(v + %d, a);  '
+                    '_mm256_storeu_si256(v + %d, b);'
+                    % (2 * m, 2 * m + 1))
+    return out
+
+def gen_v_inv(d, w, q, di):
+    out = []
+    nv = d // 8
+    lg = d.bit_length() - 1
+    #   j = 1, 2, 4
+    for m in range(nv // 2):
+        out.append('    a = _mm256_loadu_si256(v + %d);  '
+                    'b = _mm256_loadu_si256(v + %d);'
+                    % (2 * m, 2 * m + 1))
+        for l in range(3):
+            j, tw = inv_layer(d, w, l)
+            out += [ '    ' + x for x in SH_IN[j] ]
+            out.append('    y = _mm256_sub_epi32(hi, lo);  '
+                        'lo = red1_x8(_mm256_add_epi32(lo, hi));')
+            out.append('    hi = mulq_x8(y, %s);' %
+                        vset([ tw(16 * m + i) for i in SH_LO[j] ]))
+            out.append('    a = %s;' % SH_OUT[j][0])
+            out.append('    b = %s;' % SH_OUT[j][1])
+        out.append('    _mm256_storeu_si256(v + %d, a);  '
+                    '_mm256_storeu_si256(v + %d, b);'
+                    % (2 * m, 2 * m + 1))
+    for l0, r in groups(RADIX_V[::-1]):
+        l0 += 3
+        j_lo, _ = inv_layer(d, w, l0)
+        j_hi = j_lo << (r - 1)
+        for e in blocks(nv, j_hi // 8, r):
+            e = sorted(e)
+            out += ldst('v', e, True)
+            for u in range(r):
+                j, tw = inv_layer(d, w, l0 + u)
+                dt = (j // 8) // (e[1] - e[0]) if r > 1 else 1
+                for t in range(len(e)):
+                    if t & dt:
+                        continue
+                    a, b = t, t + dt
+                    out.append('    y = _mm256_sub_epi32(x%d, x%d);' % (b, a))
+                    if l0 + u == lg - 1:        #   fused normalization
+                        zd = (tw(8 * e[a]) * di * pow(1 << 32, -1, q)) % q
+                        out.append('    x%d = cadd_x8(mulq_x8(_mm256_add_'
+                                    'epi32(x%d, x%d), _mm256_set1_epi32('
+                                    'MONT_DI)));' % (a, a, b))
+                        out.append('    x%d = cadd_x8(mulq_x8(y, '
+                                    '_mm256_set1_epi32(%d)));' % (b, zd))
+                    else:
+                        out.append('    x%d = red1_x8(_mm256_add_epi32(x%d, '
+                                    'x%d));' % (a, a, b))
+                        out.append('    x%d = mulq_x8(y, _mm256_set1_epi32('
+                                    '%d));' % (b, tw(8 * e[a])))
+            if l0 + r == lg:                    #   final vectors to out()
+                st = [ 'out(%d, x%d, arg);' % (e[t], t)
+                        for t in range(len(e)) ]
+                out += [ '    ' + '  '.join(st[i:i + 4])
+                            for i in range(0, len(st), 4) ]
+            else:
+                out += ldst('v', e, False)
+    return out
+
+#   shift-and-subtract forms for q = 2^25 - 2^12 + 1 (mm_ring.h)
+
+X8_SPQ = '''
+//  x * QI mod 2^32 (low lanes), QI = 2^24 - 2^12 - 1
+
+static inline __m256i mulqi_x8(__m256i x)
+{
+    return _mm256_sub_epi32(_mm256_sub_epi32(_mm256_slli_epi32(x, 24),
+                            _mm256_slli_epi32(x, 12)), x);
+}
+
+//  x = h * 2^25 + l  ->  l + h * (2^12 - 1)
+
+static inline __m256i red1_x8(__m256i x)
+{
+    __m256i h;
+
+    h = _mm256_srai_epi32(x, MONT_LOGQ);
+    x = _mm256_and_si256(x, _mm256_set1_epi32((1 << MONT_LOGQ) - 1));
+    return _mm256_sub_epi32(_mm256_add_epi32(x, _mm256_slli_epi32(h, 12)), h);
+}
+'''
+
+#   === output
+
+def xvars(n, t):
+    return '    %s %s;' % (t, ', '.join('x%d' % i for i in range(n)))
+
+def gen(d, q, h):
+    global RADIX_C, RADIX_V
+    RADIX_C = radix(d.bit_length() - 1)
+    RADIX_V = radix(d.bit_length() - 4)
+    r, qi, di = mont_param(d, q)
+    w = twiddles(d, q, h)
+    if d < 32 or d & (d - 1) != 0:
+        sys.exit('gen_ntt.py: d must be a power of two, at least 32')
+    if pow(h, d, q) != q - 1:
+        sys.exit('gen_ntt.py: root must be a primitive 2d-th root of unity')
+
+    nc = 1 << max(RADIX_C)
+    nv = 1 << max(RADIX_V)
+    p = []
+    p.append('//  mm_ntt_gen.h')
+    p.append('//  === Straight-line NTT / INTT; generated by gen_ntt.py, '
+                'do not edit.')
+    p.append('')
+    p.append('//  d = %d, q = %d, root h = %d' % (d, q, h))
+    p.append('//  generic C: radix %s;  AVX2: radix %s, then 4, 2, 1' %
+                ('-'.join(str(1 << x) for x in RADIX_C),
+                 '-'.join(str(1 << x) for x in RADIX_V)))
+    p.append('')
+    p.append('#ifndef _MM_NTT_GEN_H_')
+    p.append('#define _MM_NTT_GEN_H_')
+    p.append('')
+    p.append('#include "mm_ring.h"')
+    p.append('')
+    p.append('#if MM_D != %d || MM_Q != %dl || \\\n    MONT_QI != %dl || '
+                'MONT_DI != %dl' % (d, q, qi, di))
+    p.append('#error "mm_ntt_gen.h: regenerate with gen_ntt.py for these '
+                'parameters"')
+    p.append('#endif')
+    p.append('')
+    p.append('//  Forward NTT, as polyr_fntt().')
+    p.append('')
+    p.append('static inline void ntt_gen_fwd(int32_t *f)')
+    p.append('{')
+    p.append(xvars(nc, 'int32_t') + '\n    int32_t y;\n')
+    p += gen_c_fwd(d, w)
+    p.append('}')
+    p.append('')
+    p.append('//  Reverse NTT with normalization, as polyr_intt().')
+    p.append('')
+    p.append('static inline void ntt_gen_inv(int32_t *f)')
+    p.append('{')
+    p.append(xvars(nc, 'int32_t') + '\n    int32_t y;\n')
+    p += gen_c_inv(d, w, q, di)
+    p.append('}')
+    p.append('')
+    p.append('#ifdef __AVX2__')
+    p.append('')
+    p.append('#include <immintrin.h>')
+    p.append('')
+    p.append('//  mont_mulq(), mont_red1(), mont_cadd() on 8 lanes')
+    p.append('')
+    spq = q == (1 << 25) - (1 << 12) + 1
+    if spq:
+        p.append('#ifdef MM_RED_SPQ')
+        p.append(X8_SPQ)
+        p.append('#else')
+        p.append('')
+    p.append('''//  x * QI mod 2^32 (low lanes)
+
+static inline __m256i mulqi_x8(__m256i x)
+{
+    return _mm256_mullo_epi32(x, _mm256_set1_epi32(MONT_QI));
+}
+
+static inline __m256i red1_x8(__m256i x)
+{
+    return _mm256_sub_epi32(x, _mm256_mullo_epi32(_mm256_srai_epi32(x,
+                            MONT_LOGQ), _mm256_set1_epi32(MONT_Q)));
+}''')
+    if spq:
+        p.append('')
+        p.append('#endif')
+    p.append('''
+static inline __m256i mulq_x8(__m256i x, __m256i y)
+{
+    const __m256i q = _mm256_set1_epi32(MONT_Q);
+    __m256i e, o;
+
+    //  64-bit x * y + ((int32_t) (x * y) * QI) * q, even and odd lanes
+    e = _mm256_mul_epi32(x, y);
+    e = _mm256_add_epi64(e, _mm256_mul_epi32(mulqi_x8(e), q));
+    o = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32));
+    o = _mm256_add_epi64(o, _mm256_mul_epi32(mulqi_x8(o), q));
+
+    return _mm256_blend_epi32(_mm256_srli_epi64(e, 32), o, 0xAA);
+}
+
+static inline __m256i cadd_x8(__m256i x)
+{
+    return _mm256_add_epi32(x, _mm256_and_si256(_mm256_srai_epi32(x, 31),
+                            _mm256_set1_epi32(MONT_Q)));
+}
+''')
+    p.append('//  Forward NTT, as polyr_fntt().')
+    p.append('')
+    p.append('static inline void ntt_gen_fwd_x8(int32_t *f)')
+    p.append('{')
+    p.append('    __m256i *v = (__m256i *) f;')
+    p.append(xvars(nv, '__m256i') + '\n    __m256i y, a, b, lo, hi;\n')
+    p += gen_v_fwd(d, w)
+    p.append('}')
+    p.append('')
+    p.append('//  Reverse NTT with normalization; final vector k (coefficients '
+                '8k .. 8k+7)')
+    p.append('//  goes to out(k, x, arg) instead of "f".')
+    p.append('')
+    p.append('static XINLINE void ntt_gen_inv_out_x8(int32_t *f,')
+    p.append('                    void (*out)(int, __m256i, void *), '
+                'void *arg)')
+    p.append('{')
+    p.append('    __m256i *v = (__m256i *) f;')
+    p.append(xvars(nv, '__m256i') + '\n    __m256i y, a, b, lo, hi;\n')
+    p += gen_v_inv(d, w, q, di)
+    p.append('}')
+    p.append('')
+    p.append('static XINLINE void ntt_gen_st_x8(int k, __m256i x, void *arg)')
+    p.append('{')
+    p.append('    _mm256_storeu_si256((__m256i *) arg + k, x);')
+    p.append('}')
+    p.append('')
+    p.append('//  Reverse NTT with normalization, as polyr_intt().')
+    p.append('')
+    p.append('static inline void ntt_gen_inv_x8(int32_t *f)')
+    p.append('{')
+    p.append('    ntt_gen_inv_out_x8(f, ntt_gen_st_x8, f);')
+    p.append('}')
+    p.append('')
+    p.append('#endif')
+    p.append('')
+    p.append('#endif')
+    return '\n'.join(p) + '\n'
+
+if __name__ == '__main__':
+    if len(sys.argv) == 4:
+        d, q, h = (int(x) for x in sys.argv[1:])
+    elif len(sys.argv) == 1:
+        d, q, h = MM_D, MM_Q, MM_H
+    else:
+        sys.exit('usage: python3 gen_ntt.py [d q root]')
+    sys.stdout.write(gen(d, q, h))
@@ -5,7 +5,11 @@ for level in 128 192 256; do
 	for mode in KEM PKE; do
 		make obj-clean
 		make MODE=$mode LEVEL=$level TEST=TESTVEC
-		./xtest | grep chk >> testvec.tmp
+		./xtest | grep -e chk -e FAIL >> testvec.tmp
+		#	C++ layer (mm_poly.hpp), prints only on mismatch here
+		if make MODE=$mode LEVEL=$level TEST=TESTVEC xpoly; then
+			./xpoly | grep FAIL >> testvec.tmp
+		fi
 	done
 done
 sha256sum testvec.tmp
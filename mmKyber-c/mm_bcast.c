@@ -0,0 +1,243 @@
+//  mm_bcast.c
+//  === Indexed broadcast ciphertext container.
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mm_bcast.h"
+
+#define BC_NIL  (~((uint64_t) 0))
+
+//  round up to section alignment
+
+static inline uint64_t bc_align(uint64_t x)
+{
+    return (x + MM_BC_ALIGN - 1) & ~((uint64_t) MM_BC_ALIGN - 1);
+}
+
+//  mix the recipient id (same function for writer and reader)
+
+static inline uint64_t bc_hash(uint64_t id)
+{
+    id ^= id >> 33;
+    id *= 0xFF51AFD7ED558CCDull;
+    id ^= id >> 33;
+    return id;
+}
+
+//  number of index slots for "n" recipients (load factor <= 1/2)
+
+static uint64_t bc_slots(uint64_t n)
+{
+    uint64_t h = 1;
+
+    while (h < 2 * n) {
+        h <<= 1;
+    }
+    return h;
+}
+
+//  section offsets
+
+static void bc_layout(  uint64_t n, int with_idx, uint64_t *ctu_off,
+                        uint64_t *cti_off, uint64_t *idx_off, uint64_t *sz)
+{
+    *ctu_off = MM_BC_HDR_SZ;
+    *cti_off = bc_align(*ctu_off + MM_CTU_SZ);
+    *sz = bc_align(*cti_off + n * MM_BC_CTI_SZ);
+    if (with_idx) {
+        *idx_off = *sz;
+        *sz += 16 * bc_slots(n);
+    } else {
+        *idx_off = 0;
+    }
+}
+
+//  Container size for "n" recipients, with or without a recipient index.
+
+size_t mm_bc_size(uint64_t n, int with_idx)
+{
+    uint64_t ctu_off, cti_off, idx_off, sz;
+
+    bc_layout(n, with_idx, &ctu_off, &cti_off, &idx_off, &sz);
+    return sz;
+}
+
+//  Write header and index (if "ids" is not NULL) for "n" recipients.
+
+size_t mm_bc_init(  uint8_t *buf, const uint8_t dom[16],
+                    const uint64_t *ids, uint64_t n)
+{
+    uint64_t i, h, slots, ctu_off, cti_off, idx_off, sz;
+    uint8_t *idx;
+
+    bc_layout(n, ids != NULL, &ctu_off, &cti_off, &idx_off, &sz);
+    slots = ids != NULL ? bc_slots(n) : 0;
+
+    //  header and alignment padding
+    memset(buf, 0, cti_off);
+    memset(buf + cti_off + n * MM_BC_CTI_SZ, 0,
+            sz - (cti_off + n * MM_BC_CTI_SZ));
+    memcpy(buf, MM_BC_MAGIC, 4);
+    put16u_le(buf + 4, MM_BC_VERSION);
+    put16u_le(buf + 6, MM_LEVEL);
+    buf[8] = MM_BC_MODE;
+    buf[9] = ids != NULL ? 1 : 0;
+    put16u_le(buf + 10, MM_BC_CTI_SZ);
+    put32u_le(buf + 12, MM_CTU_SZ);
+    put64u_le(buf + 16, n);
+    memcpy(buf + 24, dom, 16);
+    put64u_le(buf + 40, ctu_off);
+    put64u_le(buf + 48, cti_off);
+    put64u_le(buf + 56, idx_off);
+    put64u_le(buf + 64, slots);
+    put64u_le(buf + 72, sz);
+
+    //  recipient index
+    if (ids != NULL) {
+        idx = buf + idx_off;
+        for (i = 0; i < slots; i++) {
+            put64u_le(idx + 16 * i + 8, BC_NIL);
+        }
+        for (i = 0; i < n; i++) {
+            h = bc_hash(ids[i]) & (slots - 1);
+            while (get64u_le(idx + 16 * h + 8) != BC_NIL) {
+                h = (h + 1) & (slots - 1);
+            }
+            put64u_le(idx + 16 * h, ids[i]);
+            put64u_le(idx + 16 * h + 8, i);
+        }
+    }
+
+    return sz;
+}
+
+//  Write a complete container from a ct_u || ct_1 || .. || ct_N string.
+
+size_t mm_bc_write( uint8_t *buf, const uint8_t dom[16],
+                    const uint64_t *ids, const uint8_t *ct, uint64_t n)
+{
+    size_t sz;
+
+    sz = mm_bc_init(buf, dom, ids, n);
+    memcpy(buf + get64u_le(buf + 40), ct, MM_CTU_SZ);
+    memcpy(buf + get64u_le(buf + 48), ct + MM_CTU_SZ, n * MM_BC_CTI_SZ);
+
+    return sz;
+}
+
+//  Parse and check a container of "sz" bytes. Returns 0 on success.
+
+int mm_bc_open(mm_bc_t *bc, const uint8_t *buf, size_t sz)
+{
+    uint64_t n, slots, ctu_off, cti_off, idx_off, tot;
+
+    memset(bc, 0, sizeof(mm_bc_t));
+    if (sz < MM_BC_HDR_SZ ||
+        memcmp(buf, MM_BC_MAGIC, 4) != 0 ||
+        get16u_le(buf + 4) != MM_BC_VERSION ||
+        get16u_le(buf + 6) != MM_LEVEL ||
+        buf[8] != MM_BC_MODE ||
+        get16u_le(buf + 10) != MM_BC_CTI_SZ ||
+        get32u_le(buf + 12) != MM_CTU_SZ) {
+        return -1;
+    }
+
+    //  the layout is implied by the parameters; check that it matches
+    n = get64u_le(buf + 16);
+    slots = get64u_le(buf + 64);
+    if (n > (sz / MM_BC_CTI_SZ)) {
+        return -1;
+    }
+    bc_layout(n, buf[9] & 1, &ctu_off, &cti_off, &idx_off, &tot);
+    if (get64u_le(buf + 40) != ctu_off ||
+        get64u_le(buf + 48) != cti_off ||
+        get64u_le(buf + 56) != idx_off ||
+        slots != ((buf[9] & 1) ? bc_slots(n) : 0) ||
+        get64u_le(buf + 72) != tot || tot > sz) {
+        return -1;
+    }
+
+    bc->buf = buf;
+    bc->sz = tot;
+    bc->n = n;
+    bc->slots = slots;
+    bc->dom = buf + 24;
+    bc->ctu = buf + ctu_off;
+    bc->cti = buf + cti_off;
+    bc->idx = idx_off != 0 ? buf + idx_off : NULL;
+
+    return 0;
+}
+
+//  Map container file "fn" read-only and open it. Returns 0 on success.
+
+int mm_bc_map(mm_bc_t *bc, const char *fn)
+{
+    int fd;
+    struct stat st;
+    void *p;
+
+    fd = open(fn, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size < MM_BC_HDR_SZ) {
+        close(fd);
+        return -1;
+    }
+    p = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+
+    //  receivers touch only a few pages; avoid readahead
+    madvise(p, st.st_size, MADV_RANDOM);
+
+    if (mm_bc_open(bc, (const uint8_t *) p, st.st_size) != 0) {
+        munmap(p, st.st_size);
+        return -1;
+    }
+    bc->sz = st.st_size;
+    bc->mapped = 1;
+
+    return 0;
+}
+
+//  Unmap a container opened with mm_bc_map().
+
+void mm_bc_unmap(mm_bc_t *bc)
+{
+    if (bc->mapped) {
+        munmap((void *) bc->buf, bc->sz);
+    }
+    memset(bc, 0, sizeof(mm_bc_t));
+}
+
+//  Find the index of recipient "id". Returns -1 if not found.
+
+int64_t mm_bc_find(const mm_bc_t *bc, uint64_t id)
+{
+    uint64_t h, i, j;
+
+    if (bc->idx == NULL) {
+        return -1;
+    }
+    h = bc_hash(id) & (bc->slots - 1);
+    for (j = 0; j < bc->slots; j++) {
+        i = get64u_le(bc->idx + 16 * h + 8);
+        if (i == BC_NIL) {
+            break;
+        }
+        if (get64u_le(bc->idx + 16 * h) == id) {
+            return i < bc->n ? (int64_t) i : -1;
+        }
+        h = (h + 1) & (bc->slots - 1);
+    }
+
+    return -1;
+}
@@ -0,0 +1,93 @@
+//  mm_bcast.h
+//  === Header: Indexed broadcast ciphertext container.
+
+#ifndef _MM_BCAST_H_
+#define _MM_BCAST_H_
+
+#include "plat_local.h"
+#include "mm_param.h"
+
+/*
+    Container layout (little-endian, all sections 64-byte aligned):
+
+    offset  size    header field
+    0       4       magic "mmKB"
+    4       2       format version (1)
+    6       2       security level (128, 192, 256)
+    8       1       mode ('K' mmKEM, 'P' mmPKE)
+    9       1       flags (bit 0: recipient index present)
+    10      2       ct_i size
+    12      4       ct_u size
+    16      8       number of recipients N
+    24      16      seed domain (seed_a of the public parameters)
+    40      8       ct_u offset
+    48      8       ct_i section offset
+    56      8       index offset (0 if none)
+    64      8       index slots (power of two)
+    72      8       total size
+    80      48      reserved (zero)
+
+    ct_u:   MM_CTU_SZ bytes
+    ct_i:   N * ct_i size bytes, in index order
+    index:  slots * { u64 recipient id, u64 recipient index }, open
+            addressing with linear probing; empty slots have index ~0.
+*/
+
+#define MM_BC_MAGIC     "mmKB"
+#define MM_BC_VERSION   1
+#define MM_BC_HDR_SZ    128
+#define MM_BC_ALIGN     64
+
+#ifdef MM_KEM
+#define MM_BC_MODE      'K'
+#else
+#define MM_BC_MODE      'P'
+#endif
+#define MM_BC_CTI_SZ    MM_CTI_SZ
+
+//  an opened container (pointers into the buffer or mapping)
+
+typedef struct {
+    const uint8_t *buf;             //  start of container
+    size_t sz;                      //  total size
+    uint64_t n;                     //  number of recipients
+    uint64_t slots;                 //  index slots (0 if no index)
+    const uint8_t *dom;             //  seed domain (16 bytes)
+    const uint8_t *ctu;             //  shared ct_u
+    const uint8_t *cti;             //  ct_i section
+    const uint8_t *idx;             //  index section or NULL
+    int mapped;                     //  from mm_bc_map()
+} mm_bc_t;
+
+//  Container size for "n" recipients, with or without a recipient index.
+size_t mm_bc_size(uint64_t n, int with_idx);
+
+//  Write header and index (if "ids" is not NULL) for "n" recipients to
+//  "buf"; sections for ct_u and ct_i are left for the caller to fill
+//  (see mm_bc_open()). Returns the container size.
+size_t mm_bc_init(  uint8_t *buf, const uint8_t dom[16],
+                    const uint64_t *ids, uint64_t n);
+
+//  Write a complete container from a ct_u || ct_1 || .. || ct_N string.
+size_t mm_bc_write( uint8_t *buf, const uint8_t dom[16],
+                    const uint64_t *ids, const uint8_t *ct, uint64_t n);
+
+//  Parse and check a container of "sz" bytes. Returns 0 on success.
+int mm_bc_open(mm_bc_t *bc, const uint8_t *buf, size_t sz);
+
+//  Map container file "fn" read-only and open it. Returns 0 on success.
+int mm_bc_map(mm_bc_t *bc, const char *fn);
+
+//  Unmap a container opened with mm_bc_map().
+void mm_bc_unmap(mm_bc_t *bc);
+
+//  Find the index of recipient "id". Returns -1 if not found.
+int64_t mm_bc_find(const mm_bc_t *bc, uint64_t id);
+
+//  ct_i of recipient index "i"
+static inline const uint8_t *mm_bc_cti(const mm_bc_t *bc, uint64_t i)
+{
+    return bc->cti + i * MM_BC_CTI_SZ;
+}
+
+#endif
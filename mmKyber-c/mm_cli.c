@@ -0,0 +1,188 @@
+//  mm_cli.c
+//  === Client of the batching mmKEM service (mm_srv.h).
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+
+#include "mm_cli.h"
+
+//  Connect to the service at "path". Returns the fd or -1.
+
+int mm_cli_connect(const char *path)
+{
+    struct sockaddr_un sa;
+    int fd;
+
+    if (strlen(path) >= sizeof(sa.sun_path)) {
+        return -1;
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    strcpy(sa.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *) &sa, sizeof(sa)) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+//  Close a connection.
+
+void mm_cli_close(int fd)
+{
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+//  send iov[0..cnt-1] completely
+
+static int cli_send(int fd, struct iovec *iov, int cnt)
+{
+    struct msghdr msg;
+    ssize_t r;
+
+    while (cnt > 0) {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = cnt;
+        r = sendmsg(fd, &msg, MSG_NOSIGNAL);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        while (cnt > 0 && (size_t) r >= iov->iov_len) {
+            r -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if (cnt > 0) {
+            iov->iov_base = (uint8_t *) iov->iov_base + r;
+            iov->iov_len -= r;
+        }
+    }
+    return 0;
+}
+
+//  receive exactly "len" bytes
+
+static int cli_recv(int fd, uint8_t *buf, size_t len)
+{
+    ssize_t r;
+
+    while (len > 0) {
+        r = recv(fd, buf, len, 0);
+        if (r <= 0) {
+            if (r < 0 && errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        buf += r;
+        len -= r;
+    }
+    return 0;
+}
+
+//  one request/response: payload in iov[1..], response into out[0..1]
+
+static int cli_call(int fd, uint8_t op, uint32_t n,
+                    struct iovec *iov, int cnt,
+                    uint8_t *out0, size_t out0_sz,
+                    uint8_t *out1, size_t out1_sz)
+{
+    uint8_t h[MM_SRV_HDR_SZ];
+    size_t sz;
+    int i;
+
+    sz = 0;
+    for (i = 1; i < cnt; i++) {
+        sz += iov[i].iov_len;
+    }
+    memcpy(h, MM_SRV_MAGIC, 4);
+    h[4] = op;
+    h[5] = 0;
+    h[6] = 0;
+    h[7] = 0;
+    put32u_le(h + 8, n);
+    put32u_le(h + 12, sz);
+    put64u_le(h + 16, 0);
+    iov[0].iov_base = h;
+    iov[0].iov_len = MM_SRV_HDR_SZ;
+
+    if (cli_send(fd, iov, cnt) != 0 ||
+        cli_recv(fd, h, MM_SRV_HDR_SZ) != 0 ||
+        memcmp(h, MM_SRV_MAGIC, 4) != 0 || h[4] != op) {
+        return -1;
+    }
+    sz = get32u_le(h + 12);
+    if (h[5] != MM_SRV_OK) {
+        return sz == 0 ? h[5] : -1;
+    }
+    if (sz != out0_sz + out1_sz ||
+        cli_recv(fd, out0, out0_sz) != 0 ||
+        cli_recv(fd, out1, out1_sz) != 0) {
+        return -1;
+    }
+
+    return MM_SRV_OK;
+}
+
+//  Encapsulate to recipients "ids".
+
+int mm_cli_encap(   int fd, uint8_t *ct, uint8_t *kk,
+                    const uint64_t *ids, uint32_t n)
+{
+    struct iovec iov[2];
+    uint8_t *b;
+    uint32_t i;
+    int r;
+
+    if (n == 0 || n > MM_SRV_N_MAX) {
+        return MM_SRV_EREQ;
+    }
+    b = (uint8_t *) malloc(8 * (size_t) n);
+    if (b == NULL) {
+        return -1;
+    }
+    for (i = 0; i < n; i++) {
+        put64u_le(b + 8 * i, ids[i]);
+    }
+    iov[1].iov_base = b;
+    iov[1].iov_len = 8 * (size_t) n;
+    r = cli_call(fd, MM_SRV_ENCAP, n, iov, 2,
+                    ct, MM_CTU_SZ + n * MMKEM_CTI_SZ, kk, n * MMKEM_K_SZ);
+    free(b);
+
+    return r;
+}
+
+//  Decapsulate (ct_u, ct_i) with private key "sk" on the service.
+
+int mm_cli_decap(   int fd, uint8_t *k, const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti)
+{
+    struct iovec iov[4];
+
+    iov[1].iov_base = (void *) sk;
+    iov[1].iov_len = MM_SK_SZ;
+    iov[2].iov_base = (void *) ctu;
+    iov[2].iov_len = MM_CTU_SZ;
+    iov[3].iov_base = (void *) cti;
+    iov[3].iov_len = MMKEM_CTI_SZ;
+
+    return cli_call(fd, MM_SRV_DECAP, 1, iov, 4, k, MMKEM_K_SZ, NULL, 0);
+}
@@ -0,0 +1,28 @@
+//  mm_cli.h
+//  === Header: Client of the batching mmKEM service (mm_srv.h).
+
+#ifndef _MM_CLI_H_
+#define _MM_CLI_H_
+
+#include "plat_local.h"
+#include "mm_param.h"
+#include "mm_srv.h"
+
+//  Connect to the service at "path". Returns the fd or -1.
+int mm_cli_connect(const char *path);
+
+//  Close a connection.
+void mm_cli_close(int fd);
+
+//  Encapsulate to recipients "ids": ct = ct_u || ct_1 .. ct_n as from
+//  mm_encap() and kk = K_1 .. K_n. Returns a status (MM_SRV_OK ..),
+//  or -1 on an I/O error.
+int mm_cli_encap(   int fd, uint8_t *ct, uint8_t *kk,
+                    const uint64_t *ids, uint32_t n);
+
+//  Decapsulate (ct_u, ct_i) with private key "sk" on the service.
+//  Returns a status, or -1 on an I/O error.
+int mm_cli_decap(   int fd, uint8_t *k, const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti);
+
+#endif
@@ -0,0 +1,235 @@
+//  mm_dem.c
+//  === Hybrid KEM-DEM broadcast of one payload to N recipients.
+
+#include <string.h>
+
+#include "mm_dem.h"
+#include "mmkyber.h"
+#include "sha3_t.h"
+
+//  SHAKE256( k[32] || b[b_sz] || x[x_sz] ) -> h[h_sz]
+
+static void dem_xof(uint8_t *h, size_t h_sz, const uint8_t k[32],
+                    const uint8_t *b, size_t b_sz,
+                    const uint8_t *x, size_t x_sz)
+{
+    sha3_t kec;
+
+    sha3_init(&kec, SHAKE256_RATE);
+    sha3_absorb(&kec, k, 32);
+    sha3_absorb(&kec, b, b_sz);
+    sha3_absorb(&kec, x, x_sz);
+    sha3_pad(&kec, SHAKE_PAD);
+    sha3_squeeze(&kec, h, h_sz);
+    sha3_clear(&kec);
+}
+
+//  compare without early exit
+
+static int dem_neq(const uint8_t *a, const uint8_t *b, size_t len)
+{
+    size_t i;
+    uint8_t d = 0;
+
+    for (i = 0; i < len; i++) {
+        d |= a[i] ^ b[i];
+    }
+    return d != 0;
+}
+
+//  slot domain: nonce || i || label
+
+static void dem_slot_dom(   uint8_t dom[MM_DEM_NONCE_SZ + 9],
+                            const uint8_t nonce[MM_DEM_NONCE_SZ],
+                            size_t i, uint8_t lab)
+{
+    memcpy(dom, nonce, MM_DEM_NONCE_SZ);
+    put64u_le(dom + MM_DEM_NONCE_SZ, i);
+    dom[MM_DEM_NONCE_SZ + 8] = lab;
+}
+
+//  Wrap "pkey" for recipient "i" under its key "ki".
+
+void mm_dem_wrap(   uint8_t slot[MM_DEM_SLOT_SZ],
+                    const uint8_t ki[MMKEM_K_SZ], size_t i,
+                    const uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t nonce[MM_DEM_NONCE_SZ])
+{
+    uint8_t dom[MM_DEM_NONCE_SZ + 9];
+    int j;
+
+    dem_slot_dom(dom, nonce, i, 'W');
+    dem_xof(slot, MM_DEM_KEY_SZ, ki, dom, sizeof(dom), NULL, 0);
+    for (j = 0; j < MM_DEM_KEY_SZ; j++) {
+        slot[j] ^= pkey[j];
+    }
+    dom[MM_DEM_NONCE_SZ + 8] = 'T';
+    dem_xof(slot + MM_DEM_KEY_SZ, MM_DEM_TAG_SZ, ki, dom, sizeof(dom),
+            slot, MM_DEM_KEY_SZ);
+}
+
+//  Unwrap "pkey" for recipient "i". Returns 0 on success, -1 on failure.
+
+int mm_dem_unwrap(  uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t slot[MM_DEM_SLOT_SZ],
+                    const uint8_t ki[MMKEM_K_SZ], size_t i,
+                    const uint8_t nonce[MM_DEM_NONCE_SZ])
+{
+    uint8_t dom[MM_DEM_NONCE_SZ + 9], tag[MM_DEM_TAG_SZ];
+    int j;
+
+    dem_slot_dom(dom, nonce, i, 'T');
+    dem_xof(tag, MM_DEM_TAG_SZ, ki, dom, sizeof(dom), slot, MM_DEM_KEY_SZ);
+    if (dem_neq(tag, slot + MM_DEM_KEY_SZ, MM_DEM_TAG_SZ)) {
+        memset(pkey, 0, MM_DEM_KEY_SZ);
+        return -1;
+    }
+    dom[MM_DEM_NONCE_SZ + 8] = 'W';
+    dem_xof(pkey, MM_DEM_KEY_SZ, ki, dom, sizeof(dom), NULL, 0);
+    for (j = 0; j < MM_DEM_KEY_SZ; j++) {
+        pkey[j] ^= slot[j];
+    }
+
+    return 0;
+}
+
+//  mmKEM: Encapsulate to "n" recipients and write a key-wrap slot each.
+
+size_t mm_dem_encap(uint8_t *ct, uint8_t *slots,
+                    const int32_t *a_mat, const uint8_t *pk[], size_t n,
+                    const uint8_t seed_e[32],
+                    const uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t nonce[MM_DEM_NONCE_SZ])
+{
+    mm_ses_t ses;
+    uint8_t ki[MMKEM_K_SZ];
+    size_t i, ct_sz;
+
+    ct_sz = mm_ses_init(&ses, ct, a_mat, seed_e, n);
+    for (i = 0; i < n; i++) {
+        mm_ses_encap(&ses, ct + ct_sz, ki, pk[i]);
+        mm_dem_wrap(slots, ki, i, pkey, nonce);
+        ct_sz += MMKEM_CTI_SZ;
+        slots += MM_DEM_SLOT_SZ;
+    }
+    mm_ses_clear(&ses);
+    memset(ki, 0, sizeof(ki));
+
+    return ct_sz;
+}
+
+//  mmKEM: Decapsulate recipient "i" and unwrap the payload key.
+
+int mm_dem_decap(   uint8_t pkey[MM_DEM_KEY_SZ], const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti,
+                    const uint8_t *slot, size_t i,
+                    const uint8_t nonce[MM_DEM_NONCE_SZ])
+{
+    uint8_t ki[MMKEM_K_SZ];
+    int r;
+
+    mm_decap(ki, sk, ctu, cti);
+    r = mm_dem_unwrap(pkey, slot, ki, i, nonce);
+    memset(ki, 0, sizeof(ki));
+
+    return r;
+}
+
+//  Start payload encryption or decryption with "pkey" and "nonce".
+
+void mm_dem_init(   mm_dem_t *st, const uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t nonce[MM_DEM_NONCE_SZ])
+{
+    uint8_t lab;
+
+    lab = 'E';
+    dem_xof(st->ke, 32, pkey, nonce, MM_DEM_NONCE_SZ, &lab, 1);
+    lab = 'M';
+    dem_xof(st->km, 32, pkey, nonce, MM_DEM_NONCE_SZ, &lab, 1);
+    st->j = 0;
+    st->done = 0;
+}
+
+//  keystream XOR (in-place allowed) and tag of chunk "j"
+
+static void dem_chunk(  const mm_dem_t *st, uint8_t *out,
+                        const uint8_t *in, size_t len, int last,
+                        uint8_t tag[MM_DEM_TAG_SZ], int enc)
+{
+    sha3_t kec;
+    uint8_t ks[SHAKE256_RATE], ctr[9];
+    size_t i, j, l;
+
+    put64u_le(ctr, st->j);
+    ctr[8] = last ? 1 : 0;
+
+    //  tag over the ciphertext (before decryption when decrypting)
+    if (!enc) {
+        dem_xof(tag, MM_DEM_TAG_SZ, st->km, ctr, 9, in, len);
+    }
+
+    sha3_init(&kec, SHAKE256_RATE);
+    sha3_absorb(&kec, st->ke, 32);
+    sha3_absorb(&kec, ctr, 9);
+    sha3_pad(&kec, SHAKE_PAD);
+    for (i = 0; i < len; i += l) {
+        l = len - i < sizeof(ks) ? len - i : sizeof(ks);
+        sha3_squeeze(&kec, ks, l);
+        for (j = 0; j < l; j++) {
+            out[i + j] = in[i + j] ^ ks[j];
+        }
+    }
+    sha3_clear(&kec);
+    memset(ks, 0, sizeof(ks));
+
+    if (enc) {
+        dem_xof(tag, MM_DEM_TAG_SZ, st->km, ctr, 9, out, len);
+    }
+}
+
+//  Encrypt the next chunk "in" to "out" (len + MM_DEM_TAG_SZ bytes).
+
+size_t mm_dem_enc_chunk(mm_dem_t *st, uint8_t *out,
+                        const uint8_t *in, size_t len, int last)
+{
+    if (st->done || len > MM_DEM_CHUNK || (!last && len != MM_DEM_CHUNK)) {
+        return 0;
+    }
+    dem_chunk(st, out, in, len, last, out + len, 1);
+    st->j++;
+    st->done = last;
+
+    return len + MM_DEM_TAG_SZ;
+}
+
+//  Decrypt the next chunk "in" (len bytes including the tag) to "out".
+
+int64_t mm_dem_dec_chunk(   mm_dem_t *st, uint8_t *out,
+                            const uint8_t *in, size_t len, int last)
+{
+    uint8_t tag[MM_DEM_TAG_SZ];
+
+    if (st->done || len < MM_DEM_TAG_SZ) {
+        return -1;
+    }
+    len -= MM_DEM_TAG_SZ;
+    if (len > MM_DEM_CHUNK || (!last && len != MM_DEM_CHUNK)) {
+        return -1;
+    }
+    dem_chunk(st, out, in, len, last, tag, 0);
+    if (dem_neq(tag, in + len, MM_DEM_TAG_SZ)) {
+        memset(out, 0, len);
+        return -1;
+    }
+    st->j++;
+    st->done = last;
+
+    return (int64_t) len;
+}
+
+//  Clear the state.
+
+void mm_dem_clear(mm_dem_t *st)
+{
+    memset(st, 0, sizeof(mm_dem_t));
+}
@@ -0,0 +1,88 @@
+//  mm_dem.h
+//  === Header: Hybrid KEM-DEM broadcast of one payload to N recipients.
+
+#ifndef _MM_DEM_H_
+#define _MM_DEM_H_
+
+#include "plat_local.h"
+#include "mm_param.h"
+
+/*
+    A random payload key P encrypts the payload once; each recipient gets
+    a key-wrap slot of P under its mmKEM key K_i. All symmetric operations
+    are SHAKE256:
+
+    ke, km  := SHAKE256(P || nonce || 'E' / 'M')
+    chunk j := SHAKE256(ke || j || last)  XOR  payload chunk j
+    tag j   := SHAKE256(km || j || last || chunk j) (16 bytes)
+    slot i  := SHAKE256(K_i || nonce || i || 'W')  XOR  P, then
+               SHAKE256(K_i || nonce || i || 'T' || wrapped P) (16 bytes)
+
+    The payload is a sequence of MM_DEM_CHUNK-byte chunks (the last one may
+    be shorter or empty), each followed by its tag. The "last" flag and the
+    chunk index in every tag detect reordering and truncation.
+*/
+
+#define MM_DEM_KEY_SZ   32
+#define MM_DEM_NONCE_SZ 16
+#define MM_DEM_TAG_SZ   16
+#define MM_DEM_SLOT_SZ  (MM_DEM_KEY_SZ + MM_DEM_TAG_SZ)
+
+#ifndef MM_DEM_CHUNK
+#define MM_DEM_CHUNK    65536
+#endif
+
+//  streaming payload encryption / decryption state
+
+typedef struct {
+    uint8_t ke[32], km[32];         //  derived keys
+    uint64_t j;                     //  next chunk index
+    int done;                       //  last chunk processed
+} mm_dem_t;
+
+//  mmKEM: Encapsulate to "n" recipients (ct as from mm_encap()) and write
+//  a key-wrap slot of payload key "pkey" for each one to "slots". K_i are
+//  not retained. Returns the length of ct.
+size_t mm_dem_encap(uint8_t *ct, uint8_t *slots,
+                    const int32_t *a_mat, const uint8_t *pk[], size_t n,
+                    const uint8_t seed_e[32],
+                    const uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t nonce[MM_DEM_NONCE_SZ]);
+
+//  mmKEM: Decapsulate recipient "i" and unwrap the payload key from its
+//  slot. Returns 0 on success, -1 if the slot does not authenticate.
+int mm_dem_decap(   uint8_t pkey[MM_DEM_KEY_SZ], const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti,
+                    const uint8_t *slot, size_t i,
+                    const uint8_t nonce[MM_DEM_NONCE_SZ]);
+
+//  Wrap "pkey" for recipient "i" under its key "ki".
+void mm_dem_wrap(   uint8_t slot[MM_DEM_SLOT_SZ],
+                    const uint8_t ki[MMKEM_K_SZ], size_t i,
+                    const uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t nonce[MM_DEM_NONCE_SZ]);
+
+//  Unwrap "pkey" for recipient "i". Returns 0 on success, -1 on failure.
+int mm_dem_unwrap(  uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t slot[MM_DEM_SLOT_SZ],
+                    const uint8_t ki[MMKEM_K_SZ], size_t i,
+                    const uint8_t nonce[MM_DEM_NONCE_SZ]);
+
+//  Start payload encryption or decryption with "pkey" and "nonce".
+void mm_dem_init(   mm_dem_t *st, const uint8_t pkey[MM_DEM_KEY_SZ],
+                    const uint8_t nonce[MM_DEM_NONCE_SZ]);
+
+//  Encrypt the next chunk "in" (MM_DEM_CHUNK bytes unless "last") to
+//  "out" (len + MM_DEM_TAG_SZ bytes). Returns bytes written, 0 on misuse.
+size_t mm_dem_enc_chunk(mm_dem_t *st, uint8_t *out,
+                        const uint8_t *in, size_t len, int last);
+
+//  Decrypt the next chunk "in" (len bytes including the tag) to "out".
+//  Returns payload bytes, or -1 if authentication fails (out is cleared).
+int64_t mm_dem_dec_chunk(   mm_dem_t *st, uint8_t *out,
+                            const uint8_t *in, size_t len, int last);
+
+//  Clear the state.
+void mm_dem_clear(mm_dem_t *st);
+
+#endif
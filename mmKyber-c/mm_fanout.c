@@ -0,0 +1,117 @@
+//  mm_fanout.c
+//  === Zero-copy per-recipient packets of a broadcast ciphertext.
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+
+#include "mm_fanout.h"
+
+//  Describe the packet of one recipient in iov[]. Returns the iov count.
+
+int mm_pkt_iov( struct iovec iov[MM_PKT_IOV],
+                const uint8_t *hdr, size_t hdr_sz,
+                const uint8_t *ctu, const uint8_t *cti)
+{
+    int k = 0;
+
+    if (hdr != NULL && hdr_sz > 0) {
+        iov[k].iov_base = (void *) hdr;
+        iov[k].iov_len = hdr_sz;
+        k++;
+    }
+    iov[k].iov_base = (void *) ctu;
+    iov[k].iov_len = MM_CTU_SZ;
+    k++;
+    iov[k].iov_base = (void *) cti;
+    iov[k].iov_len = MM_CTI_SZ;
+    k++;
+
+    return k;
+}
+
+//  Describe packets of all "n" recipients, packed (2 or 3 entries each).
+
+size_t mm_pkt_iov_all(  struct iovec *iov,
+                        const uint8_t *hdr, size_t hdr_sz,
+                        const uint8_t *ct, size_t n)
+{
+    size_t i, k;
+
+    k = 0;
+    for (i = 0; i < n; i++) {
+        k += mm_pkt_iov(iov + k, hdr != NULL ? hdr + i * hdr_sz : NULL,
+                        hdr_sz, ct, ct + MM_CTU_SZ + i * MM_CTI_SZ);
+    }
+
+    return k;
+}
+
+//  write all of iov[0..cnt-1], resuming after partial writes
+
+static int pkt_write(int fd, int sock, struct iovec *iov, int cnt)
+{
+    struct msghdr msg;
+    ssize_t r;
+
+    while (cnt > 0) {
+        if (sock) {
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov = iov;
+            msg.msg_iovlen = cnt;
+            r = sendmsg(fd, &msg, MSG_NOSIGNAL);
+        } else {
+            r = writev(fd, iov, cnt);
+        }
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (r == 0) {                   //  no progress; would spin
+            return -1;
+        }
+
+        //  skip what was written
+        while (cnt > 0 && (size_t) r >= iov->iov_len) {
+            r -= iov->iov_len;
+            iov++;
+            cnt--;
+        }
+        if (cnt > 0) {
+            iov->iov_base = (uint8_t *) iov->iov_base + r;
+            iov->iov_len -= r;
+        }
+    }
+
+    return 0;
+}
+
+//  Write the packet of recipient i to fd[i] with writev() / sendmsg().
+
+size_t mm_pkt_fanout(   const int *fd,
+                        const uint8_t *hdr, size_t hdr_sz,
+                        const uint8_t *ct, size_t n)
+{
+    struct iovec iov[MM_PKT_IOV];
+    struct stat st;
+    size_t i, ok;
+    int cnt, sock;
+
+    ok = 0;
+    for (i = 0; i < n; i++) {
+        if (fd[i] < 0) {
+            continue;
+        }
+        sock = fstat(fd[i], &st) == 0 && S_ISSOCK(st.st_mode);
+        cnt = mm_pkt_iov(iov, hdr != NULL ? hdr + i * hdr_sz : NULL,
+                            hdr_sz, ct, ct + MM_CTU_SZ + i * MM_CTI_SZ);
+        if (pkt_write(fd[i], sock, iov, cnt) == 0) {
+            ok++;
+        }
+    }
+
+    return ok;
+}
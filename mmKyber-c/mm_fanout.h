@@ -0,0 +1,36 @@
+//  mm_fanout.h
+//  === Header: Zero-copy per-recipient packets of a broadcast ciphertext.
+
+#ifndef _MM_FANOUT_H_
+#define _MM_FANOUT_H_
+
+#include <sys/uio.h>
+
+#include "plat_local.h"
+#include "mm_param.h"
+
+//  A recipient packet is [ hdr_i ] || ct_u || ct_i. The shared ct_u is
+//  referenced, never copied; hdr_i (optional) is hdr + i * hdr_sz.
+
+#define MM_PKT_IOV  3
+
+//  Describe the packet of one recipient in iov[]. Returns the iov count.
+int mm_pkt_iov( struct iovec iov[MM_PKT_IOV],
+                const uint8_t *hdr, size_t hdr_sz,
+                const uint8_t *ctu, const uint8_t *cti);
+
+//  Describe packets of all "n" recipients of "ct" (as from mm_encap()).
+//  The entries are packed: 3 per recipient with "hdr", 2 without, so iov[]
+//  needs at most n * MM_PKT_IOV entries. Returns the total iov count.
+size_t mm_pkt_iov_all(  struct iovec *iov,
+                        const uint8_t *hdr, size_t hdr_sz,
+                        const uint8_t *ct, size_t n);
+
+//  Write the packet of recipient i to fd[i] (file, pipe, or socket) with
+//  writev() / sendmsg(); fd[i] < 0 is skipped. Returns the number of
+//  packets written completely.
+size_t mm_pkt_fanout(   const int *fd,
+                        const uint8_t *hdr, size_t hdr_sz,
+                        const uint8_t *ct, size_t n);
+
+#endif
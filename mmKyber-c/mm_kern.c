@@ -0,0 +1,98 @@
+//  mm_kern.c
+//  === Kernel backend selection.
+
+#include <string.h>
+
+#include "mm_kern.h"
+
+//  backend tables (mm_kern_poly.c, mm_kern_fma.c), most preferred first;
+//  "fma" only when asked for (mm_kern_set(), mm_tune.h)
+
+extern const mm_kern_t mm_kern_generic;
+#ifdef MM_KERN_X86
+extern const mm_kern_t mm_kern_avx2, mm_kern_avx512, mm_kern_fma;
+#endif
+
+static const mm_kern_t *kern_tab[] = {
+#ifdef MM_KERN_X86
+    &mm_kern_avx512,
+    &mm_kern_avx2,
+#endif
+    &mm_kern_generic,
+#ifdef MM_KERN_X86
+    &mm_kern_fma
+#endif
+};
+
+#define KERN_TAB_N  (sizeof(kern_tab) / sizeof(kern_tab[0]))
+
+const mm_kern_t *mm_kern = &mm_kern_generic;
+
+//  can this CPU run backend "k"? (checks OS support of the vector state)
+
+static int kern_cpu(const mm_kern_t *k)
+{
+#ifdef MM_KERN_X86
+    __builtin_cpu_init();
+    if (k == &mm_kern_avx512) {
+        return  __builtin_cpu_supports("avx512f") &&
+                __builtin_cpu_supports("avx512bw") &&
+                __builtin_cpu_supports("avx512dq") &&
+                __builtin_cpu_supports("avx512vl") &&
+                __builtin_cpu_supports("avx2") &&
+                __builtin_cpu_supports("bmi2") &&
+                __builtin_cpu_supports("fma");
+    }
+    if (k == &mm_kern_avx2 || k == &mm_kern_fma) {
+        return  __builtin_cpu_supports("avx2") &&
+                __builtin_cpu_supports("bmi2") &&
+                __builtin_cpu_supports("fma");
+    }
+#endif
+    return k == &mm_kern_generic;
+}
+
+const mm_kern_t *mm_kern_get(const char *name)
+{
+    size_t i;
+
+    for (i = 0; i < KERN_TAB_N; i++) {
+        if (strcmp(kern_tab[i]->name, name) == 0) {
+            return kern_cpu(kern_tab[i]) ? kern_tab[i] : NULL;
+        }
+    }
+    return NULL;
+}
+
+int mm_kern_set(const char *name)
+{
+    const mm_kern_t *k;
+
+    k = mm_kern_get(name);
+    if (k == NULL) {
+        return -1;
+    }
+    mm_kern = k;
+
+    return 0;
+}
+
+//  once, at load time: the forced backend if runnable, else the best
+
+__attribute__((constructor))
+static void kern_init(void)
+{
+    size_t i;
+
+#ifdef MM_KERN_FORCE
+    if (mm_kern_set(MM_KERN_FORCE) == 0) {
+        return;
+    }
+#endif
+    for (i = 0; i < KERN_TAB_N; i++) {
+        if (kern_cpu(kern_tab[i])) {
+            mm_kern = kern_tab[i];
+            return;
+        }
+    }
+}
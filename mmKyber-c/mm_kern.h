@@ -0,0 +1,92 @@
+//  mm_kern.h
+//  === Header: Hot kernels behind a per-CPU dispatch table.
+
+#ifndef _MM_KERN_H_
+#define _MM_KERN_H_
+
+#include "plat_local.h"
+
+/*
+    The Keccak permutations, the NTTs, the NTT-domain multiply-add, bit
+    packing / compression, and the public key unpacking and range check of
+    mm_pk_validate_batch() are compiled once per backend: "generic" with
+    the base flags and, on x86-64, "avx2" and "avx512" with those
+    instruction sets enabled (see the Makefile). Each instance exports a
+    table; the best one this CPU supports is selected once when the
+    library is loaded, unless the build forces a backend with
+    -DMM_KERN_FORCE=\"name\" (make KERN=name). The kernel entry points of
+    keccakf1600.h, mm_ring.h, and mm_serial.h call through the selected
+    table. All backends give bit-identical results.
+
+    "fma" (mm_kern_fma.c, x86-64) computes the NTTs and the multiply-add
+    in doubles with FMA reduction and takes the rest from "avx2". It is
+    never picked automatically; mm_kern_set("fma") or a tuning profile
+    selects it. Its forward NTT and multiply-add return other
+    representatives of the same values mod q, so all library outputs are
+    still bit-identical.
+
+    polyr_intt_ct() (mm_ntt.c) ends the inverse NTT in the ciphertext:
+    with AVX2 the last layer's vectors get the noise and message added,
+    are compressed (exactly, in doubles) and packed in registers; the
+    generic version does all of that in one pass after the transform.
+
+    The samplers use the dispatched Keccak permutations; their rejection
+    loops are data-dependent and stay scalar.
+*/
+
+//  backend of the current compilation unit (kernel sources only)
+#ifndef MM_KERN
+#define MM_KERN generic
+#endif
+
+#define MM_KERN_CAT(x, k)   x##_##k
+#define MM_KERN_XCAT(x, k)  MM_KERN_CAT(x, k)
+#define MM_KN(x)            MM_KERN_XCAT(x, MM_KERN)
+#define MM_KERN_STR(k)      #k
+#define MM_KERN_XSTR(k)     MM_KERN_STR(k)
+#define MM_KERN_NAME        MM_KERN_XSTR(MM_KERN)
+
+typedef struct {
+    const char *name;
+    void (*keccak_f1600)(uint64_t state[25]);
+    void (*keccak_f1600_x4)(uint64_t state[25][4]);
+    void (*polyr_fntt)(int32_t *f);
+    void (*polyr_intt)(int32_t *f);
+    void (*polyr_ntt_mul_add)(  int32_t *fg,
+                                const int32_t *f, const int32_t *g);
+    size_t (*poly_serial)(uint8_t *b, const int32_t *p, int dx);
+    size_t (*poly_deserial)(int32_t *p, const uint8_t *b, int dx);
+    int32_t (*poly_deserial_q)(int32_t *p, const uint8_t *b);
+    size_t (*poly_compress)(uint8_t *b, const int32_t *p, int dx);
+    size_t (*poly_decompress)(int32_t *p, const uint8_t *b, int dx);
+    size_t (*polyr_intt_ct)(uint8_t *ct, uint8_t *k, int32_t *f,
+                            const int32_t *e, const uint8_t *m, int dx);
+} mm_kern_t;
+
+//  selected backend; mm_kern->name is for logging
+extern const mm_kern_t *mm_kern;
+
+//  Backend "name" ("generic", "avx2", "avx512"), or NULL if it is not
+//  built in or this CPU cannot run it.
+const mm_kern_t *mm_kern_get(const char *name);
+
+//  Select backend "name"; returns 0 on success. Not safe while other
+//  threads use the library.
+int mm_kern_set(const char *name);
+
+//  === kernels of backend MM_KERN -- keccakf1600.c, mm_ntt.c, mm_kern_poly.c
+
+void MM_KN(keccak_f1600)(uint64_t state[25]);
+void MM_KN(keccak_f1600_x4)(uint64_t state[25][4]);
+void MM_KN(polyr_fntt)(int32_t *f);
+void MM_KN(polyr_intt)(int32_t *f);
+void MM_KN(polyr_ntt_mul_add)(int32_t *fg, const int32_t *f, const int32_t *g);
+size_t MM_KN(poly_serial)(uint8_t *b, const int32_t *p, int dx);
+size_t MM_KN(poly_deserial)(int32_t *p, const uint8_t *b, int dx);
+int32_t MM_KN(poly_deserial_q)(int32_t *p, const uint8_t *b);
+size_t MM_KN(poly_compress)(uint8_t *b, const int32_t *p, int dx);
+size_t MM_KN(poly_decompress)(int32_t *p, const uint8_t *b, int dx);
+size_t MM_KN(polyr_intt_ct)(uint8_t *ct, uint8_t *k, int32_t *f,
+                            const int32_t *e, const uint8_t *m, int dx);
+
+#endif
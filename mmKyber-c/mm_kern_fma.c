@@ -0,0 +1,294 @@
+//  mm_kern_fma.c
+//  === Double-precision FMA NTT kernels ("fma" backend, mm_kern.h).
+
+#include <math.h>
+#include <immintrin.h>
+
+#include "mm_ring.h"
+
+/*
+    Compiled with -mavx2 -mfma on x86-64 (see the Makefile); the other
+    kernels of the table are those of "avx2". Coefficients are held in
+    doubles and reduced by
+
+        red(x) = x - k * q,     k = round(x * (1/q))
+
+    with k rounded by adding and subtracting 1.5 * 2^52 and x - k * q as
+    one FMA. For |x| < 2^53 the product x * (1/q) is off by less than
+    2^-25 from x / q, so |red(x)| <= q/2 + 1, and x - k * q is an integer
+    below 2^53, hence exact. All products below are kept under 2^53:
+
+    fntt        red() the input (any int32), then per layer
+                t = red(b * w), a + t, a - t: |a| <= 9 * (q/2 + 1) < 5q
+                after 8 layers, |w| <= q/2. Output in (-5q, 5q).
+    intt        red() the input, then x + y, red((y - x) * w), with x + y
+                reduced on odd layers (|x| < 2q); the last layer scales by
+                R/d and returns [0, q) -- the same values as polyr_intt().
+    mul_add     fg += red(red(f * R^-1) * g), |g| <= 8q as mont_mulq().
+
+    The forward transform and the multiply-add give the integer kernels'
+    values mod q, not the same representatives (within the bounds the
+    integer kernels have); everything serialized or compressed is
+    bit-identical.
+*/
+
+#define FMA_Q       ((double) MM_Q)
+#define FMA_QI      (1.0 / FMA_Q)
+#define FMA_RND     0x1.8p52
+#define FMA_RINV    131024.0        //  2^-32 mod q
+#define FMA_RD      -16773121.0     //  2^32 / d mod q
+
+#if MM_D != 256 || MM_Q != 33550337l
+#error "mm_kern_fma.c: twiddles are for d = 256, q = 2^25 - 2^12 + 1"
+#endif
+
+//  h^bitrev(i) mod q in (-q/2, q/2): mm_w[] without the factor R
+
+static const double fma_w[MM_D] = {
+    1,          12759331,   13682589,   -6356706,   -16179053,  -10946023,
+    -2269872,   11836922,   -3257440,   6209026,    878186,     -8597020,
+    15930566,   -10089674,  14378272,   -2899060,   255445,     -7281244,
+    9039793,    13996293,   6519423,    11790682,   -10529006,  -8031498,
+    -14852863,  6015232,    10669588,   5084772,    -4043534,   13663747,
+    1648639,    6206901,    -6244019,   -2642327,   10619470,   2356934,
+    1754428,    5915876,    -14668060,  -16123009,  -5501183,   -16643459,
+    -10090928,  -12620891,  -13090077,  -2101717,   15531894,   3346823,
+    13137862,   -3540749,   11566352,   6208165,    -5541186,   6665666,
+    -14500877,  -3314896,   6173810,    10320385,   -4711250,   9031846,
+    -382160,    -606391,    16010558,   -486199,    14921815,   -15111271,
+    -4269300,   -11074316,  8236665,    -15460491,  -1540678,   -5809356,
+    5983912,    10669950,   4851793,    -6337426,   -2686341,   16140428,
+    5433838,    -2821829,   15695768,   1852603,    15916022,   -14885791,
+    6156981,    5695786,    -13038700,  -5987573,   7047120,    -10449793,
+    -16736232,  7076354,    -7334084,   -9283470,   2205546,    6881540,
+    7702823,    7828558,    2301665,    -11551106,  -10813606,  7091097,
+    375524,     10736463,   8081092,    16376788,   -8277873,   -3720230,
+    6160655,    13657091,   -1611540,   -9490865,   -12543141,  -1838575,
+    12710337,   12766306,   -15238786,  2578535,    5314697,    3492970,
+    -10588996,  10640467,   2271277,    -856825,    -3590847,   4468561,
+    2799690,    -13107968,  8433925,    10991503,   2004823,    14210459,
+    -8456955,   9017350,    -7264389,   608390,     -9246517,   -13543671,
+    16014267,   -15653027,  9536185,    11211185,   -9784636,   -9065347,
+    2631507,    -2568684,   9667267,    11987540,   -14220882,  5033678,
+    -16258972,  5022566,    740072,     14162508,   5393742,    8131308,
+    15009103,   -15613995,  -3337194,   13795999,   -6029602,   -13847628,
+    14636455,   -1032843,   9042790,    6327120,    926175,     5288089,
+    -5097997,   -6838114,   3425390,    -3692440,   11269975,   -6901341,
+    -12537949,  16242739,   -2811894,   5346461,    -6757468,   5270033,
+    -5210900,   10784099,   -10203649,  12226311,   -1513010,   2714838,
+    5959590,    -14711719,  4996916,    -10594080,  -7661948,   -10162598,
+    7265307,    3389855,    3773314,    -6154425,   -562866,    -8464426,
+    15718276,   -2009969,   5434709,    5393925,    -10244525,  1801020,
+    9856327,    -11674237,  -3926055,   5153810,    15905123,   -12687495,
+    6563057,    -15402979,  15439012,   -10281268,  -15117992,  -15724094,
+    -10154218,  5931709,    13597375,   -14217381,  -2039313,   -3766220,
+    -4445871,   -228430,    4172010,    -15320011,  12748610,   -8063703,
+    13996356,   -10410028,  -10561100,  9412810,    -4997495,   4015571,
+    3322449,    158302,     1168074,    11445343,   3077907,    -10822100,
+    -7360355,   -8251204,   5220545,    -9672720,   7496015,    10108160,
+    2408670,    3248671,    5212575,    -10469343,  13660053,   9298305,
+    15515989,   12175781,   -16193980,  -4216711    };
+
+//  x mod q in [-q/2 - 1, q/2 + 1] for |x| < 2^53
+
+static inline double fma_red(double x)
+{
+    double k;
+
+    XASSUME(x > -0x1p53 && x < 0x1p53);
+
+    k = (x * FMA_QI + FMA_RND) - FMA_RND;
+    x = fma(-k, FMA_Q, x);
+
+    XASSERT(x >= -0.5 * FMA_Q - 1.0 && x <= 0.5 * FMA_Q + 1.0);
+    XASSERT(x == floor(x));
+
+    return x;
+}
+
+//  fma_red() and mont_cadd() on 4 lanes
+
+static inline __m256d red_x4(__m256d x)
+{
+    __m256d k;
+
+    k = _mm256_sub_pd(_mm256_fmadd_pd(x, _mm256_set1_pd(FMA_QI),
+                        _mm256_set1_pd(FMA_RND)), _mm256_set1_pd(FMA_RND));
+    return _mm256_fnmadd_pd(k, _mm256_set1_pd(FMA_Q), x);
+}
+
+static inline __m256d cadd_x4(__m256d x)
+{
+    return _mm256_add_pd(x, _mm256_and_pd(_mm256_cmp_pd(x,
+                        _mm256_setzero_pd(), _CMP_LT_OQ),
+                        _mm256_set1_pd(FMA_Q)));
+}
+
+//  int32 <-> double, 4 coefficients
+
+static inline __m256d ld_x4(const int32_t *f)
+{
+    return _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *) f));
+}
+
+static inline void st_x4(int32_t *f, __m256d x)
+{
+    _mm_storeu_si128((__m128i *) f, _mm256_cvtpd_epi32(x));
+}
+
+//  Forward NTT (negacyclic -- evaluate polynomial at factors of x^n+1).
+
+void MM_KN(polyr_fntt)(int32_t *f)
+{
+    __m256d v[MM_D / 4];
+    __m256d a, b, lo, hi, y, z;
+    int i, j, k, l;
+
+    //  j = d/2, reducing the input
+    z = _mm256_set1_pd(fma_w[1]);
+    for (l = 0; l < MM_D / 8; l++) {
+        a = red_x4(ld_x4(f + 4 * l));
+        b = red_x4(ld_x4(f + 4 * l + MM_D / 2));
+        y = red_x4(_mm256_mul_pd(b, z));
+        v[l] = _mm256_add_pd(a, y);
+        v[l + MM_D / 8] = _mm256_sub_pd(a, y);
+    }
+
+    //  distance j >= 4: whole vectors, one twiddle per group
+    for (k = 2, j = MM_D >> 4; j > 0; k <<= 1, j >>= 1) {
+        for (i = 0; i < k; i++) {
+            z = _mm256_set1_pd(fma_w[k + i]);
+            for (l = 2 * i * j; l < (2 * i + 1) * j; l++) {
+                y = red_x4(_mm256_mul_pd(v[l + j], z));
+                v[l + j] = _mm256_sub_pd(v[l], y);
+                v[l] = _mm256_add_pd(v[l], y);
+            }
+        }
+    }
+
+    //  j = 2 and j = 1 on vector pairs (four groups of j = 1)
+    for (i = 0; i < MM_D / 4; i += 2) {
+        a = v[i];
+        b = v[i + 1];
+        lo = _mm256_permute2f128_pd(a, b, 0x20);
+        hi = _mm256_permute2f128_pd(a, b, 0x31);
+        z = _mm256_permute4x64_pd(_mm256_castpd128_pd256(
+                _mm_loadu_pd(fma_w + 64 + i)), 0x50);
+        y = red_x4(_mm256_mul_pd(hi, z));
+        hi = _mm256_sub_pd(lo, y);
+        lo = _mm256_add_pd(lo, y);
+        a = _mm256_permute2f128_pd(lo, hi, 0x20);
+        b = _mm256_permute2f128_pd(lo, hi, 0x31);
+
+        lo = _mm256_unpacklo_pd(a, b);
+        hi = _mm256_unpackhi_pd(a, b);
+        z = _mm256_permute4x64_pd(_mm256_loadu_pd(fma_w + 128 + 2 * i), 0xD8);
+        y = red_x4(_mm256_mul_pd(hi, z));
+        hi = _mm256_sub_pd(lo, y);
+        lo = _mm256_add_pd(lo, y);
+        st_x4(f + 4 * i, _mm256_unpacklo_pd(lo, hi));
+        st_x4(f + 4 * i + 4, _mm256_unpackhi_pd(lo, hi));
+    }
+}
+
+//  Reverse NTT (negacyclic -- x^n+1), normalize by 1/(n*r).
+
+void MM_KN(polyr_intt)(int32_t *f)
+{
+    __m256d v[MM_D / 4];
+    __m256d a, b, lo, hi, y, z, rd;
+    int i, j, k, l;
+
+    //  j = 1 and j = 2 on vector pairs; twiddle of group i is w[2k-1-i]
+    for (i = 0; i < MM_D / 4; i += 2) {
+        a = red_x4(ld_x4(f + 4 * i));
+        b = red_x4(ld_x4(f + 4 * i + 4));
+
+        lo = _mm256_unpacklo_pd(a, b);
+        hi = _mm256_unpackhi_pd(a, b);
+        z = _mm256_permute4x64_pd(_mm256_loadu_pd(fma_w + 252 - 2 * i), 0x27);
+        y = _mm256_sub_pd(hi, lo);
+        lo = _mm256_add_pd(lo, hi);
+        hi = red_x4(_mm256_mul_pd(y, z));
+        a = _mm256_unpacklo_pd(lo, hi);
+        b = _mm256_unpackhi_pd(lo, hi);
+
+        lo = _mm256_permute2f128_pd(a, b, 0x20);
+        hi = _mm256_permute2f128_pd(a, b, 0x31);
+        z = _mm256_permute4x64_pd(_mm256_castpd128_pd256(
+                _mm_loadu_pd(fma_w + 126 - i)), 0x05);
+        y = _mm256_sub_pd(hi, lo);
+        lo = red_x4(_mm256_add_pd(lo, hi));
+        hi = red_x4(_mm256_mul_pd(y, z));
+        v[i] = _mm256_permute2f128_pd(lo, hi, 0x20);
+        v[i + 1] = _mm256_permute2f128_pd(lo, hi, 0x31);
+    }
+
+    //  j = 4 .. d/4 on whole vectors, x + y reduced on odd layers
+    for (j = 1, k = MM_D >> 3; k > 1; j <<= 1, k >>= 1) {
+        for (i = 0; i < k; i++) {
+            z = _mm256_set1_pd(fma_w[2 * k - 1 - i]);
+            for (l = 2 * i * j; l < (2 * i + 1) * j; l++) {
+                y = _mm256_sub_pd(v[l + j], v[l]);
+                v[l] = _mm256_add_pd(v[l], v[l + j]);
+                if (j & 0x0A) {
+                    v[l] = red_x4(v[l]);
+                }
+                v[l + j] = red_x4(_mm256_mul_pd(y, z));
+            }
+        }
+    }
+
+    //  last layer (k = 1) with normalization; canonical as mont_cadd()
+    rd = _mm256_set1_pd(FMA_RD);
+    z = _mm256_set1_pd(fma_red(fma_w[1] * FMA_RD));
+    for (l = 0; l < j; l++) {
+        a = v[l];
+        b = v[l + j];
+        y = _mm256_sub_pd(b, a);
+        st_x4(f + 4 * l, cadd_x4(red_x4(_mm256_mul_pd(_mm256_add_pd(a, b),
+                                    rd))));
+        st_x4(f + 4 * (l + j), cadd_x4(red_x4(_mm256_mul_pd(y, z))));
+    }
+}
+
+//  Coefficient multiply and add:  r += a * b / R  (as mont_mulq()).
+
+void MM_KN(polyr_ntt_mul_add)(int32_t *fg, const int32_t *f, const int32_t *g)
+{
+    int i;
+    double x;
+
+    for (i = 0; i < MM_D; i++) {
+        XASSUME(g[i] >= -8 * MONT_Q && g[i] <= 8 * MONT_Q);
+        x = fma_red((double) f[i] * FMA_RINV);
+        fg[i] += (int32_t) fma_red(x * (double) g[i]);
+    }
+}
+
+//  the table of this backend: the rest is "avx2"
+
+void keccak_f1600_avx2(uint64_t state[25]);
+void keccak_f1600_x4_avx2(uint64_t state[25][4]);
+size_t poly_serial_avx2(uint8_t *b, const int32_t *p, int dx);
+size_t poly_deserial_avx2(int32_t *p, const uint8_t *b, int dx);
+int32_t poly_deserial_q_avx2(int32_t *p, const uint8_t *b);
+size_t poly_compress_avx2(uint8_t *b, const int32_t *p, int dx);
+size_t poly_decompress_avx2(int32_t *p, const uint8_t *b, int dx);
+size_t polyr_intt_ct_avx2(  uint8_t *ct, uint8_t *k, int32_t *f,
+                            const int32_t *e, const uint8_t *m, int dx);
+
+const mm_kern_t MM_KN(mm_kern) = {
+    MM_KERN_NAME,
+    keccak_f1600_avx2,
+    keccak_f1600_x4_avx2,
+    MM_KN(polyr_fntt),
+    MM_KN(polyr_intt),
+    MM_KN(polyr_ntt_mul_add),
+    poly_serial_avx2,
+    poly_deserial_avx2,
+    poly_deserial_q_avx2,
+    poly_compress_avx2,
+    poly_decompress_avx2,
+    polyr_intt_ct_avx2
+};
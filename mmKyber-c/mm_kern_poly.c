@@ -0,0 +1,243 @@
+//  mm_kern_poly.c
+//  === Multiply-add, bit packing and compression kernels; backend table.
+
+#include "mm_ring.h"
+#include "mm_serial.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+//  Compiled once per backend (mm_kern.h); callers use the wrappers of
+//  mm_ring.h and mm_serial.h.
+
+//  Coefficient multiply and add:  r += a * b, Montgomery reduction.
+
+void MM_KN(polyr_ntt_mul_add)(int32_t *fg, const int32_t *f, const int32_t *g)
+{
+    int i;
+
+    for (i = 0; i < MM_D; i++) {
+        fg[i] += mont_mulq(f[i], g[i]);
+    }
+}
+
+//  Pack dx-bit elements from "p" to "b". Return byte length written to "b".
+
+size_t MM_KN(poly_serial)(uint8_t *b, const int32_t *p, int dx)
+{
+    int64_t x, t, m;
+    int i, j, l;
+
+    m = (1 << dx) - 1;
+    l = 0;
+    t = 0;
+    j = 0;
+    for (i = 0; i < MM_D; i++) {
+
+        //  read coefficint
+        x = p[i] & m;
+
+        //  serialize
+        t |= x << l;
+        l += dx;
+        while (l >= 8) {
+            b[j++] = t & 0xFF;
+            t >>= 8;
+            l -= 8;
+        }
+    }
+    //  remaining part?
+    if (l > 0) {
+        b[j++] = t & 0xFF;
+    }
+
+    return (size_t) j;
+}
+
+//  Unpack dx-bit elements from "b" to "p". Return bytes read from "b".
+
+size_t MM_KN(poly_deserial)(int32_t *p, const uint8_t *b, int dx)
+{
+    uint32_t t, m, s;
+    int i, j, l;
+
+    if (dx == MM_LOGQ) {        //  signedness
+        s = 0;
+    } else {
+        s = 1 << (dx - 1);
+    }
+
+    m = (1 << dx) - 1;
+    i = 0;
+    l = 0;
+    t = 0;
+    for (j = 0; j < MM_D; j++) {
+
+        //  decode a coefficient
+        while (l < dx) {
+            t |= ((uint32_t) b[i++]) << l;
+            l += 8;
+        }
+        p[j] = ((t + s) & m) - s;
+        l -= dx;
+        t >>= dx;
+    }
+
+    return (size_t) i;
+}
+
+//  Unpack MM_LOGQ-bit public key elements from "b" to "p" and check their
+//  range. Returns 0 iff all coefficients are in [0, q-1] (no early exit).
+
+int32_t MM_KN(poly_deserial_q)(int32_t *p, const uint8_t *b)
+{
+    int i;
+
+    //  each coefficient fits into a single unaligned 32-bit load; a group
+    //  of 8 coefficients is MM_LOGQ bytes, and lane k of a group loads at
+    //  byte (k * MM_LOGQ) / 8 and shifts by (k * MM_LOGQ) % 8
+#if defined(__AVX512F__)
+    const __m512i kq = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3,
+                        4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                        _mm512_set1_epi32(MM_LOGQ));
+    const __m512i o = _mm512_srli_epi32(kq, 3);
+    const __m512i s = _mm512_and_si512(kq, _mm512_set1_epi32(7));
+    const __m512i m = _mm512_set1_epi32((1 << MM_LOGQ) - 1);
+    const __m512i q1 = _mm512_set1_epi32(MM_Q - 1);
+    __m512i x;
+    __mmask16 f;
+
+    f = 0;
+    for (i = 0; i < MM_D; i += 16) {
+        x = _mm512_i32gather_epi32(o, b + (i >> 3) * MM_LOGQ, 1);
+        x = _mm512_and_si512(_mm512_srlv_epi32(x, s), m);
+        f |= _mm512_cmpgt_epi32_mask(x, q1);
+        _mm512_storeu_si512(p + i, x);
+    }
+
+    return -(int32_t) (f != 0);
+#elif defined(__AVX2__)
+    const __m256i kq = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3,
+                        4, 5, 6, 7), _mm256_set1_epi32(MM_LOGQ));
+    const __m256i o = _mm256_srli_epi32(kq, 3);
+    const __m256i s = _mm256_and_si256(kq, _mm256_set1_epi32(7));
+    const __m256i m = _mm256_set1_epi32((1 << MM_LOGQ) - 1);
+    const __m256i q1 = _mm256_set1_epi32(MM_Q - 1);
+    __m256i x, f;
+
+    f = _mm256_setzero_si256();
+    for (i = 0; i < MM_D; i += 8) {
+        x = _mm256_i32gather_epi32((const int *) (b + (i >> 3) * MM_LOGQ),
+                                    o, 1);
+        x = _mm256_and_si256(_mm256_srlv_epi32(x, s), m);
+        f = _mm256_or_si256(f, _mm256_sub_epi32(q1, x));
+        _mm256_storeu_si256((__m256i *) (p + i), x);
+    }
+
+    return -(int32_t) (_mm256_movemask_ps(_mm256_castsi256_ps(f)) != 0);
+#else
+    int o;
+    int32_t x, f;
+
+    f = 0;
+    for (i = 0; i < MM_D; i++) {
+        o = i * MM_LOGQ;
+        x = (get32u_le(b + (o >> 3)) >> (o & 7)) & ((1 << MM_LOGQ) - 1);
+        f |= (MM_Q - 1) - x;
+        p[i] = x;
+    }
+
+    return f >> 31;
+#endif
+}
+
+//  Compress a polynomial "a" to bytes in "b", "dx" bits per coefficient.
+//  Return number of bytes written to "b".
+
+size_t MM_KN(poly_compress)(uint8_t *b, const int32_t *p, int dx)
+{
+    int64_t d, x, y;
+    int64_t t, m;
+    int i, j, l;
+
+    m = (1 << dx) - 1;
+    l = 0;
+    t = 0;
+    j = 0;
+    for (i = 0; i < MM_D; i++) {
+
+        //  scale, add a rounding constant
+        x = (((int64_t) p[i]) << dx) + (MM_Q / 2l);
+
+        //  divide by Q, constant time (x < 2**51)
+        d = x >> MM_LOGQ;
+        y = x - d * MM_Q;
+        d += y >> MM_LOGQ;
+        y = x - d * MM_Q;
+        d += ((y - MM_Q) >> 31) + 1;
+
+        //  serialize
+        t |= (d & m) << l;
+        l += dx;
+        while (l >= 8) {
+            b[j++] = t & 0xFF;
+            t >>= 8;
+            l -= 8;
+        }
+    }
+    //  remaining part?
+    if (l > 0) {
+        b[j++] = t & 0xFF;
+    }
+
+    return (size_t) j;
+}
+
+//  Decompress a polynomial from "b" ("dx" bits per coefficient) into "p",
+//  Return number of bytes read from "b".
+
+size_t MM_KN(poly_decompress)(int32_t *p, const uint8_t *b, int dx)
+{
+    int64_t x, t, m;
+    int i, j, l;
+
+    m = (1 << dx) - 1;
+    i = 0;
+    l = 0;
+    t = 0;
+    for (j = 0; j < MM_D; j++) {
+
+        //  decode a coefficient
+        while (l < dx) {
+            t |= ((int64_t) b[i++]) << l;
+            l += 8;
+        }
+        x = t & m;
+        l -= dx;
+        t >>= dx;
+
+        //  round up and store coefficient
+        x = (x * MM_Q) + (1l << (dx - 1));
+        p[j] = (int32_t) (x >> dx);
+    }
+
+    return (size_t) i;
+}
+
+//  the table of this backend
+
+const mm_kern_t MM_KN(mm_kern) = {
+    MM_KERN_NAME,
+    MM_KN(keccak_f1600),
+    MM_KN(keccak_f1600_x4),
+    MM_KN(polyr_fntt),
+    MM_KN(polyr_intt),
+    MM_KN(polyr_ntt_mul_add),
+    MM_KN(poly_serial),
+    MM_KN(poly_deserial),
+    MM_KN(poly_deserial_q),
+    MM_KN(poly_compress),
+    MM_KN(poly_decompress),
+    MM_KN(polyr_intt_ct)
+};
@@ -0,0 +1,62 @@
+//  mm_ns.h
+//  === Header: Per-level symbol names for the multi-parameter library.
+
+#ifndef _MM_NS_H_
+#define _MM_NS_H_
+
+//  With MM_MULTI the level-dependent core (mmkyber.c, mm_sample.c) is
+//  compiled once per parameter set, each a fully specialized instance;
+//  its external symbols get a _128, _192 or _256 suffix so that all
+//  instances link into one library (see mm_ops.h).
+
+#define MM_NS_CAT(x, l)     x##_##l
+#define MM_NS_XCAT(x, l)    MM_NS_CAT(x, l)
+#define MM_NS(x)            MM_NS_XCAT(x, MM_LEVEL)
+
+//  mmkyber.c
+#define mm_setup                MM_NS(mm_setup)
+#define mm_kgen                 MM_NS(mm_kgen)
+#define mm_kgen_s               MM_NS(mm_kgen_s)
+#define mm_kgen_l               MM_NS(mm_kgen_l)
+#define mm_sk_expand            MM_NS(mm_sk_expand)
+#define mm_sk_ntt               MM_NS(mm_sk_ntt)
+#define mm_encap                MM_NS(mm_encap)
+#define mm_encap_s              MM_NS(mm_encap_s)
+#define mm_encap_x              MM_NS(mm_encap_x)
+#define mm_encap_stream         MM_NS(mm_encap_stream)
+#define mm_encap_many           MM_NS(mm_encap_many)
+#define mm_decap                MM_NS(mm_decap)
+#define mm_decap_ntt            MM_NS(mm_decap_ntt)
+#define mm_enc                  MM_NS(mm_enc)
+#define mm_enc_s                MM_NS(mm_enc_s)
+#define mm_enc_x                MM_NS(mm_enc_x)
+#define mm_enc_l                MM_NS(mm_enc_l)
+#define mm_enc_stream           MM_NS(mm_enc_stream)
+#define mm_enc_many             MM_NS(mm_enc_many)
+#define mm_dec                  MM_NS(mm_dec)
+#define mm_dec_ntt              MM_NS(mm_dec_ntt)
+#define mm_dec_l                MM_NS(mm_dec_l)
+#define mm_pk_validate_batch    MM_NS(mm_pk_validate_batch)
+#define mm_ses_init             MM_NS(mm_ses_init)
+#define mm_ses_init_s           MM_NS(mm_ses_init_s)
+#define mm_ses_encap            MM_NS(mm_ses_encap)
+#define mm_ses_encap_x          MM_NS(mm_ses_encap_x)
+#define mm_ses_enc              MM_NS(mm_ses_enc)
+#define mm_ses_enc_x            MM_NS(mm_ses_enc_x)
+#define mm_ses_enc_l            MM_NS(mm_ses_enc_l)
+#define mm_ses_clear            MM_NS(mm_ses_clear)
+#define mm_dec_path             MM_NS(mm_dec_path)
+
+//  mm_sample.c
+#define poly_unif               MM_NS(poly_unif)
+#define poly_unif_x4            MM_NS(poly_unif_x4)
+#define poly_unif_mul_add_x4    MM_NS(poly_unif_mul_add_x4)
+#define sample_nu               MM_NS(sample_nu)
+#define poly_nu                 MM_NS(poly_nu)
+#define poly_gauss              MM_NS(poly_gauss)
+#define poly_gauss_x4           MM_NS(poly_gauss_x4)
+
+//  function table (mm_ops.h)
+#define mm_ops_par              MM_NS(mm_ops)
+
+#endif
@@ -2,6 +2,15 @@
 //  === Number Theoretic Trnsforms
 
 #include "mm_ring.h"
+#include "mm_serial.h"
+#include "mm_kern.h"
+
+//  straight-line transforms from gen_ntt.py; -DMM_NTT_LOOP for the loops
+#ifndef MM_NTT_LOOP
+#include "mm_ntt_gen.h"
+#endif
+
+#ifdef MM_NTT_LOOP
 
 //  === Roots of unity constants, multiplied with Montgomery factor R.
 
@@ -50,10 +59,19 @@ static const int32_t mm_w[MM_D] = {
     29285890,   9587262,    18068068,   16494188,   8860636,    9193484,
     24253081,   11613809,   32254537,   31413463    };
 
+#endif
+
 //  Forward NTT (negacyclic -- evaluate polynomial at factors of x^n+1).
 
-void polyr_fntt(int32_t *f)
+void MM_KN(polyr_fntt)(int32_t *f)
 {
+#ifndef MM_NTT_LOOP
+#ifdef __AVX2__
+    ntt_gen_fwd_x8(f);
+#else
+    ntt_gen_fwd(f);
+#endif
+#else
     int i, j, k;
     int32_t x, y, z;
     int32_t *p0, *p1, *p2;
@@ -78,12 +96,20 @@ void polyr_fntt(int32_t *f)
             p0 = p2;
         }
     }
+#endif
 }
 
 //  Reverse NTT (negacyclic -- x^n+1), normalize by 1/(n*r).
 
-void polyr_intt(int32_t *f)
+void MM_KN(polyr_intt)(int32_t *f)
 {
+#ifndef MM_NTT_LOOP
+#ifdef __AVX2__
+    ntt_gen_inv_x8(f);
+#else
+    ntt_gen_inv(f);
+#endif
+#else
     int i, j, k;
     int32_t x, y, z;
     int32_t *p0, *p1, *p2;
@@ -113,5 +139,157 @@ void polyr_intt(int32_t *f)
     for (i = 0; i < MM_D; i++) {
         f[i] = mont_cadd(mont_mulq(f[i], MONT_DI));
     }
+#endif
+}
+
+
+//  === Fused reverse NTT and ciphertext output, polyr_intt_ct() (mm_serial.h)
+
+#if !defined(MM_NTT_LOOP) && defined(__AVX2__)
+
+typedef struct {
+    uint8_t *ct, *k;
+    const int32_t *e;
+    const uint8_t *m;
+    int dx;
+} intt_ct_t;
+
+//  c + e (+ [q/2] * m bits) on coefficients 8k .. 8k+7
+
+static XINLINE __m256i intt_ct_in_x8(int k, __m256i x, const intt_ct_t *a)
+{
+    __m256i b;
+
+    x = _mm256_add_epi32(x, _mm256_loadu_si256((const __m256i *) a->e + k));
+    if (a->m != NULL) {
+        b = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        b = _mm256_cmpeq_epi32(_mm256_and_si256(
+                _mm256_set1_epi32(a->m[k]), b), b);
+        x = _mm256_add_epi32(x, _mm256_and_si256(b,
+                _mm256_set1_epi32((MM_Q + 1) / 2)));
+    }
+    return x;
+}
+
+//  poly_cmpr1(x, dx) in doubles: t = x * 2^dx + q/2 is exact (|t| < 2^38)
+//  and t * (1/q) is within 2^-39 of t/q; the 2^-30 bias is below the
+//  1/q gap to the next integer, so floor() gives the exact quotient.
+
+static XINLINE __m256i cmpr_x8(__m256i x, int dx)
+{
+    const __m256d s = _mm256_set1_pd((double) (1 << dx));
+    const __m256d h = _mm256_set1_pd((double) (MM_Q / 2l));
+    const __m256d qi = _mm256_set1_pd(1.0 / MM_Q);
+    const __m256d c = _mm256_set1_pd(0x1p-30);
+    __m256d lo, hi;
+
+    lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(x));
+    hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1));
+    lo = _mm256_floor_pd(_mm256_fmadd_pd(_mm256_fmadd_pd(lo, s, h), qi, c));
+    hi = _mm256_floor_pd(_mm256_fmadd_pd(_mm256_fmadd_pd(hi, s, h), qi, c));
+
+    return _mm256_setr_m128i(_mm256_cvtpd_epi32(lo), _mm256_cvtpd_epi32(hi));
+}
+
+//  8 coefficients of dx bits are dx bytes at offset k * dx
+
+static XINLINE void intt_ct_x8(int k, __m256i x, void *arg)
+{
+    const intt_ct_t *a = (const intt_ct_t *) arg;
+    uint32_t d[8];
+    uint64_t t;
+    uint8_t *b;
+    int i, l;
+
+    x = cmpr_x8(intt_ct_in_x8(k, x, a), a->dx);
+    x = _mm256_and_si256(x, _mm256_set1_epi32((1 << a->dx) - 1));
+    _mm256_storeu_si256((__m256i *) d, x);
+
+    b = a->ct + k * a->dx;
+    t = 0;
+    l = 0;
+    for (i = 0; i < 8; i++) {
+        t |= ((uint64_t) d[i]) << l;
+        l += a->dx;
+        while (l >= 8) {
+            *b++ = t & 0xFF;
+            t >>= 8;
+            l -= 8;
+        }
+    }
+}
+
+//  poly_gen_ct_k(): two bits of d >> (dx - 2) per coefficient (dx = du)
+
+static XINLINE void intt_ct_k_x8(int k, __m256i x, void *arg)
+{
+    const intt_ct_t *a = (const intt_ct_t *) arg;
+
+    x = cmpr_x8(intt_ct_in_x8(k, x, a), a->dx);
+    x = _mm256_sra_epi32(x, _mm_cvtsi32_si128(a->dx - 2));
+    a->ct[k] = _mm256_movemask_ps(_mm256_castsi256_ps(
+                    _mm256_slli_epi32(x, 31)));
+    x = _mm256_srai_epi32(_mm256_add_epi32(x, _mm256_set1_epi32(1)), 1);
+    a->k[k] = _mm256_movemask_ps(_mm256_castsi256_ps(
+                    _mm256_slli_epi32(x, 31)));
 }
 
+#endif
+
+size_t MM_KN(polyr_intt_ct)(uint8_t *ct, uint8_t *k, int32_t *f,
+                            const int32_t *e, const uint8_t *m, int dx)
+{
+#if !defined(MM_NTT_LOOP) && defined(__AVX2__)
+    intt_ct_t a = { ct, k, e, m, dx };
+
+    if (k != NULL) {
+        ntt_gen_inv_out_x8(f, intt_ct_k_x8, &a);
+        return MMKEM_CTI_SZ;
+    }
+    ntt_gen_inv_out_x8(f, intt_ct_x8, &a);
+    return (MM_D * dx) / 8;
+#else
+    int i, j, l;
+    int32_t x;
+    int64_t d, t;
+    uint8_t u, v;
+
+    MM_KN(polyr_intt)(f);
+
+    //  one pass: add, encode, round, pack
+    if (k != NULL) {
+        for (i = 0; i < MMKEM_CTI_SZ; i++) {
+            u = 0;
+            v = 0;
+            for (j = 0; j < 8; j++) {
+                d = poly_cmpr1(f[8 * i + j] + e[8 * i + j], dx);
+                d >>= dx - 2;
+                u |= (d & 1) << j;
+                v |= (((d + 1) >> 1) & 1) << j;
+            }
+            ct[i] = u;
+            k[i] = v;
+        }
+        return MMKEM_CTI_SZ;
+    }
+
+    t = 0;
+    l = 0;
+    j = 0;
+    for (i = 0; i < MM_D; i++) {
+        x = f[i] + e[i];
+        if (m != NULL) {
+            x += (-((m[i >> 3] >> (i & 7)) & 1)) & ((MM_Q + 1) / 2);
+        }
+        t |= (poly_cmpr1(x, dx) & ((1 << dx) - 1)) << l;
+        l += dx;
+        while (l >= 8) {
+            ct[j++] = t & 0xFF;
+            t >>= 8;
+            l -= 8;
+        }
+    }
+
+    return (size_t) j;
+#endif
+}
@@ -0,0 +1,4463 @@
+//  mm_ntt_gen.h
+//  === Straight-line NTT / INTT; generated by gen_ntt.py, do not edit.
+
+//  d = 256, q = 33550337, root h = 8433925
+//  generic C: radix 8-8-4;  AVX2: radix 8-4, then 4, 2, 1
+
+#ifndef _MM_NTT_GEN_H_
+#define _MM_NTT_GEN_H_
+
+#include "mm_ring.h"
+
+#if MM_D != 256 || MM_Q != 33550337l || \
+    MONT_QI != 16773119l || MONT_DI != 33157153l
+#error "mm_ntt_gen.h: regenerate with gen_ntt.py for these parameters"
+#endif
+
+//  Forward NTT, as polyr_fntt().
+
+static inline void ntt_gen_fwd(int32_t *f)
+{
+    int32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    int32_t y;
+
+    x0 = f[0];  x1 = f[32];  x2 = f[64];  x3 = f[96];
+    x4 = f[128];  x5 = f[160];  x6 = f[192];  x7 = f[224];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[0] = x0;  f[32] = x1;  f[64] = x2;  f[96] = x3;
+    f[128] = x4;  f[160] = x5;  f[192] = x6;  f[224] = x7;
+    x0 = f[1];  x1 = f[33];  x2 = f[65];  x3 = f[97];
+    x4 = f[129];  x5 = f[161];  x6 = f[193];  x7 = f[225];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[1] = x0;  f[33] = x1;  f[65] = x2;  f[97] = x3;
+    f[129] = x4;  f[161] = x5;  f[193] = x6;  f[225] = x7;
+    x0 = f[2];  x1 = f[34];  x2 = f[66];  x3 = f[98];
+    x4 = f[130];  x5 = f[162];  x6 = f[194];  x7 = f[226];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[2] = x0;  f[34] = x1;  f[66] = x2;  f[98] = x3;
+    f[130] = x4;  f[162] = x5;  f[194] = x6;  f[226] = x7;
+    x0 = f[3];  x1 = f[35];  x2 = f[67];  x3 = f[99];
+    x4 = f[131];  x5 = f[163];  x6 = f[195];  x7 = f[227];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[3] = x0;  f[35] = x1;  f[67] = x2;  f[99] = x3;
+    f[131] = x4;  f[163] = x5;  f[195] = x6;  f[227] = x7;
+    x0 = f[4];  x1 = f[36];  x2 = f[68];  x3 = f[100];
+    x4 = f[132];  x5 = f[164];  x6 = f[196];  x7 = f[228];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[4] = x0;  f[36] = x1;  f[68] = x2;  f[100] = x3;
+    f[132] = x4;  f[164] = x5;  f[196] = x6;  f[228] = x7;
+    x0 = f[5];  x1 = f[37];  x2 = f[69];  x3 = f[101];
+    x4 = f[133];  x5 = f[165];  x6 = f[197];  x7 = f[229];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[5] = x0;  f[37] = x1;  f[69] = x2;  f[101] = x3;
+    f[133] = x4;  f[165] = x5;  f[197] = x6;  f[229] = x7;
+    x0 = f[6];  x1 = f[38];  x2 = f[70];  x3 = f[102];
+    x4 = f[134];  x5 = f[166];  x6 = f[198];  x7 = f[230];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[6] = x0;  f[38] = x1;  f[70] = x2;  f[102] = x3;
+    f[134] = x4;  f[166] = x5;  f[198] = x6;  f[230] = x7;
+    x0 = f[7];  x1 = f[39];  x2 = f[71];  x3 = f[103];
+    x4 = f[135];  x5 = f[167];  x6 = f[199];  x7 = f[231];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[7] = x0;  f[39] = x1;  f[71] = x2;  f[103] = x3;
+    f[135] = x4;  f[167] = x5;  f[199] = x6;  f[231] = x7;
+    x0 = f[8];  x1 = f[40];  x2 = f[72];  x3 = f[104];
+    x4 = f[136];  x5 = f[168];  x6 = f[200];  x7 = f[232];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[8] = x0;  f[40] = x1;  f[72] = x2;  f[104] = x3;
+    f[136] = x4;  f[168] = x5;  f[200] = x6;  f[232] = x7;
+    x0 = f[9];  x1 = f[41];  x2 = f[73];  x3 = f[105];
+    x4 = f[137];  x5 = f[169];  x6 = f[201];  x7 = f[233];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[9] = x0;  f[41] = x1;  f[73] = x2;  f[105] = x3;
+    f[137] = x4;  f[169] = x5;  f[201] = x6;  f[233] = x7;
+    x0 = f[10];  x1 = f[42];  x2 = f[74];  x3 = f[106];
+    x4 = f[138];  x5 = f[170];  x6 = f[202];  x7 = f[234];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[10] = x0;  f[42] = x1;  f[74] = x2;  f[106] = x3;
+    f[138] = x4;  f[170] = x5;  f[202] = x6;  f[234] = x7;
+    x0 = f[11];  x1 = f[43];  x2 = f[75];  x3 = f[107];
+    x4 = f[139];  x5 = f[171];  x6 = f[203];  x7 = f[235];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[11] = x0;  f[43] = x1;  f[75] = x2;  f[107] = x3;
+    f[139] = x4;  f[171] = x5;  f[203] = x6;  f[235] = x7;
+    x0 = f[12];  x1 = f[44];  x2 = f[76];  x3 = f[108];
+    x4 = f[140];  x5 = f[172];  x6 = f[204];  x7 = f[236];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[12] = x0;  f[44] = x1;  f[76] = x2;  f[108] = x3;
+    f[140] = x4;  f[172] = x5;  f[204] = x6;  f[236] = x7;
+    x0 = f[13];  x1 = f[45];  x2 = f[77];  x3 = f[109];
+    x4 = f[141];  x5 = f[173];  x6 = f[205];  x7 = f[237];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[13] = x0;  f[45] = x1;  f[77] = x2;  f[109] = x3;
+    f[141] = x4;  f[173] = x5;  f[205] = x6;  f[237] = x7;
+    x0 = f[14];  x1 = f[46];  x2 = f[78];  x3 = f[110];
+    x4 = f[142];  x5 = f[174];  x6 = f[206];  x7 = f[238];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[14] = x0;  f[46] = x1;  f[78] = x2;  f[110] = x3;
+    f[142] = x4;  f[174] = x5;  f[206] = x6;  f[238] = x7;
+    x0 = f[15];  x1 = f[47];  x2 = f[79];  x3 = f[111];
+    x4 = f[143];  x5 = f[175];  x6 = f[207];  x7 = f[239];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[15] = x0;  f[47] = x1;  f[79] = x2;  f[111] = x3;
+    f[143] = x4;  f[175] = x5;  f[207] = x6;  f[239] = x7;
+    x0 = f[16];  x1 = f[48];  x2 = f[80];  x3 = f[112];
+    x4 = f[144];  x5 = f[176];  x6 = f[208];  x7 = f[240];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[16] = x0;  f[48] = x1;  f[80] = x2;  f[112] = x3;
+    f[144] = x4;  f[176] = x5;  f[208] = x6;  f[240] = x7;
+    x0 = f[17];  x1 = f[49];  x2 = f[81];  x3 = f[113];
+    x4 = f[145];  x5 = f[177];  x6 = f[209];  x7 = f[241];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[17] = x0;  f[49] = x1;  f[81] = x2;  f[113] = x3;
+    f[145] = x4;  f[177] = x5;  f[209] = x6;  f[241] = x7;
+    x0 = f[18];  x1 = f[50];  x2 = f[82];  x3 = f[114];
+    x4 = f[146];  x5 = f[178];  x6 = f[210];  x7 = f[242];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[18] = x0;  f[50] = x1;  f[82] = x2;  f[114] = x3;
+    f[146] = x4;  f[178] = x5;  f[210] = x6;  f[242] = x7;
+    x0 = f[19];  x1 = f[51];  x2 = f[83];  x3 = f[115];
+    x4 = f[147];  x5 = f[179];  x6 = f[211];  x7 = f[243];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[19] = x0;  f[51] = x1;  f[83] = x2;  f[115] = x3;
+    f[147] = x4;  f[179] = x5;  f[211] = x6;  f[243] = x7;
+    x0 = f[20];  x1 = f[52];  x2 = f[84];  x3 = f[116];
+    x4 = f[148];  x5 = f[180];  x6 = f[212];  x7 = f[244];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[20] = x0;  f[52] = x1;  f[84] = x2;  f[116] = x3;
+    f[148] = x4;  f[180] = x5;  f[212] = x6;  f[244] = x7;
+    x0 = f[21];  x1 = f[53];  x2 = f[85];  x3 = f[117];
+    x4 = f[149];  x5 = f[181];  x6 = f[213];  x7 = f[245];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[21] = x0;  f[53] = x1;  f[85] = x2;  f[117] = x3;
+    f[149] = x4;  f[181] = x5;  f[213] = x6;  f[245] = x7;
+    x0 = f[22];  x1 = f[54];  x2 = f[86];  x3 = f[118];
+    x4 = f[150];  x5 = f[182];  x6 = f[214];  x7 = f[246];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[22] = x0;  f[54] = x1;  f[86] = x2;  f[118] = x3;
+    f[150] = x4;  f[182] = x5;  f[214] = x6;  f[246] = x7;
+    x0 = f[23];  x1 = f[55];  x2 = f[87];  x3 = f[119];
+    x4 = f[151];  x5 = f[183];  x6 = f[215];  x7 = f[247];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[23] = x0;  f[55] = x1;  f[87] = x2;  f[119] = x3;
+    f[151] = x4;  f[183] = x5;  f[215] = x6;  f[247] = x7;
+    x0 = f[24];  x1 = f[56];  x2 = f[88];  x3 = f[120];
+    x4 = f[152];  x5 = f[184];  x6 = f[216];  x7 = f[248];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[24] = x0;  f[56] = x1;  f[88] = x2;  f[120] = x3;
+    f[152] = x4;  f[184] = x5;  f[216] = x6;  f[248] = x7;
+    x0 = f[25];  x1 = f[57];  x2 = f[89];  x3 = f[121];
+    x4 = f[153];  x5 = f[185];  x6 = f[217];  x7 = f[249];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[25] = x0;  f[57] = x1;  f[89] = x2;  f[121] = x3;
+    f[153] = x4;  f[185] = x5;  f[217] = x6;  f[249] = x7;
+    x0 = f[26];  x1 = f[58];  x2 = f[90];  x3 = f[122];
+    x4 = f[154];  x5 = f[186];  x6 = f[218];  x7 = f[250];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[26] = x0;  f[58] = x1;  f[90] = x2;  f[122] = x3;
+    f[154] = x4;  f[186] = x5;  f[218] = x6;  f[250] = x7;
+    x0 = f[27];  x1 = f[59];  x2 = f[91];  x3 = f[123];
+    x4 = f[155];  x5 = f[187];  x6 = f[219];  x7 = f[251];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[27] = x0;  f[59] = x1;  f[91] = x2;  f[123] = x3;
+    f[155] = x4;  f[187] = x5;  f[219] = x6;  f[251] = x7;
+    x0 = f[28];  x1 = f[60];  x2 = f[92];  x3 = f[124];
+    x4 = f[156];  x5 = f[188];  x6 = f[220];  x7 = f[252];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[28] = x0;  f[60] = x1;  f[92] = x2;  f[124] = x3;
+    f[156] = x4;  f[188] = x5;  f[220] = x6;  f[252] = x7;
+    x0 = f[29];  x1 = f[61];  x2 = f[93];  x3 = f[125];
+    x4 = f[157];  x5 = f[189];  x6 = f[221];  x7 = f[253];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[29] = x0;  f[61] = x1;  f[93] = x2;  f[125] = x3;
+    f[157] = x4;  f[189] = x5;  f[221] = x6;  f[253] = x7;
+    x0 = f[30];  x1 = f[62];  x2 = f[94];  x3 = f[126];
+    x4 = f[158];  x5 = f[190];  x6 = f[222];  x7 = f[254];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[30] = x0;  f[62] = x1;  f[94] = x2;  f[126] = x3;
+    f[158] = x4;  f[190] = x5;  f[222] = x6;  f[254] = x7;
+    x0 = f[31];  x1 = f[63];  x2 = f[95];  x3 = f[127];
+    x4 = f[159];  x5 = f[191];  x6 = f[223];  x7 = f[255];
+    y = mont_mulq(x4, 6759380);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6759380);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6759380);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6759380);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11611772);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11611772);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 20051184);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20051184);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 5611999);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9265027);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 19493511);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 10764447);  x7 = x6 - y;  x6 = x6 + y;
+    f[31] = x0;  f[63] = x1;  f[95] = x2;  f[127] = x3;
+    f[159] = x4;  f[191] = x5;  f[223] = x6;  f[255] = x7;
+    x0 = f[0];  x1 = f[4];  x2 = f[8];  x3 = f[12];
+    x4 = f[16];  x5 = f[20];  x6 = f[24];  x7 = f[28];
+    y = mont_mulq(x4, 24000204);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24000204);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24000204);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24000204);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28206570);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28206570);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 15280732);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 15280732);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 3925647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22891714);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 32084204);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20016426);  x7 = x6 - y;  x6 = x6 + y;
+    f[0] = x0;  f[4] = x1;  f[8] = x2;  f[12] = x3;
+    f[16] = x4;  f[20] = x5;  f[24] = x6;  f[28] = x7;
+    x0 = f[1];  x1 = f[5];  x2 = f[9];  x3 = f[13];
+    x4 = f[17];  x5 = f[21];  x6 = f[25];  x7 = f[29];
+    y = mont_mulq(x4, 24000204);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24000204);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24000204);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24000204);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28206570);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28206570);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 15280732);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 15280732);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 3925647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22891714);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 32084204);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20016426);  x7 = x6 - y;  x6 = x6 + y;
+    f[1] = x0;  f[5] = x1;  f[9] = x2;  f[13] = x3;
+    f[17] = x4;  f[21] = x5;  f[25] = x6;  f[29] = x7;
+    x0 = f[2];  x1 = f[6];  x2 = f[10];  x3 = f[14];
+    x4 = f[18];  x5 = f[22];  x6 = f[26];  x7 = f[30];
+    y = mont_mulq(x4, 24000204);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24000204);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24000204);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24000204);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28206570);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28206570);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 15280732);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 15280732);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 3925647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22891714);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 32084204);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20016426);  x7 = x6 - y;  x6 = x6 + y;
+    f[2] = x0;  f[6] = x1;  f[10] = x2;  f[14] = x3;
+    f[18] = x4;  f[22] = x5;  f[26] = x6;  f[30] = x7;
+    x0 = f[3];  x1 = f[7];  x2 = f[11];  x3 = f[15];
+    x4 = f[19];  x5 = f[23];  x6 = f[27];  x7 = f[31];
+    y = mont_mulq(x4, 24000204);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24000204);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24000204);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24000204);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28206570);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28206570);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 15280732);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 15280732);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 3925647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22891714);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 32084204);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 20016426);  x7 = x6 - y;  x6 = x6 + y;
+    f[3] = x0;  f[7] = x1;  f[11] = x2;  f[15] = x3;
+    f[19] = x4;  f[23] = x5;  f[27] = x6;  f[31] = x7;
+    x0 = f[32];  x1 = f[36];  x2 = f[40];  x3 = f[44];
+    x4 = f[48];  x5 = f[52];  x6 = f[56];  x7 = f[60];
+    y = mont_mulq(x4, 6177812);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6177812);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6177812);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6177812);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 17354707);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 17354707);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 12498775);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12498775);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 19793647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9217272);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 18447657);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 25090164);  x7 = x6 - y;  x6 = x6 + y;
+    f[32] = x0;  f[36] = x1;  f[40] = x2;  f[44] = x3;
+    f[48] = x4;  f[52] = x5;  f[56] = x6;  f[60] = x7;
+    x0 = f[33];  x1 = f[37];  x2 = f[41];  x3 = f[45];
+    x4 = f[49];  x5 = f[53];  x6 = f[57];  x7 = f[61];
+    y = mont_mulq(x4, 6177812);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6177812);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6177812);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6177812);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 17354707);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 17354707);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 12498775);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12498775);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 19793647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9217272);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 18447657);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 25090164);  x7 = x6 - y;  x6 = x6 + y;
+    f[33] = x0;  f[37] = x1;  f[41] = x2;  f[45] = x3;
+    f[49] = x4;  f[53] = x5;  f[57] = x6;  f[61] = x7;
+    x0 = f[34];  x1 = f[38];  x2 = f[42];  x3 = f[46];
+    x4 = f[50];  x5 = f[54];  x6 = f[58];  x7 = f[62];
+    y = mont_mulq(x4, 6177812);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6177812);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6177812);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6177812);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 17354707);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 17354707);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 12498775);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12498775);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 19793647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9217272);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 18447657);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 25090164);  x7 = x6 - y;  x6 = x6 + y;
+    f[34] = x0;  f[38] = x1;  f[42] = x2;  f[46] = x3;
+    f[50] = x4;  f[54] = x5;  f[58] = x6;  f[62] = x7;
+    x0 = f[35];  x1 = f[39];  x2 = f[43];  x3 = f[47];
+    x4 = f[51];  x5 = f[55];  x6 = f[59];  x7 = f[63];
+    y = mont_mulq(x4, 6177812);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 6177812);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 6177812);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 6177812);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 17354707);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 17354707);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 12498775);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12498775);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 19793647);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9217272);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 18447657);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 25090164);  x7 = x6 - y;  x6 = x6 + y;
+    f[35] = x0;  f[39] = x1;  f[43] = x2;  f[47] = x3;
+    f[51] = x4;  f[55] = x5;  f[59] = x6;  f[63] = x7;
+    x0 = f[64];  x1 = f[68];  x2 = f[72];  x3 = f[76];
+    x4 = f[80];  x5 = f[84];  x6 = f[88];  x7 = f[92];
+    y = mont_mulq(x4, 32900457);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32900457);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32900457);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32900457);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 18285219);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18285219);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 30499698);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 30499698);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17182522);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23808311);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 16908244);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 22122426);  x7 = x6 - y;  x6 = x6 + y;
+    f[64] = x0;  f[68] = x1;  f[72] = x2;  f[76] = x3;
+    f[80] = x4;  f[84] = x5;  f[88] = x6;  f[92] = x7;
+    x0 = f[65];  x1 = f[69];  x2 = f[73];  x3 = f[77];
+    x4 = f[81];  x5 = f[85];  x6 = f[89];  x7 = f[93];
+    y = mont_mulq(x4, 32900457);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32900457);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32900457);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32900457);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 18285219);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18285219);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 30499698);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 30499698);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17182522);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23808311);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 16908244);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 22122426);  x7 = x6 - y;  x6 = x6 + y;
+    f[65] = x0;  f[69] = x1;  f[73] = x2;  f[77] = x3;
+    f[81] = x4;  f[85] = x5;  f[89] = x6;  f[93] = x7;
+    x0 = f[66];  x1 = f[70];  x2 = f[74];  x3 = f[78];
+    x4 = f[82];  x5 = f[86];  x6 = f[90];  x7 = f[94];
+    y = mont_mulq(x4, 32900457);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32900457);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32900457);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32900457);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 18285219);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18285219);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 30499698);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 30499698);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17182522);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23808311);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 16908244);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 22122426);  x7 = x6 - y;  x6 = x6 + y;
+    f[66] = x0;  f[70] = x1;  f[74] = x2;  f[78] = x3;
+    f[82] = x4;  f[86] = x5;  f[90] = x6;  f[94] = x7;
+    x0 = f[67];  x1 = f[71];  x2 = f[75];  x3 = f[79];
+    x4 = f[83];  x5 = f[87];  x6 = f[91];  x7 = f[95];
+    y = mont_mulq(x4, 32900457);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32900457);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32900457);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32900457);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 18285219);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18285219);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 30499698);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 30499698);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17182522);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23808311);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 16908244);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 22122426);  x7 = x6 - y;  x6 = x6 + y;
+    f[67] = x0;  f[71] = x1;  f[75] = x2;  f[79] = x3;
+    f[83] = x4;  f[87] = x5;  f[91] = x6;  f[95] = x7;
+    x0 = f[96];  x1 = f[100];  x2 = f[104];  x3 = f[108];
+    x4 = f[112];  x5 = f[116];  x6 = f[120];  x7 = f[124];
+    y = mont_mulq(x4, 32410281);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32410281);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32410281);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32410281);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 12450192);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 12450192);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 5644069);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 5644069);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17558876);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22883012);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6983968);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24272961);  x7 = x6 - y;  x6 = x6 + y;
+    f[96] = x0;  f[100] = x1;  f[104] = x2;  f[108] = x3;
+    f[112] = x4;  f[116] = x5;  f[120] = x6;  f[124] = x7;
+    x0 = f[97];  x1 = f[101];  x2 = f[105];  x3 = f[109];
+    x4 = f[113];  x5 = f[117];  x6 = f[121];  x7 = f[125];
+    y = mont_mulq(x4, 32410281);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32410281);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32410281);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32410281);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 12450192);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 12450192);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 5644069);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 5644069);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17558876);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22883012);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6983968);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24272961);  x7 = x6 - y;  x6 = x6 + y;
+    f[97] = x0;  f[101] = x1;  f[105] = x2;  f[109] = x3;
+    f[113] = x4;  f[117] = x5;  f[121] = x6;  f[125] = x7;
+    x0 = f[98];  x1 = f[102];  x2 = f[106];  x3 = f[110];
+    x4 = f[114];  x5 = f[118];  x6 = f[122];  x7 = f[126];
+    y = mont_mulq(x4, 32410281);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32410281);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32410281);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32410281);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 12450192);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 12450192);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 5644069);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 5644069);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17558876);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22883012);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6983968);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24272961);  x7 = x6 - y;  x6 = x6 + y;
+    f[98] = x0;  f[102] = x1;  f[106] = x2;  f[110] = x3;
+    f[114] = x4;  f[118] = x5;  f[122] = x6;  f[126] = x7;
+    x0 = f[99];  x1 = f[103];  x2 = f[107];  x3 = f[111];
+    x4 = f[115];  x5 = f[119];  x6 = f[123];  x7 = f[127];
+    y = mont_mulq(x4, 32410281);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 32410281);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32410281);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 32410281);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 12450192);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 12450192);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 5644069);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 5644069);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 17558876);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22883012);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6983968);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24272961);  x7 = x6 - y;  x6 = x6 + y;
+    f[99] = x0;  f[103] = x1;  f[107] = x2;  f[111] = x3;
+    f[115] = x4;  f[119] = x5;  f[123] = x6;  f[127] = x7;
+    x0 = f[128];  x1 = f[132];  x2 = f[136];  x3 = f[140];
+    x4 = f[144];  x5 = f[148];  x6 = f[152];  x7 = f[156];
+    y = mont_mulq(x4, 23400652);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 23400652);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 23400652);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 23400652);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11930096);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11930096);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 17535208);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 17535208);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 875322);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18546326);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6067746);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24580770);  x7 = x6 - y;  x6 = x6 + y;
+    f[128] = x0;  f[132] = x1;  f[136] = x2;  f[140] = x3;
+    f[144] = x4;  f[148] = x5;  f[152] = x6;  f[156] = x7;
+    x0 = f[129];  x1 = f[133];  x2 = f[137];  x3 = f[141];
+    x4 = f[145];  x5 = f[149];  x6 = f[153];  x7 = f[157];
+    y = mont_mulq(x4, 23400652);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 23400652);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 23400652);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 23400652);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11930096);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11930096);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 17535208);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 17535208);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 875322);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18546326);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6067746);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24580770);  x7 = x6 - y;  x6 = x6 + y;
+    f[129] = x0;  f[133] = x1;  f[137] = x2;  f[141] = x3;
+    f[145] = x4;  f[149] = x5;  f[153] = x6;  f[157] = x7;
+    x0 = f[130];  x1 = f[134];  x2 = f[138];  x3 = f[142];
+    x4 = f[146];  x5 = f[150];  x6 = f[154];  x7 = f[158];
+    y = mont_mulq(x4, 23400652);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 23400652);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 23400652);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 23400652);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11930096);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11930096);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 17535208);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 17535208);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 875322);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18546326);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6067746);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24580770);  x7 = x6 - y;  x6 = x6 + y;
+    f[130] = x0;  f[134] = x1;  f[138] = x2;  f[142] = x3;
+    f[146] = x4;  f[150] = x5;  f[154] = x6;  f[158] = x7;
+    x0 = f[131];  x1 = f[135];  x2 = f[139];  x3 = f[143];
+    x4 = f[147];  x5 = f[151];  x6 = f[155];  x7 = f[159];
+    y = mont_mulq(x4, 23400652);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 23400652);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 23400652);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 23400652);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 11930096);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11930096);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 17535208);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 17535208);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 875322);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18546326);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 6067746);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 24580770);  x7 = x6 - y;  x6 = x6 + y;
+    f[131] = x0;  f[135] = x1;  f[139] = x2;  f[143] = x3;
+    f[147] = x4;  f[151] = x5;  f[155] = x6;  f[159] = x7;
+    x0 = f[160];  x1 = f[164];  x2 = f[168];  x3 = f[172];
+    x4 = f[176];  x5 = f[180];  x6 = f[184];  x7 = f[188];
+    y = mont_mulq(x4, 3198144);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 3198144);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 3198144);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 3198144);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 32021213);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 32021213);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 28870577);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 28870577);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 18170667);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10496054);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 15608693);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2515533);  x7 = x6 - y;  x6 = x6 + y;
+    f[160] = x0;  f[164] = x1;  f[168] = x2;  f[172] = x3;
+    f[176] = x4;  f[180] = x5;  f[184] = x6;  f[188] = x7;
+    x0 = f[161];  x1 = f[165];  x2 = f[169];  x3 = f[173];
+    x4 = f[177];  x5 = f[181];  x6 = f[185];  x7 = f[189];
+    y = mont_mulq(x4, 3198144);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 3198144);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 3198144);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 3198144);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 32021213);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 32021213);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 28870577);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 28870577);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 18170667);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10496054);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 15608693);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2515533);  x7 = x6 - y;  x6 = x6 + y;
+    f[161] = x0;  f[165] = x1;  f[169] = x2;  f[173] = x3;
+    f[177] = x4;  f[181] = x5;  f[185] = x6;  f[189] = x7;
+    x0 = f[162];  x1 = f[166];  x2 = f[170];  x3 = f[174];
+    x4 = f[178];  x5 = f[182];  x6 = f[186];  x7 = f[190];
+    y = mont_mulq(x4, 3198144);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 3198144);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 3198144);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 3198144);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 32021213);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 32021213);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 28870577);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 28870577);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 18170667);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10496054);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 15608693);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2515533);  x7 = x6 - y;  x6 = x6 + y;
+    f[162] = x0;  f[166] = x1;  f[170] = x2;  f[174] = x3;
+    f[178] = x4;  f[182] = x5;  f[186] = x6;  f[190] = x7;
+    x0 = f[163];  x1 = f[167];  x2 = f[171];  x3 = f[175];
+    x4 = f[179];  x5 = f[183];  x6 = f[187];  x7 = f[191];
+    y = mont_mulq(x4, 3198144);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 3198144);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 3198144);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 3198144);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 32021213);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 32021213);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 28870577);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 28870577);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 18170667);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10496054);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 15608693);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2515533);  x7 = x6 - y;  x6 = x6 + y;
+    f[163] = x0;  f[167] = x1;  f[171] = x2;  f[175] = x3;
+    f[179] = x4;  f[183] = x5;  f[187] = x6;  f[191] = x7;
+    x0 = f[192];  x1 = f[196];  x2 = f[200];  x3 = f[204];
+    x4 = f[208];  x5 = f[212];  x6 = f[216];  x7 = f[220];
+    y = mont_mulq(x4, 2200199);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 2200199);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 2200199);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 2200199);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 16657861);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16657861);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32738467);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 32738467);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 44602);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10865068);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 23754885);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12096975);  x7 = x6 - y;  x6 = x6 + y;
+    f[192] = x0;  f[196] = x1;  f[200] = x2;  f[204] = x3;
+    f[208] = x4;  f[212] = x5;  f[216] = x6;  f[220] = x7;
+    x0 = f[193];  x1 = f[197];  x2 = f[201];  x3 = f[205];
+    x4 = f[209];  x5 = f[213];  x6 = f[217];  x7 = f[221];
+    y = mont_mulq(x4, 2200199);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 2200199);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 2200199);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 2200199);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 16657861);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16657861);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32738467);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 32738467);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 44602);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10865068);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 23754885);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12096975);  x7 = x6 - y;  x6 = x6 + y;
+    f[193] = x0;  f[197] = x1;  f[201] = x2;  f[205] = x3;
+    f[209] = x4;  f[213] = x5;  f[217] = x6;  f[221] = x7;
+    x0 = f[194];  x1 = f[198];  x2 = f[202];  x3 = f[206];
+    x4 = f[210];  x5 = f[214];  x6 = f[218];  x7 = f[222];
+    y = mont_mulq(x4, 2200199);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 2200199);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 2200199);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 2200199);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 16657861);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16657861);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32738467);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 32738467);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 44602);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10865068);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 23754885);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12096975);  x7 = x6 - y;  x6 = x6 + y;
+    f[194] = x0;  f[198] = x1;  f[202] = x2;  f[206] = x3;
+    f[210] = x4;  f[214] = x5;  f[218] = x6;  f[222] = x7;
+    x0 = f[195];  x1 = f[199];  x2 = f[203];  x3 = f[207];
+    x4 = f[211];  x5 = f[215];  x6 = f[219];  x7 = f[223];
+    y = mont_mulq(x4, 2200199);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 2200199);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 2200199);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 2200199);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 16657861);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16657861);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 32738467);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 32738467);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 44602);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10865068);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 23754885);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 12096975);  x7 = x6 - y;  x6 = x6 + y;
+    f[195] = x0;  f[199] = x1;  f[203] = x2;  f[207] = x3;
+    f[211] = x4;  f[215] = x5;  f[219] = x6;  f[223] = x7;
+    x0 = f[224];  x1 = f[228];  x2 = f[232];  x3 = f[236];
+    x4 = f[240];  x5 = f[244];  x6 = f[248];  x7 = f[252];
+    y = mont_mulq(x4, 24124141);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24124141);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24124141);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24124141);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28138468);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28138468);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 33049270);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 33049270);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 16076627);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9986178);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 14086122);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2292012);  x7 = x6 - y;  x6 = x6 + y;
+    f[224] = x0;  f[228] = x1;  f[232] = x2;  f[236] = x3;
+    f[240] = x4;  f[244] = x5;  f[248] = x6;  f[252] = x7;
+    x0 = f[225];  x1 = f[229];  x2 = f[233];  x3 = f[237];
+    x4 = f[241];  x5 = f[245];  x6 = f[249];  x7 = f[253];
+    y = mont_mulq(x4, 24124141);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24124141);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24124141);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24124141);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28138468);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28138468);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 33049270);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 33049270);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 16076627);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9986178);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 14086122);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2292012);  x7 = x6 - y;  x6 = x6 + y;
+    f[225] = x0;  f[229] = x1;  f[233] = x2;  f[237] = x3;
+    f[241] = x4;  f[245] = x5;  f[249] = x6;  f[253] = x7;
+    x0 = f[226];  x1 = f[230];  x2 = f[234];  x3 = f[238];
+    x4 = f[242];  x5 = f[246];  x6 = f[250];  x7 = f[254];
+    y = mont_mulq(x4, 24124141);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24124141);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24124141);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24124141);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28138468);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28138468);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 33049270);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 33049270);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 16076627);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9986178);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 14086122);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2292012);  x7 = x6 - y;  x6 = x6 + y;
+    f[226] = x0;  f[230] = x1;  f[234] = x2;  f[238] = x3;
+    f[242] = x4;  f[246] = x5;  f[250] = x6;  f[254] = x7;
+    x0 = f[227];  x1 = f[231];  x2 = f[235];  x3 = f[239];
+    x4 = f[243];  x5 = f[247];  x6 = f[251];  x7 = f[255];
+    y = mont_mulq(x4, 24124141);  x4 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x5, 24124141);  x5 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 24124141);  x6 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x7, 24124141);  x7 = x3 - y;  x3 = x3 + y;
+    y = mont_mulq(x2, 28138468);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28138468);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x6, 33049270);  x6 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 33049270);  x7 = x5 - y;  x5 = x5 + y;
+    y = mont_mulq(x1, 16076627);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9986178);  x3 = x2 - y;  x2 = x2 + y;
+    y = mont_mulq(x5, 14086122);  x5 = x4 - y;  x4 = x4 + y;
+    y = mont_mulq(x7, 2292012);  x7 = x6 - y;  x6 = x6 + y;
+    f[227] = x0;  f[231] = x1;  f[235] = x2;  f[239] = x3;
+    f[243] = x4;  f[247] = x5;  f[251] = x6;  f[255] = x7;
+    x0 = f[0];  x1 = f[1];  x2 = f[2];  x3 = f[3];
+    y = mont_mulq(x2, 29787612);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 29787612);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 33073869);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 8792503);  x3 = x2 - y;  x2 = x2 + y;
+    f[0] = x0;  f[1] = x1;  f[2] = x2;  f[3] = x3;
+    x0 = f[4];  x1 = f[5];  x2 = f[6];  x3 = f[7];
+    y = mont_mulq(x2, 7503285);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 7503285);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 17918503);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10321733);  x3 = x2 - y;  x2 = x2 + y;
+    f[4] = x0;  f[5] = x1;  f[6] = x2;  f[7] = x3;
+    x0 = f[8];  x1 = f[9];  x2 = f[10];  x3 = f[11];
+    y = mont_mulq(x2, 11189900);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11189900);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 7192988);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 29800114);  x3 = x2 - y;  x2 = x2 + y;
+    f[8] = x0;  f[9] = x1;  f[10] = x2;  f[11] = x3;
+    x0 = f[12];  x1 = f[13];  x2 = f[14];  x3 = f[15];
+    y = mont_mulq(x2, 31631832);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 31631832);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 26258901);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 31299552);  x3 = x2 - y;  x2 = x2 + y;
+    f[12] = x0;  f[13] = x1;  f[14] = x2;  f[15] = x3;
+    x0 = f[16];  x1 = f[17];  x2 = f[18];  x3 = f[19];
+    y = mont_mulq(x2, 5860566);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5860566);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 27332300);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 32966155);  x3 = x2 - y;  x2 = x2 + y;
+    f[16] = x0;  f[17] = x1;  f[18] = x2;  f[19] = x3;
+    x0 = f[20];  x1 = f[21];  x2 = f[22];  x3 = f[23];
+    y = mont_mulq(x2, 10986757);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10986757);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 12276016);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10730693);  x3 = x2 - y;  x2 = x2 + y;
+    f[20] = x0;  f[21] = x1;  f[22] = x2;  f[23] = x3;
+    x0 = f[24];  x1 = f[25];  x2 = f[26];  x3 = f[27];
+    y = mont_mulq(x2, 28381447);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28381447);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 23321992);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 12553039);  x3 = x2 - y;  x2 = x2 + y;
+    f[24] = x0;  f[25] = x1;  f[26] = x2;  f[27] = x3;
+    x0 = f[28];  x1 = f[29];  x2 = f[30];  x3 = f[31];
+    y = mont_mulq(x2, 30095497);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 30095497);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 24560419);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 8395453);  x3 = x2 - y;  x2 = x2 + y;
+    f[28] = x0;  f[29] = x1;  f[30] = x2;  f[31] = x3;
+    x0 = f[32];  x1 = f[33];  x2 = f[34];  x3 = f[35];
+    y = mont_mulq(x2, 6958801);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 6958801);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 9254376);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 7168707);  x3 = x2 - y;  x2 = x2 + y;
+    f[32] = x0;  f[33] = x1;  f[34] = x2;  f[35] = x3;
+    x0 = f[36];  x1 = f[37];  x2 = f[38];  x3 = f[39];
+    y = mont_mulq(x2, 20465111);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 20465111);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 20172936);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 14752366);  x3 = x2 - y;  x2 = x2 + y;
+    f[36] = x0;  f[37] = x1;  f[38] = x2;  f[39] = x3;
+    x0 = f[40];  x1 = f[41];  x2 = f[42];  x3 = f[43];
+    y = mont_mulq(x2, 274280);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 274280);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 28613855);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 20608463);  x3 = x2 - y;  x2 = x2 + y;
+    f[40] = x0;  f[41] = x1;  f[42] = x2;  f[43] = x3;
+    x0 = f[44];  x1 = f[45];  x2 = f[46];  x3 = f[47];
+    y = mont_mulq(x2, 27204547);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 27204547);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 19639872);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 350844);  x3 = x2 - y;  x2 = x2 + y;
+    f[44] = x0;  f[45] = x1;  f[46] = x2;  f[47] = x3;
+    x0 = f[48];  x1 = f[49];  x2 = f[50];  x3 = f[51];
+    y = mont_mulq(x2, 1594993);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 1594993);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 7143126);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5527986);  x3 = x2 - y;  x2 = x2 + y;
+    f[48] = x0;  f[49] = x1;  f[50] = x2;  f[51] = x3;
+    x0 = f[52];  x1 = f[53];  x2 = f[54];  x3 = f[55];
+    y = mont_mulq(x2, 13111549);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 13111549);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 31109078);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5790148);  x3 = x2 - y;  x2 = x2 + y;
+    f[52] = x0;  f[53] = x1;  f[54] = x2;  f[55] = x3;
+    x0 = f[56];  x1 = f[57];  x2 = f[58];  x3 = f[59];
+    y = mont_mulq(x2, 11767139);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11767139);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 20006024);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 4038243);  x3 = x2 - y;  x2 = x2 + y;
+    f[56] = x0;  f[57] = x1;  f[58] = x2;  f[59] = x3;
+    x0 = f[60];  x1 = f[61];  x2 = f[62];  x3 = f[63];
+    y = mont_mulq(x2, 10268342);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10268342);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 23863466);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5400208);  x3 = x2 - y;  x2 = x2 + y;
+    f[60] = x0;  f[61] = x1;  f[62] = x2;  f[63] = x3;
+    x0 = f[64];  x1 = f[65];  x2 = f[66];  x3 = f[67];
+    y = mont_mulq(x2, 14317088);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 14317088);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 32661754);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 7865111);  x3 = x2 - y;  x2 = x2 + y;
+    f[64] = x0;  f[65] = x1;  f[66] = x2;  f[67] = x3;
+    x0 = f[68];  x1 = f[69];  x2 = f[70];  x3 = f[71];
+    y = mont_mulq(x2, 12984689);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 12984689);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 22892358);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 26801289);  x3 = x2 - y;  x2 = x2 + y;
+    f[68] = x0;  f[69] = x1;  f[70] = x2;  f[71] = x3;
+    x0 = f[72];  x1 = f[73];  x2 = f[74];  x3 = f[75];
+    y = mont_mulq(x2, 15944111);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 15944111);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 11396388);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5957087);  x3 = x2 - y;  x2 = x2 + y;
+    f[72] = x0;  f[73] = x1;  f[74] = x2;  f[75] = x3;
+    x0 = f[76];  x1 = f[77];  x2 = f[78];  x3 = f[79];
+    y = mont_mulq(x2, 30813171);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 30813171);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 24061947);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10088648);  x3 = x2 - y;  x2 = x2 + y;
+    f[76] = x0;  f[77] = x1;  f[78] = x2;  f[79] = x3;
+    x0 = f[80];  x1 = f[81];  x2 = f[82];  x3 = f[83];
+    y = mont_mulq(x2, 2694593);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 2694593);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 17583519);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 17318481);  x3 = x2 - y;  x2 = x2 + y;
+    f[80] = x0;  f[81] = x1;  f[82] = x2;  f[83] = x3;
+    x0 = f[84];  x1 = f[85];  x2 = f[86];  x3 = f[87];
+    y = mont_mulq(x2, 26451815);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 26451815);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 6137845);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22490456);  x3 = x2 - y;  x2 = x2 + y;
+    f[84] = x0;  f[85] = x1;  f[86] = x2;  f[87] = x3;
+    x0 = f[88];  x1 = f[89];  x2 = f[90];  x3 = f[91];
+    y = mont_mulq(x2, 6406585);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 6406585);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 28710073);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23987117);  x3 = x2 - y;  x2 = x2 + y;
+    f[88] = x0;  f[89] = x1;  f[90] = x2;  f[91] = x3;
+    x0 = f[92];  x1 = f[93];  x2 = f[94];  x3 = f[95];
+    y = mont_mulq(x2, 20010985);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 20010985);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 15764394);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 27006783);  x3 = x2 - y;  x2 = x2 + y;
+    f[92] = x0;  f[93] = x1;  f[94] = x2;  f[95] = x3;
+    x0 = f[96];  x1 = f[97];  x2 = f[98];  x3 = f[99];
+    y = mont_mulq(x2, 26966511);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 26966511);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 17495707);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 8448824);  x3 = x2 - y;  x2 = x2 + y;
+    f[96] = x0;  f[97] = x1;  f[98] = x2;  f[99] = x3;
+    x0 = f[100];  x1 = f[101];  x2 = f[102];  x3 = f[103];
+    y = mont_mulq(x2, 30969403);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 30969403);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 15301221);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 7050722);  x3 = x2 - y;  x2 = x2 + y;
+    f[100] = x0;  f[101] = x1;  f[102] = x2;  f[103] = x3;
+    x0 = f[104];  x1 = f[105];  x2 = f[106];  x3 = f[107];
+    y = mont_mulq(x2, 10350944);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10350944);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 21141507);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 32554080);  x3 = x2 - y;  x2 = x2 + y;
+    f[104] = x0;  f[105] = x1;  f[106] = x2;  f[107] = x3;
+    x0 = f[108];  x1 = f[109];  x2 = f[110];  x3 = f[111];
+    y = mont_mulq(x2, 17755942);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 17755942);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 15212341);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 26202716);  x3 = x2 - y;  x2 = x2 + y;
+    f[108] = x0;  f[109] = x1;  f[110] = x2;  f[111] = x3;
+    x0 = f[112];  x1 = f[113];  x2 = f[114];  x3 = f[115];
+    y = mont_mulq(x2, 31244694);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 31244694);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 3544406);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5492562);  x3 = x2 - y;  x2 = x2 + y;
+    f[112] = x0;  f[113] = x1;  f[114] = x2;  f[115] = x3;
+    x0 = f[116];  x1 = f[117];  x2 = f[118];  x3 = f[119];
+    y = mont_mulq(x2, 16592269);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16592269);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 7467341);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 15476051);  x3 = x2 - y;  x2 = x2 + y;
+    f[116] = x0;  f[117] = x1;  f[118] = x2;  f[119] = x3;
+    x0 = f[120];  x1 = f[121];  x2 = f[122];  x3 = f[123];
+    y = mont_mulq(x2, 15029351);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 15029351);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 9331981);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23955081);  x3 = x2 - y;  x2 = x2 + y;
+    f[120] = x0;  f[121] = x1;  f[122] = x2;  f[123] = x3;
+    x0 = f[124];  x1 = f[125];  x2 = f[126];  x3 = f[127];
+    y = mont_mulq(x2, 31275530);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 31275530);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 22876568);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 26738484);  x3 = x2 - y;  x2 = x2 + y;
+    f[124] = x0;  f[125] = x1;  f[126] = x2;  f[127] = x3;
+    x0 = f[128];  x1 = f[129];  x2 = f[130];  x3 = f[131];
+    y = mont_mulq(x2, 30598763);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 30598763);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 18765598);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 549280);  x3 = x2 - y;  x2 = x2 + y;
+    f[128] = x0;  f[129] = x1;  f[130] = x2;  f[131] = x3;
+    x0 = f[132];  x1 = f[133];  x2 = f[134];  x3 = f[135];
+    y = mont_mulq(x2, 9444158);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9444158);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 27900090);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28595224);  x3 = x2 - y;  x2 = x2 + y;
+    f[132] = x0;  f[133] = x1;  f[134] = x2;  f[135] = x3;
+    x0 = f[136];  x1 = f[137];  x2 = f[138];  x3 = f[139];
+    y = mont_mulq(x2, 4158217);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 4158217);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 9821018);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16583057);  x3 = x2 - y;  x2 = x2 + y;
+    f[136] = x0;  f[137] = x1;  f[138] = x2;  f[139] = x3;
+    x0 = f[140];  x1 = f[141];  x2 = f[142];  x3 = f[143];
+    y = mont_mulq(x2, 295408);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 295408);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 2391744);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 2331434);  x3 = x2 - y;  x2 = x2 + y;
+    f[140] = x0;  f[141] = x1;  f[142] = x2;  f[143] = x3;
+    x0 = f[144];  x1 = f[145];  x2 = f[146];  x3 = f[147];
+    y = mont_mulq(x2, 1312494);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 1312494);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 32156118);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 26379347);  x3 = x2 - y;  x2 = x2 + y;
+    f[144] = x0;  f[145] = x1;  f[146] = x2;  f[147] = x3;
+    x0 = f[148];  x1 = f[149];  x2 = f[150];  x3 = f[151];
+    y = mont_mulq(x2, 28869312);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28869312);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 28313524);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16811031);  x3 = x2 - y;  x2 = x2 + y;
+    f[148] = x0;  f[149] = x1;  f[150] = x2;  f[151] = x3;
+    x0 = f[152];  x1 = f[153];  x2 = f[154];  x3 = f[155];
+    y = mont_mulq(x2, 28382998);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28382998);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 10167038);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 10798836);  x3 = x2 - y;  x2 = x2 + y;
+    f[152] = x0;  f[153] = x1;  f[154] = x2;  f[155] = x3;
+    x0 = f[156];  x1 = f[157];  x2 = f[158];  x3 = f[159];
+    y = mont_mulq(x2, 25119048);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 25119048);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 29582106);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 15015034);  x3 = x2 - y;  x2 = x2 + y;
+    f[156] = x0;  f[157] = x1;  f[158] = x2;  f[159] = x3;
+    x0 = f[160];  x1 = f[161];  x2 = f[162];  x3 = f[163];
+    y = mont_mulq(x2, 21586133);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 21586133);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 6681561);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 3320266);  x3 = x2 - y;  x2 = x2 + y;
+    f[160] = x0;  f[161] = x1;  f[162] = x2;  f[163] = x3;
+    x0 = f[164];  x1 = f[165];  x2 = f[166];  x3 = f[167];
+    y = mont_mulq(x2, 2174608);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 2174608);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 8152825);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 28274051);  x3 = x2 - y;  x2 = x2 + y;
+    f[164] = x0;  f[165] = x1;  f[166] = x2;  f[167] = x3;
+    x0 = f[168];  x1 = f[169];  x2 = f[170];  x3 = f[171];
+    y = mont_mulq(x2, 971182);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 971182);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 3493835);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 26996082);  x3 = x2 - y;  x2 = x2 + y;
+    f[168] = x0;  f[169] = x1;  f[170] = x2;  f[171] = x3;
+    x0 = f[172];  x1 = f[173];  x2 = f[174];  x3 = f[175];
+    y = mont_mulq(x2, 16930314);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16930314);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 7409310);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 1126043);  x3 = x2 - y;  x2 = x2 + y;
+    f[172] = x0;  f[173] = x1;  f[174] = x2;  f[175] = x3;
+    x0 = f[176];  x1 = f[177];  x2 = f[178];  x3 = f[179];
+    y = mont_mulq(x2, 16089224);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16089224);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 24105137);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 21309313);  x3 = x2 - y;  x2 = x2 + y;
+    f[176] = x0;  f[177] = x1;  f[178] = x2;  f[179] = x3;
+    x0 = f[180];  x1 = f[181];  x2 = f[182];  x3 = f[183];
+    y = mont_mulq(x2, 33164555);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 33164555);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 1340079);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 18429480);  x3 = x2 - y;  x2 = x2 + y;
+    f[180] = x0;  f[181] = x1;  f[182] = x2;  f[183] = x3;
+    x0 = f[184];  x1 = f[185];  x2 = f[186];  x3 = f[187];
+    y = mont_mulq(x2, 25578586);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 25578586);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 20985077);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 33504217);  x3 = x2 - y;  x2 = x2 + y;
+    f[184] = x0;  f[185] = x1;  f[186] = x2;  f[187] = x3;
+    x0 = f[188];  x1 = f[189];  x2 = f[190];  x3 = f[191];
+    y = mont_mulq(x2, 11520949);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11520949);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 25114323);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 7283953);  x3 = x2 - y;  x2 = x2 + y;
+    f[188] = x0;  f[189] = x1;  f[190] = x2;  f[191] = x3;
+    x0 = f[192];  x1 = f[193];  x2 = f[194];  x3 = f[195];
+    y = mont_mulq(x2, 11902971);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11902971);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 23346277);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 1993842);  x3 = x2 - y;  x2 = x2 + y;
+    f[192] = x0;  f[193] = x1;  f[194] = x2;  f[195] = x3;
+    x0 = f[196];  x1 = f[197];  x2 = f[198];  x3 = f[199];
+    y = mont_mulq(x2, 25958325);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 25958325);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 23696636);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 890780);  x3 = x2 - y;  x2 = x2 + y;
+    f[196] = x0;  f[197] = x1;  f[198] = x2;  f[199] = x3;
+    x0 = f[200];  x1 = f[201];  x2 = f[202];  x3 = f[203];
+    y = mont_mulq(x2, 25622482);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 25622482);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 11970518);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5882189);  x3 = x2 - y;  x2 = x2 + y;
+    f[200] = x0;  f[201] = x1;  f[202] = x2;  f[203] = x3;
+    x0 = f[204];  x1 = f[205];  x2 = f[206];  x3 = f[207];
+    y = mont_mulq(x2, 5788647);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5788647);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 32328326);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 6581391);  x3 = x2 - y;  x2 = x2 + y;
+    f[204] = x0;  f[205] = x1;  f[206] = x2;  f[207] = x3;
+    x0 = f[208];  x1 = f[209];  x2 = f[210];  x3 = f[211];
+    y = mont_mulq(x2, 1512189);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 1512189);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 22682749);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 21303665);  x3 = x2 - y;  x2 = x2 + y;
+    f[208] = x0;  f[209] = x1;  f[210] = x2;  f[211] = x3;
+    x0 = f[212];  x1 = f[213];  x2 = f[214];  x3 = f[215];
+    y = mont_mulq(x2, 23129892);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23129892);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 31075518);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 5592919);  x3 = x2 - y;  x2 = x2 + y;
+    f[212] = x0;  f[213] = x1;  f[214] = x2;  f[215] = x3;
+    x0 = f[216];  x1 = f[217];  x2 = f[218];  x3 = f[219];
+    y = mont_mulq(x2, 33548073);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 33548073);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 31118264);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 21677573);  x3 = x2 - y;  x2 = x2 + y;
+    f[216] = x0;  f[217] = x1;  f[218] = x2;  f[219] = x3;
+    x0 = f[220];  x1 = f[221];  x2 = f[222];  x3 = f[223];
+    y = mont_mulq(x2, 33265110);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 33265110);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 14228138);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11292275);  x3 = x2 - y;  x2 = x2 + y;
+    f[220] = x0;  f[221] = x1;  f[222] = x2;  f[223] = x3;
+    x0 = f[224];  x1 = f[225];  x2 = f[226];  x3 = f[227];
+    y = mont_mulq(x2, 4757561);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 4757561);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 16675504);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 22854030);  x3 = x2 - y;  x2 = x2 + y;
+    f[224] = x0;  f[225] = x1;  f[226] = x2;  f[227] = x3;
+    x0 = f[228];  x1 = f[229];  x2 = f[230];  x3 = f[231];
+    y = mont_mulq(x2, 33361188);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 33361188);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 1831143);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 6911566);  x3 = x2 - y;  x2 = x2 + y;
+    f[228] = x0;  f[229] = x1;  f[230] = x2;  f[231] = x3;
+    x0 = f[232];  x1 = f[233];  x2 = f[234];  x3 = f[235];
+    y = mont_mulq(x2, 12394212);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 12394212);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 31256330);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 23926560);  x3 = x2 - y;  x2 = x2 + y;
+    f[232] = x0;  f[233] = x1;  f[234] = x2;  f[235] = x3;
+    x0 = f[236];  x1 = f[237];  x2 = f[238];  x3 = f[239];
+    y = mont_mulq(x2, 24969419);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 24969419);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 29285890);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9587262);  x3 = x2 - y;  x2 = x2 + y;
+    f[236] = x0;  f[237] = x1;  f[238] = x2;  f[239] = x3;
+    x0 = f[240];  x1 = f[241];  x2 = f[242];  x3 = f[243];
+    y = mont_mulq(x2, 29092517);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 29092517);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 18068068);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 16494188);  x3 = x2 - y;  x2 = x2 + y;
+    f[240] = x0;  f[241] = x1;  f[242] = x2;  f[243] = x3;
+    x0 = f[244];  x1 = f[245];  x2 = f[246];  x3 = f[247];
+    y = mont_mulq(x2, 24807116);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 24807116);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 8860636);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 9193484);  x3 = x2 - y;  x2 = x2 + y;
+    f[244] = x0;  f[245] = x1;  f[246] = x2;  f[247] = x3;
+    x0 = f[248];  x1 = f[249];  x2 = f[250];  x3 = f[251];
+    y = mont_mulq(x2, 27320357);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 27320357);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 24253081);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 11613809);  x3 = x2 - y;  x2 = x2 + y;
+    f[248] = x0;  f[249] = x1;  f[250] = x2;  f[251] = x3;
+    x0 = f[252];  x1 = f[253];  x2 = f[254];  x3 = f[255];
+    y = mont_mulq(x2, 356339);  x2 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 356339);  x3 = x1 - y;  x1 = x1 + y;
+    y = mont_mulq(x1, 32254537);  x1 = x0 - y;  x0 = x0 + y;
+    y = mont_mulq(x3, 31413463);  x3 = x2 - y;  x2 = x2 + y;
+    f[252] = x0;  f[253] = x1;  f[254] = x2;  f[255] = x3;
+}
+
+//  Reverse NTT with normalization, as polyr_intt().
+
+static inline void ntt_gen_inv(int32_t *f)
+{
+    int32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    int32_t y;
+
+    x0 = f[0];  x1 = f[1];  x2 = f[2];  x3 = f[3];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 31413463);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32254537);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 356339);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 356339);
+    f[0] = x0;  f[1] = x1;  f[2] = x2;  f[3] = x3;
+    x0 = f[4];  x1 = f[5];  x2 = f[6];  x3 = f[7];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 11613809);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 24253081);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 27320357);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 27320357);
+    f[4] = x0;  f[5] = x1;  f[6] = x2;  f[7] = x3;
+    x0 = f[8];  x1 = f[9];  x2 = f[10];  x3 = f[11];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 9193484);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 8860636);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 24807116);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 24807116);
+    f[8] = x0;  f[9] = x1;  f[10] = x2;  f[11] = x3;
+    x0 = f[12];  x1 = f[13];  x2 = f[14];  x3 = f[15];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 16494188);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 18068068);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 29092517);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 29092517);
+    f[12] = x0;  f[13] = x1;  f[14] = x2;  f[15] = x3;
+    x0 = f[16];  x1 = f[17];  x2 = f[18];  x3 = f[19];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 9587262);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 29285890);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 24969419);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 24969419);
+    f[16] = x0;  f[17] = x1;  f[18] = x2;  f[19] = x3;
+    x0 = f[20];  x1 = f[21];  x2 = f[22];  x3 = f[23];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 23926560);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 31256330);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 12394212);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 12394212);
+    f[20] = x0;  f[21] = x1;  f[22] = x2;  f[23] = x3;
+    x0 = f[24];  x1 = f[25];  x2 = f[26];  x3 = f[27];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 6911566);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 1831143);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33361188);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33361188);
+    f[24] = x0;  f[25] = x1;  f[26] = x2;  f[27] = x3;
+    x0 = f[28];  x1 = f[29];  x2 = f[30];  x3 = f[31];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 22854030);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 16675504);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 4757561);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 4757561);
+    f[28] = x0;  f[29] = x1;  f[30] = x2;  f[31] = x3;
+    x0 = f[32];  x1 = f[33];  x2 = f[34];  x3 = f[35];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 11292275);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 14228138);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33265110);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33265110);
+    f[32] = x0;  f[33] = x1;  f[34] = x2;  f[35] = x3;
+    x0 = f[36];  x1 = f[37];  x2 = f[38];  x3 = f[39];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 21677573);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 31118264);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33548073);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33548073);
+    f[36] = x0;  f[37] = x1;  f[38] = x2;  f[39] = x3;
+    x0 = f[40];  x1 = f[41];  x2 = f[42];  x3 = f[43];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 5592919);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 31075518);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 23129892);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 23129892);
+    f[40] = x0;  f[41] = x1;  f[42] = x2;  f[43] = x3;
+    x0 = f[44];  x1 = f[45];  x2 = f[46];  x3 = f[47];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 21303665);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 22682749);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 1512189);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 1512189);
+    f[44] = x0;  f[45] = x1;  f[46] = x2;  f[47] = x3;
+    x0 = f[48];  x1 = f[49];  x2 = f[50];  x3 = f[51];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 6581391);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32328326);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 5788647);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 5788647);
+    f[48] = x0;  f[49] = x1;  f[50] = x2;  f[51] = x3;
+    x0 = f[52];  x1 = f[53];  x2 = f[54];  x3 = f[55];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 5882189);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 11970518);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 25622482);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 25622482);
+    f[52] = x0;  f[53] = x1;  f[54] = x2;  f[55] = x3;
+    x0 = f[56];  x1 = f[57];  x2 = f[58];  x3 = f[59];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 890780);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23696636);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 25958325);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 25958325);
+    f[56] = x0;  f[57] = x1;  f[58] = x2;  f[59] = x3;
+    x0 = f[60];  x1 = f[61];  x2 = f[62];  x3 = f[63];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 1993842);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23346277);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 11902971);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 11902971);
+    f[60] = x0;  f[61] = x1;  f[62] = x2;  f[63] = x3;
+    x0 = f[64];  x1 = f[65];  x2 = f[66];  x3 = f[67];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 7283953);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 25114323);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 11520949);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 11520949);
+    f[64] = x0;  f[65] = x1;  f[66] = x2;  f[67] = x3;
+    x0 = f[68];  x1 = f[69];  x2 = f[70];  x3 = f[71];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 33504217);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 20985077);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 25578586);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 25578586);
+    f[68] = x0;  f[69] = x1;  f[70] = x2;  f[71] = x3;
+    x0 = f[72];  x1 = f[73];  x2 = f[74];  x3 = f[75];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 18429480);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 1340079);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33164555);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33164555);
+    f[72] = x0;  f[73] = x1;  f[74] = x2;  f[75] = x3;
+    x0 = f[76];  x1 = f[77];  x2 = f[78];  x3 = f[79];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 21309313);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 24105137);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 16089224);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 16089224);
+    f[76] = x0;  f[77] = x1;  f[78] = x2;  f[79] = x3;
+    x0 = f[80];  x1 = f[81];  x2 = f[82];  x3 = f[83];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 1126043);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 7409310);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 16930314);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 16930314);
+    f[80] = x0;  f[81] = x1;  f[82] = x2;  f[83] = x3;
+    x0 = f[84];  x1 = f[85];  x2 = f[86];  x3 = f[87];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 26996082);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 3493835);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 971182);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 971182);
+    f[84] = x0;  f[85] = x1;  f[86] = x2;  f[87] = x3;
+    x0 = f[88];  x1 = f[89];  x2 = f[90];  x3 = f[91];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 28274051);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 8152825);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 2174608);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 2174608);
+    f[88] = x0;  f[89] = x1;  f[90] = x2;  f[91] = x3;
+    x0 = f[92];  x1 = f[93];  x2 = f[94];  x3 = f[95];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 3320266);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6681561);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 21586133);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 21586133);
+    f[92] = x0;  f[93] = x1;  f[94] = x2;  f[95] = x3;
+    x0 = f[96];  x1 = f[97];  x2 = f[98];  x3 = f[99];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 15015034);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 29582106);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 25119048);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 25119048);
+    f[96] = x0;  f[97] = x1;  f[98] = x2;  f[99] = x3;
+    x0 = f[100];  x1 = f[101];  x2 = f[102];  x3 = f[103];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10798836);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 10167038);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 28382998);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 28382998);
+    f[100] = x0;  f[101] = x1;  f[102] = x2;  f[103] = x3;
+    x0 = f[104];  x1 = f[105];  x2 = f[106];  x3 = f[107];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 16811031);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 28313524);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 28869312);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 28869312);
+    f[104] = x0;  f[105] = x1;  f[106] = x2;  f[107] = x3;
+    x0 = f[108];  x1 = f[109];  x2 = f[110];  x3 = f[111];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 26379347);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32156118);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 1312494);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 1312494);
+    f[108] = x0;  f[109] = x1;  f[110] = x2;  f[111] = x3;
+    x0 = f[112];  x1 = f[113];  x2 = f[114];  x3 = f[115];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2331434);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 2391744);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 295408);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 295408);
+    f[112] = x0;  f[113] = x1;  f[114] = x2;  f[115] = x3;
+    x0 = f[116];  x1 = f[117];  x2 = f[118];  x3 = f[119];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 16583057);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 9821018);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 4158217);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 4158217);
+    f[116] = x0;  f[117] = x1;  f[118] = x2;  f[119] = x3;
+    x0 = f[120];  x1 = f[121];  x2 = f[122];  x3 = f[123];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 28595224);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 27900090);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 9444158);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 9444158);
+    f[120] = x0;  f[121] = x1;  f[122] = x2;  f[123] = x3;
+    x0 = f[124];  x1 = f[125];  x2 = f[126];  x3 = f[127];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 549280);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 18765598);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30598763);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30598763);
+    f[124] = x0;  f[125] = x1;  f[126] = x2;  f[127] = x3;
+    x0 = f[128];  x1 = f[129];  x2 = f[130];  x3 = f[131];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 26738484);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 22876568);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 31275530);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 31275530);
+    f[128] = x0;  f[129] = x1;  f[130] = x2;  f[131] = x3;
+    x0 = f[132];  x1 = f[133];  x2 = f[134];  x3 = f[135];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 23955081);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 9331981);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 15029351);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 15029351);
+    f[132] = x0;  f[133] = x1;  f[134] = x2;  f[135] = x3;
+    x0 = f[136];  x1 = f[137];  x2 = f[138];  x3 = f[139];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 15476051);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 7467341);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 16592269);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 16592269);
+    f[136] = x0;  f[137] = x1;  f[138] = x2;  f[139] = x3;
+    x0 = f[140];  x1 = f[141];  x2 = f[142];  x3 = f[143];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 5492562);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 3544406);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 31244694);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 31244694);
+    f[140] = x0;  f[141] = x1;  f[142] = x2;  f[143] = x3;
+    x0 = f[144];  x1 = f[145];  x2 = f[146];  x3 = f[147];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 26202716);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 15212341);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 17755942);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 17755942);
+    f[144] = x0;  f[145] = x1;  f[146] = x2;  f[147] = x3;
+    x0 = f[148];  x1 = f[149];  x2 = f[150];  x3 = f[151];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 32554080);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 21141507);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 10350944);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 10350944);
+    f[148] = x0;  f[149] = x1;  f[150] = x2;  f[151] = x3;
+    x0 = f[152];  x1 = f[153];  x2 = f[154];  x3 = f[155];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 7050722);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 15301221);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30969403);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30969403);
+    f[152] = x0;  f[153] = x1;  f[154] = x2;  f[155] = x3;
+    x0 = f[156];  x1 = f[157];  x2 = f[158];  x3 = f[159];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 8448824);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 17495707);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 26966511);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 26966511);
+    f[156] = x0;  f[157] = x1;  f[158] = x2;  f[159] = x3;
+    x0 = f[160];  x1 = f[161];  x2 = f[162];  x3 = f[163];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 27006783);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 15764394);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20010985);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20010985);
+    f[160] = x0;  f[161] = x1;  f[162] = x2;  f[163] = x3;
+    x0 = f[164];  x1 = f[165];  x2 = f[166];  x3 = f[167];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 23987117);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 28710073);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 6406585);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 6406585);
+    f[164] = x0;  f[165] = x1;  f[166] = x2;  f[167] = x3;
+    x0 = f[168];  x1 = f[169];  x2 = f[170];  x3 = f[171];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 22490456);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6137845);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 26451815);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 26451815);
+    f[168] = x0;  f[169] = x1;  f[170] = x2;  f[171] = x3;
+    x0 = f[172];  x1 = f[173];  x2 = f[174];  x3 = f[175];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 17318481);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 17583519);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 2694593);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 2694593);
+    f[172] = x0;  f[173] = x1;  f[174] = x2;  f[175] = x3;
+    x0 = f[176];  x1 = f[177];  x2 = f[178];  x3 = f[179];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10088648);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 24061947);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30813171);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30813171);
+    f[176] = x0;  f[177] = x1;  f[178] = x2;  f[179] = x3;
+    x0 = f[180];  x1 = f[181];  x2 = f[182];  x3 = f[183];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 5957087);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 11396388);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 15944111);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 15944111);
+    f[180] = x0;  f[181] = x1;  f[182] = x2;  f[183] = x3;
+    x0 = f[184];  x1 = f[185];  x2 = f[186];  x3 = f[187];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 26801289);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 22892358);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 12984689);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 12984689);
+    f[184] = x0;  f[185] = x1;  f[186] = x2;  f[187] = x3;
+    x0 = f[188];  x1 = f[189];  x2 = f[190];  x3 = f[191];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 7865111);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32661754);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 14317088);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 14317088);
+    f[188] = x0;  f[189] = x1;  f[190] = x2;  f[191] = x3;
+    x0 = f[192];  x1 = f[193];  x2 = f[194];  x3 = f[195];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 5400208);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23863466);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 10268342);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 10268342);
+    f[192] = x0;  f[193] = x1;  f[194] = x2;  f[195] = x3;
+    x0 = f[196];  x1 = f[197];  x2 = f[198];  x3 = f[199];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 4038243);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 20006024);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 11767139);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 11767139);
+    f[196] = x0;  f[197] = x1;  f[198] = x2;  f[199] = x3;
+    x0 = f[200];  x1 = f[201];  x2 = f[202];  x3 = f[203];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 5790148);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 31109078);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 13111549);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 13111549);
+    f[200] = x0;  f[201] = x1;  f[202] = x2;  f[203] = x3;
+    x0 = f[204];  x1 = f[205];  x2 = f[206];  x3 = f[207];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 5527986);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 7143126);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 1594993);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 1594993);
+    f[204] = x0;  f[205] = x1;  f[206] = x2;  f[207] = x3;
+    x0 = f[208];  x1 = f[209];  x2 = f[210];  x3 = f[211];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 350844);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19639872);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 27204547);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 27204547);
+    f[208] = x0;  f[209] = x1;  f[210] = x2;  f[211] = x3;
+    x0 = f[212];  x1 = f[213];  x2 = f[214];  x3 = f[215];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 20608463);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 28613855);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 274280);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 274280);
+    f[212] = x0;  f[213] = x1;  f[214] = x2;  f[215] = x3;
+    x0 = f[216];  x1 = f[217];  x2 = f[218];  x3 = f[219];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 14752366);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 20172936);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20465111);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20465111);
+    f[216] = x0;  f[217] = x1;  f[218] = x2;  f[219] = x3;
+    x0 = f[220];  x1 = f[221];  x2 = f[222];  x3 = f[223];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 7168707);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 9254376);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 6958801);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 6958801);
+    f[220] = x0;  f[221] = x1;  f[222] = x2;  f[223] = x3;
+    x0 = f[224];  x1 = f[225];  x2 = f[226];  x3 = f[227];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 8395453);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 24560419);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30095497);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30095497);
+    f[224] = x0;  f[225] = x1;  f[226] = x2;  f[227] = x3;
+    x0 = f[228];  x1 = f[229];  x2 = f[230];  x3 = f[231];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 12553039);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23321992);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 28381447);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 28381447);
+    f[228] = x0;  f[229] = x1;  f[230] = x2;  f[231] = x3;
+    x0 = f[232];  x1 = f[233];  x2 = f[234];  x3 = f[235];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10730693);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 12276016);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 10986757);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 10986757);
+    f[232] = x0;  f[233] = x1;  f[234] = x2;  f[235] = x3;
+    x0 = f[236];  x1 = f[237];  x2 = f[238];  x3 = f[239];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 32966155);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 27332300);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 5860566);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 5860566);
+    f[236] = x0;  f[237] = x1;  f[238] = x2;  f[239] = x3;
+    x0 = f[240];  x1 = f[241];  x2 = f[242];  x3 = f[243];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 31299552);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 26258901);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 31631832);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 31631832);
+    f[240] = x0;  f[241] = x1;  f[242] = x2;  f[243] = x3;
+    x0 = f[244];  x1 = f[245];  x2 = f[246];  x3 = f[247];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 29800114);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 7192988);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 11189900);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 11189900);
+    f[244] = x0;  f[245] = x1;  f[246] = x2;  f[247] = x3;
+    x0 = f[248];  x1 = f[249];  x2 = f[250];  x3 = f[251];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10321733);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 17918503);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 7503285);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 7503285);
+    f[248] = x0;  f[249] = x1;  f[250] = x2;  f[251] = x3;
+    x0 = f[252];  x1 = f[253];  x2 = f[254];  x3 = f[255];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 8792503);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 33073869);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 29787612);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 29787612);
+    f[252] = x0;  f[253] = x1;  f[254] = x2;  f[255] = x3;
+    x0 = f[0];  x1 = f[4];  x2 = f[8];  x3 = f[12];
+    x4 = f[16];  x5 = f[20];  x6 = f[24];  x7 = f[28];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2292012);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 14086122);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9986178);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 16076627);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33049270);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33049270);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28138468);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28138468);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24124141);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24124141);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24124141);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24124141);
+    f[0] = x0;  f[4] = x1;  f[8] = x2;  f[12] = x3;
+    f[16] = x4;  f[20] = x5;  f[24] = x6;  f[28] = x7;
+    x0 = f[1];  x1 = f[5];  x2 = f[9];  x3 = f[13];
+    x4 = f[17];  x5 = f[21];  x6 = f[25];  x7 = f[29];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2292012);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 14086122);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9986178);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 16076627);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33049270);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33049270);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28138468);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28138468);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24124141);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24124141);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24124141);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24124141);
+    f[1] = x0;  f[5] = x1;  f[9] = x2;  f[13] = x3;
+    f[17] = x4;  f[21] = x5;  f[25] = x6;  f[29] = x7;
+    x0 = f[2];  x1 = f[6];  x2 = f[10];  x3 = f[14];
+    x4 = f[18];  x5 = f[22];  x6 = f[26];  x7 = f[30];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2292012);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 14086122);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9986178);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 16076627);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33049270);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33049270);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28138468);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28138468);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24124141);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24124141);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24124141);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24124141);
+    f[2] = x0;  f[6] = x1;  f[10] = x2;  f[14] = x3;
+    f[18] = x4;  f[22] = x5;  f[26] = x6;  f[30] = x7;
+    x0 = f[3];  x1 = f[7];  x2 = f[11];  x3 = f[15];
+    x4 = f[19];  x5 = f[23];  x6 = f[27];  x7 = f[31];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2292012);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 14086122);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9986178);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 16076627);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 33049270);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 33049270);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28138468);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28138468);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24124141);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24124141);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24124141);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24124141);
+    f[3] = x0;  f[7] = x1;  f[11] = x2;  f[15] = x3;
+    f[19] = x4;  f[23] = x5;  f[27] = x6;  f[31] = x7;
+    x0 = f[32];  x1 = f[36];  x2 = f[40];  x3 = f[44];
+    x4 = f[48];  x5 = f[52];  x6 = f[56];  x7 = f[60];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 12096975);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23754885);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10865068);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 44602);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 32738467);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 32738467);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 16657861);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 16657861);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 2200199);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 2200199);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 2200199);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 2200199);
+    f[32] = x0;  f[36] = x1;  f[40] = x2;  f[44] = x3;
+    f[48] = x4;  f[52] = x5;  f[56] = x6;  f[60] = x7;
+    x0 = f[33];  x1 = f[37];  x2 = f[41];  x3 = f[45];
+    x4 = f[49];  x5 = f[53];  x6 = f[57];  x7 = f[61];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 12096975);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23754885);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10865068);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 44602);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 32738467);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 32738467);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 16657861);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 16657861);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 2200199);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 2200199);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 2200199);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 2200199);
+    f[33] = x0;  f[37] = x1;  f[41] = x2;  f[45] = x3;
+    f[49] = x4;  f[53] = x5;  f[57] = x6;  f[61] = x7;
+    x0 = f[34];  x1 = f[38];  x2 = f[42];  x3 = f[46];
+    x4 = f[50];  x5 = f[54];  x6 = f[58];  x7 = f[62];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 12096975);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23754885);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10865068);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 44602);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 32738467);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 32738467);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 16657861);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 16657861);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 2200199);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 2200199);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 2200199);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 2200199);
+    f[34] = x0;  f[38] = x1;  f[42] = x2;  f[46] = x3;
+    f[50] = x4;  f[54] = x5;  f[58] = x6;  f[62] = x7;
+    x0 = f[35];  x1 = f[39];  x2 = f[43];  x3 = f[47];
+    x4 = f[51];  x5 = f[55];  x6 = f[59];  x7 = f[63];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 12096975);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 23754885);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10865068);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 44602);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 32738467);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 32738467);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 16657861);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 16657861);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 2200199);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 2200199);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 2200199);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 2200199);
+    f[35] = x0;  f[39] = x1;  f[43] = x2;  f[47] = x3;
+    f[51] = x4;  f[55] = x5;  f[59] = x6;  f[63] = x7;
+    x0 = f[64];  x1 = f[68];  x2 = f[72];  x3 = f[76];
+    x4 = f[80];  x5 = f[84];  x6 = f[88];  x7 = f[92];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2515533);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 15608693);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10496054);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 18170667);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 28870577);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 28870577);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 32021213);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 32021213);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 3198144);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 3198144);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 3198144);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 3198144);
+    f[64] = x0;  f[68] = x1;  f[72] = x2;  f[76] = x3;
+    f[80] = x4;  f[84] = x5;  f[88] = x6;  f[92] = x7;
+    x0 = f[65];  x1 = f[69];  x2 = f[73];  x3 = f[77];
+    x4 = f[81];  x5 = f[85];  x6 = f[89];  x7 = f[93];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2515533);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 15608693);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10496054);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 18170667);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 28870577);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 28870577);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 32021213);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 32021213);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 3198144);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 3198144);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 3198144);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 3198144);
+    f[65] = x0;  f[69] = x1;  f[73] = x2;  f[77] = x3;
+    f[81] = x4;  f[85] = x5;  f[89] = x6;  f[93] = x7;
+    x0 = f[66];  x1 = f[70];  x2 = f[74];  x3 = f[78];
+    x4 = f[82];  x5 = f[86];  x6 = f[90];  x7 = f[94];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2515533);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 15608693);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10496054);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 18170667);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 28870577);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 28870577);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 32021213);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 32021213);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 3198144);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 3198144);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 3198144);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 3198144);
+    f[66] = x0;  f[70] = x1;  f[74] = x2;  f[78] = x3;
+    f[82] = x4;  f[86] = x5;  f[90] = x6;  f[94] = x7;
+    x0 = f[67];  x1 = f[71];  x2 = f[75];  x3 = f[79];
+    x4 = f[83];  x5 = f[87];  x6 = f[91];  x7 = f[95];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 2515533);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 15608693);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 10496054);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 18170667);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 28870577);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 28870577);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 32021213);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 32021213);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 3198144);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 3198144);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 3198144);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 3198144);
+    f[67] = x0;  f[71] = x1;  f[75] = x2;  f[79] = x3;
+    f[83] = x4;  f[87] = x5;  f[91] = x6;  f[95] = x7;
+    x0 = f[96];  x1 = f[100];  x2 = f[104];  x3 = f[108];
+    x4 = f[112];  x5 = f[116];  x6 = f[120];  x7 = f[124];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24580770);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6067746);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 18546326);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 875322);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 17535208);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 17535208);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11930096);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11930096);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 23400652);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 23400652);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 23400652);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 23400652);
+    f[96] = x0;  f[100] = x1;  f[104] = x2;  f[108] = x3;
+    f[112] = x4;  f[116] = x5;  f[120] = x6;  f[124] = x7;
+    x0 = f[97];  x1 = f[101];  x2 = f[105];  x3 = f[109];
+    x4 = f[113];  x5 = f[117];  x6 = f[121];  x7 = f[125];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24580770);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6067746);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 18546326);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 875322);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 17535208);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 17535208);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11930096);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11930096);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 23400652);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 23400652);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 23400652);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 23400652);
+    f[97] = x0;  f[101] = x1;  f[105] = x2;  f[109] = x3;
+    f[113] = x4;  f[117] = x5;  f[121] = x6;  f[125] = x7;
+    x0 = f[98];  x1 = f[102];  x2 = f[106];  x3 = f[110];
+    x4 = f[114];  x5 = f[118];  x6 = f[122];  x7 = f[126];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24580770);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6067746);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 18546326);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 875322);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 17535208);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 17535208);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11930096);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11930096);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 23400652);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 23400652);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 23400652);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 23400652);
+    f[98] = x0;  f[102] = x1;  f[106] = x2;  f[110] = x3;
+    f[114] = x4;  f[118] = x5;  f[122] = x6;  f[126] = x7;
+    x0 = f[99];  x1 = f[103];  x2 = f[107];  x3 = f[111];
+    x4 = f[115];  x5 = f[119];  x6 = f[123];  x7 = f[127];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24580770);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6067746);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 18546326);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 875322);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 17535208);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 17535208);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11930096);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11930096);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 23400652);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 23400652);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 23400652);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 23400652);
+    f[99] = x0;  f[103] = x1;  f[107] = x2;  f[111] = x3;
+    f[115] = x4;  f[119] = x5;  f[123] = x6;  f[127] = x7;
+    x0 = f[128];  x1 = f[132];  x2 = f[136];  x3 = f[140];
+    x4 = f[144];  x5 = f[148];  x6 = f[152];  x7 = f[156];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24272961);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6983968);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22883012);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17558876);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 5644069);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 5644069);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 12450192);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 12450192);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32410281);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32410281);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32410281);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32410281);
+    f[128] = x0;  f[132] = x1;  f[136] = x2;  f[140] = x3;
+    f[144] = x4;  f[148] = x5;  f[152] = x6;  f[156] = x7;
+    x0 = f[129];  x1 = f[133];  x2 = f[137];  x3 = f[141];
+    x4 = f[145];  x5 = f[149];  x6 = f[153];  x7 = f[157];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24272961);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6983968);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22883012);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17558876);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 5644069);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 5644069);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 12450192);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 12450192);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32410281);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32410281);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32410281);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32410281);
+    f[129] = x0;  f[133] = x1;  f[137] = x2;  f[141] = x3;
+    f[145] = x4;  f[149] = x5;  f[153] = x6;  f[157] = x7;
+    x0 = f[130];  x1 = f[134];  x2 = f[138];  x3 = f[142];
+    x4 = f[146];  x5 = f[150];  x6 = f[154];  x7 = f[158];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24272961);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6983968);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22883012);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17558876);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 5644069);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 5644069);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 12450192);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 12450192);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32410281);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32410281);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32410281);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32410281);
+    f[130] = x0;  f[134] = x1;  f[138] = x2;  f[142] = x3;
+    f[146] = x4;  f[150] = x5;  f[154] = x6;  f[158] = x7;
+    x0 = f[131];  x1 = f[135];  x2 = f[139];  x3 = f[143];
+    x4 = f[147];  x5 = f[151];  x6 = f[155];  x7 = f[159];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 24272961);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 6983968);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22883012);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17558876);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 5644069);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 5644069);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 12450192);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 12450192);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32410281);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32410281);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32410281);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32410281);
+    f[131] = x0;  f[135] = x1;  f[139] = x2;  f[143] = x3;
+    f[147] = x4;  f[151] = x5;  f[155] = x6;  f[159] = x7;
+    x0 = f[160];  x1 = f[164];  x2 = f[168];  x3 = f[172];
+    x4 = f[176];  x5 = f[180];  x6 = f[184];  x7 = f[188];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 22122426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 16908244);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 23808311);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17182522);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30499698);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30499698);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 18285219);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 18285219);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32900457);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32900457);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32900457);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32900457);
+    f[160] = x0;  f[164] = x1;  f[168] = x2;  f[172] = x3;
+    f[176] = x4;  f[180] = x5;  f[184] = x6;  f[188] = x7;
+    x0 = f[161];  x1 = f[165];  x2 = f[169];  x3 = f[173];
+    x4 = f[177];  x5 = f[181];  x6 = f[185];  x7 = f[189];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 22122426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 16908244);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 23808311);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17182522);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30499698);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30499698);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 18285219);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 18285219);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32900457);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32900457);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32900457);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32900457);
+    f[161] = x0;  f[165] = x1;  f[169] = x2;  f[173] = x3;
+    f[177] = x4;  f[181] = x5;  f[185] = x6;  f[189] = x7;
+    x0 = f[162];  x1 = f[166];  x2 = f[170];  x3 = f[174];
+    x4 = f[178];  x5 = f[182];  x6 = f[186];  x7 = f[190];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 22122426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 16908244);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 23808311);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17182522);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30499698);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30499698);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 18285219);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 18285219);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32900457);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32900457);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32900457);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32900457);
+    f[162] = x0;  f[166] = x1;  f[170] = x2;  f[174] = x3;
+    f[178] = x4;  f[182] = x5;  f[186] = x6;  f[190] = x7;
+    x0 = f[163];  x1 = f[167];  x2 = f[171];  x3 = f[175];
+    x4 = f[179];  x5 = f[183];  x6 = f[187];  x7 = f[191];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 22122426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 16908244);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 23808311);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 17182522);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 30499698);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 30499698);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 18285219);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 18285219);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 32900457);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 32900457);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 32900457);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 32900457);
+    f[163] = x0;  f[167] = x1;  f[171] = x2;  f[175] = x3;
+    f[179] = x4;  f[183] = x5;  f[187] = x6;  f[191] = x7;
+    x0 = f[192];  x1 = f[196];  x2 = f[200];  x3 = f[204];
+    x4 = f[208];  x5 = f[212];  x6 = f[216];  x7 = f[220];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 25090164);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 18447657);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9217272);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 19793647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 12498775);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 12498775);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 17354707);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 17354707);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 6177812);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 6177812);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 6177812);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 6177812);
+    f[192] = x0;  f[196] = x1;  f[200] = x2;  f[204] = x3;
+    f[208] = x4;  f[212] = x5;  f[216] = x6;  f[220] = x7;
+    x0 = f[193];  x1 = f[197];  x2 = f[201];  x3 = f[205];
+    x4 = f[209];  x5 = f[213];  x6 = f[217];  x7 = f[221];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 25090164);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 18447657);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9217272);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 19793647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 12498775);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 12498775);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 17354707);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 17354707);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 6177812);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 6177812);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 6177812);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 6177812);
+    f[193] = x0;  f[197] = x1;  f[201] = x2;  f[205] = x3;
+    f[209] = x4;  f[213] = x5;  f[217] = x6;  f[221] = x7;
+    x0 = f[194];  x1 = f[198];  x2 = f[202];  x3 = f[206];
+    x4 = f[210];  x5 = f[214];  x6 = f[218];  x7 = f[222];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 25090164);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 18447657);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9217272);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 19793647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 12498775);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 12498775);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 17354707);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 17354707);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 6177812);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 6177812);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 6177812);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 6177812);
+    f[194] = x0;  f[198] = x1;  f[202] = x2;  f[206] = x3;
+    f[210] = x4;  f[214] = x5;  f[218] = x6;  f[222] = x7;
+    x0 = f[195];  x1 = f[199];  x2 = f[203];  x3 = f[207];
+    x4 = f[211];  x5 = f[215];  x6 = f[219];  x7 = f[223];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 25090164);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 18447657);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9217272);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 19793647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 12498775);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 12498775);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 17354707);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 17354707);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 6177812);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 6177812);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 6177812);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 6177812);
+    f[195] = x0;  f[199] = x1;  f[203] = x2;  f[207] = x3;
+    f[211] = x4;  f[215] = x5;  f[219] = x6;  f[223] = x7;
+    x0 = f[224];  x1 = f[228];  x2 = f[232];  x3 = f[236];
+    x4 = f[240];  x5 = f[244];  x6 = f[248];  x7 = f[252];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 20016426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32084204);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22891714);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 3925647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 15280732);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 15280732);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28206570);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28206570);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24000204);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24000204);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24000204);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24000204);
+    f[224] = x0;  f[228] = x1;  f[232] = x2;  f[236] = x3;
+    f[240] = x4;  f[244] = x5;  f[248] = x6;  f[252] = x7;
+    x0 = f[225];  x1 = f[229];  x2 = f[233];  x3 = f[237];
+    x4 = f[241];  x5 = f[245];  x6 = f[249];  x7 = f[253];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 20016426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32084204);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22891714);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 3925647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 15280732);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 15280732);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28206570);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28206570);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24000204);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24000204);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24000204);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24000204);
+    f[225] = x0;  f[229] = x1;  f[233] = x2;  f[237] = x3;
+    f[241] = x4;  f[245] = x5;  f[249] = x6;  f[253] = x7;
+    x0 = f[226];  x1 = f[230];  x2 = f[234];  x3 = f[238];
+    x4 = f[242];  x5 = f[246];  x6 = f[250];  x7 = f[254];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 20016426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32084204);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22891714);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 3925647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 15280732);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 15280732);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28206570);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28206570);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24000204);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24000204);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24000204);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24000204);
+    f[226] = x0;  f[230] = x1;  f[234] = x2;  f[238] = x3;
+    f[242] = x4;  f[246] = x5;  f[250] = x6;  f[254] = x7;
+    x0 = f[227];  x1 = f[231];  x2 = f[235];  x3 = f[239];
+    x4 = f[243];  x5 = f[247];  x6 = f[251];  x7 = f[255];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 20016426);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 32084204);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 22891714);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 3925647);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 15280732);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 15280732);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 28206570);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 28206570);
+    y = x4 - x0;  x0 = mont_red1(x0 + x4);  x4 = mont_mulq(y, 24000204);
+    y = x5 - x1;  x1 = mont_red1(x1 + x5);  x5 = mont_mulq(y, 24000204);
+    y = x6 - x2;  x2 = mont_red1(x2 + x6);  x6 = mont_mulq(y, 24000204);
+    y = x7 - x3;  x3 = mont_red1(x3 + x7);  x7 = mont_mulq(y, 24000204);
+    f[227] = x0;  f[231] = x1;  f[235] = x2;  f[239] = x3;
+    f[243] = x4;  f[247] = x5;  f[251] = x6;  f[255] = x7;
+    x0 = f[0];  x1 = f[32];  x2 = f[64];  x3 = f[96];
+    x4 = f[128];  x5 = f[160];  x6 = f[192];  x7 = f[224];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[0] = x0;  f[32] = x1;  f[64] = x2;  f[96] = x3;
+    f[128] = x4;  f[160] = x5;  f[192] = x6;  f[224] = x7;
+    x0 = f[1];  x1 = f[33];  x2 = f[65];  x3 = f[97];
+    x4 = f[129];  x5 = f[161];  x6 = f[193];  x7 = f[225];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[1] = x0;  f[33] = x1;  f[65] = x2;  f[97] = x3;
+    f[129] = x4;  f[161] = x5;  f[193] = x6;  f[225] = x7;
+    x0 = f[2];  x1 = f[34];  x2 = f[66];  x3 = f[98];
+    x4 = f[130];  x5 = f[162];  x6 = f[194];  x7 = f[226];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[2] = x0;  f[34] = x1;  f[66] = x2;  f[98] = x3;
+    f[130] = x4;  f[162] = x5;  f[194] = x6;  f[226] = x7;
+    x0 = f[3];  x1 = f[35];  x2 = f[67];  x3 = f[99];
+    x4 = f[131];  x5 = f[163];  x6 = f[195];  x7 = f[227];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[3] = x0;  f[35] = x1;  f[67] = x2;  f[99] = x3;
+    f[131] = x4;  f[163] = x5;  f[195] = x6;  f[227] = x7;
+    x0 = f[4];  x1 = f[36];  x2 = f[68];  x3 = f[100];
+    x4 = f[132];  x5 = f[164];  x6 = f[196];  x7 = f[228];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[4] = x0;  f[36] = x1;  f[68] = x2;  f[100] = x3;
+    f[132] = x4;  f[164] = x5;  f[196] = x6;  f[228] = x7;
+    x0 = f[5];  x1 = f[37];  x2 = f[69];  x3 = f[101];
+    x4 = f[133];  x5 = f[165];  x6 = f[197];  x7 = f[229];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[5] = x0;  f[37] = x1;  f[69] = x2;  f[101] = x3;
+    f[133] = x4;  f[165] = x5;  f[197] = x6;  f[229] = x7;
+    x0 = f[6];  x1 = f[38];  x2 = f[70];  x3 = f[102];
+    x4 = f[134];  x5 = f[166];  x6 = f[198];  x7 = f[230];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[6] = x0;  f[38] = x1;  f[70] = x2;  f[102] = x3;
+    f[134] = x4;  f[166] = x5;  f[198] = x6;  f[230] = x7;
+    x0 = f[7];  x1 = f[39];  x2 = f[71];  x3 = f[103];
+    x4 = f[135];  x5 = f[167];  x6 = f[199];  x7 = f[231];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[7] = x0;  f[39] = x1;  f[71] = x2;  f[103] = x3;
+    f[135] = x4;  f[167] = x5;  f[199] = x6;  f[231] = x7;
+    x0 = f[8];  x1 = f[40];  x2 = f[72];  x3 = f[104];
+    x4 = f[136];  x5 = f[168];  x6 = f[200];  x7 = f[232];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[8] = x0;  f[40] = x1;  f[72] = x2;  f[104] = x3;
+    f[136] = x4;  f[168] = x5;  f[200] = x6;  f[232] = x7;
+    x0 = f[9];  x1 = f[41];  x2 = f[73];  x3 = f[105];
+    x4 = f[137];  x5 = f[169];  x6 = f[201];  x7 = f[233];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[9] = x0;  f[41] = x1;  f[73] = x2;  f[105] = x3;
+    f[137] = x4;  f[169] = x5;  f[201] = x6;  f[233] = x7;
+    x0 = f[10];  x1 = f[42];  x2 = f[74];  x3 = f[106];
+    x4 = f[138];  x5 = f[170];  x6 = f[202];  x7 = f[234];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[10] = x0;  f[42] = x1;  f[74] = x2;  f[106] = x3;
+    f[138] = x4;  f[170] = x5;  f[202] = x6;  f[234] = x7;
+    x0 = f[11];  x1 = f[43];  x2 = f[75];  x3 = f[107];
+    x4 = f[139];  x5 = f[171];  x6 = f[203];  x7 = f[235];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[11] = x0;  f[43] = x1;  f[75] = x2;  f[107] = x3;
+    f[139] = x4;  f[171] = x5;  f[203] = x6;  f[235] = x7;
+    x0 = f[12];  x1 = f[44];  x2 = f[76];  x3 = f[108];
+    x4 = f[140];  x5 = f[172];  x6 = f[204];  x7 = f[236];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[12] = x0;  f[44] = x1;  f[76] = x2;  f[108] = x3;
+    f[140] = x4;  f[172] = x5;  f[204] = x6;  f[236] = x7;
+    x0 = f[13];  x1 = f[45];  x2 = f[77];  x3 = f[109];
+    x4 = f[141];  x5 = f[173];  x6 = f[205];  x7 = f[237];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[13] = x0;  f[45] = x1;  f[77] = x2;  f[109] = x3;
+    f[141] = x4;  f[173] = x5;  f[205] = x6;  f[237] = x7;
+    x0 = f[14];  x1 = f[46];  x2 = f[78];  x3 = f[110];
+    x4 = f[142];  x5 = f[174];  x6 = f[206];  x7 = f[238];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[14] = x0;  f[46] = x1;  f[78] = x2;  f[110] = x3;
+    f[142] = x4;  f[174] = x5;  f[206] = x6;  f[238] = x7;
+    x0 = f[15];  x1 = f[47];  x2 = f[79];  x3 = f[111];
+    x4 = f[143];  x5 = f[175];  x6 = f[207];  x7 = f[239];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[15] = x0;  f[47] = x1;  f[79] = x2;  f[111] = x3;
+    f[143] = x4;  f[175] = x5;  f[207] = x6;  f[239] = x7;
+    x0 = f[16];  x1 = f[48];  x2 = f[80];  x3 = f[112];
+    x4 = f[144];  x5 = f[176];  x6 = f[208];  x7 = f[240];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[16] = x0;  f[48] = x1;  f[80] = x2;  f[112] = x3;
+    f[144] = x4;  f[176] = x5;  f[208] = x6;  f[240] = x7;
+    x0 = f[17];  x1 = f[49];  x2 = f[81];  x3 = f[113];
+    x4 = f[145];  x5 = f[177];  x6 = f[209];  x7 = f[241];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[17] = x0;  f[49] = x1;  f[81] = x2;  f[113] = x3;
+    f[145] = x4;  f[177] = x5;  f[209] = x6;  f[241] = x7;
+    x0 = f[18];  x1 = f[50];  x2 = f[82];  x3 = f[114];
+    x4 = f[146];  x5 = f[178];  x6 = f[210];  x7 = f[242];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[18] = x0;  f[50] = x1;  f[82] = x2;  f[114] = x3;
+    f[146] = x4;  f[178] = x5;  f[210] = x6;  f[242] = x7;
+    x0 = f[19];  x1 = f[51];  x2 = f[83];  x3 = f[115];
+    x4 = f[147];  x5 = f[179];  x6 = f[211];  x7 = f[243];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[19] = x0;  f[51] = x1;  f[83] = x2;  f[115] = x3;
+    f[147] = x4;  f[179] = x5;  f[211] = x6;  f[243] = x7;
+    x0 = f[20];  x1 = f[52];  x2 = f[84];  x3 = f[116];
+    x4 = f[148];  x5 = f[180];  x6 = f[212];  x7 = f[244];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[20] = x0;  f[52] = x1;  f[84] = x2;  f[116] = x3;
+    f[148] = x4;  f[180] = x5;  f[212] = x6;  f[244] = x7;
+    x0 = f[21];  x1 = f[53];  x2 = f[85];  x3 = f[117];
+    x4 = f[149];  x5 = f[181];  x6 = f[213];  x7 = f[245];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[21] = x0;  f[53] = x1;  f[85] = x2;  f[117] = x3;
+    f[149] = x4;  f[181] = x5;  f[213] = x6;  f[245] = x7;
+    x0 = f[22];  x1 = f[54];  x2 = f[86];  x3 = f[118];
+    x4 = f[150];  x5 = f[182];  x6 = f[214];  x7 = f[246];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[22] = x0;  f[54] = x1;  f[86] = x2;  f[118] = x3;
+    f[150] = x4;  f[182] = x5;  f[214] = x6;  f[246] = x7;
+    x0 = f[23];  x1 = f[55];  x2 = f[87];  x3 = f[119];
+    x4 = f[151];  x5 = f[183];  x6 = f[215];  x7 = f[247];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[23] = x0;  f[55] = x1;  f[87] = x2;  f[119] = x3;
+    f[151] = x4;  f[183] = x5;  f[215] = x6;  f[247] = x7;
+    x0 = f[24];  x1 = f[56];  x2 = f[88];  x3 = f[120];
+    x4 = f[152];  x5 = f[184];  x6 = f[216];  x7 = f[248];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[24] = x0;  f[56] = x1;  f[88] = x2;  f[120] = x3;
+    f[152] = x4;  f[184] = x5;  f[216] = x6;  f[248] = x7;
+    x0 = f[25];  x1 = f[57];  x2 = f[89];  x3 = f[121];
+    x4 = f[153];  x5 = f[185];  x6 = f[217];  x7 = f[249];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[25] = x0;  f[57] = x1;  f[89] = x2;  f[121] = x3;
+    f[153] = x4;  f[185] = x5;  f[217] = x6;  f[249] = x7;
+    x0 = f[26];  x1 = f[58];  x2 = f[90];  x3 = f[122];
+    x4 = f[154];  x5 = f[186];  x6 = f[218];  x7 = f[250];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[26] = x0;  f[58] = x1;  f[90] = x2;  f[122] = x3;
+    f[154] = x4;  f[186] = x5;  f[218] = x6;  f[250] = x7;
+    x0 = f[27];  x1 = f[59];  x2 = f[91];  x3 = f[123];
+    x4 = f[155];  x5 = f[187];  x6 = f[219];  x7 = f[251];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[27] = x0;  f[59] = x1;  f[91] = x2;  f[123] = x3;
+    f[155] = x4;  f[187] = x5;  f[219] = x6;  f[251] = x7;
+    x0 = f[28];  x1 = f[60];  x2 = f[92];  x3 = f[124];
+    x4 = f[156];  x5 = f[188];  x6 = f[220];  x7 = f[252];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[28] = x0;  f[60] = x1;  f[92] = x2;  f[124] = x3;
+    f[156] = x4;  f[188] = x5;  f[220] = x6;  f[252] = x7;
+    x0 = f[29];  x1 = f[61];  x2 = f[93];  x3 = f[125];
+    x4 = f[157];  x5 = f[189];  x6 = f[221];  x7 = f[253];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[29] = x0;  f[61] = x1;  f[93] = x2;  f[125] = x3;
+    f[157] = x4;  f[189] = x5;  f[221] = x6;  f[253] = x7;
+    x0 = f[30];  x1 = f[62];  x2 = f[94];  x3 = f[126];
+    x4 = f[158];  x5 = f[190];  x6 = f[222];  x7 = f[254];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[30] = x0;  f[62] = x1;  f[94] = x2;  f[126] = x3;
+    f[158] = x4;  f[190] = x5;  f[222] = x6;  f[254] = x7;
+    x0 = f[31];  x1 = f[63];  x2 = f[95];  x3 = f[127];
+    x4 = f[159];  x5 = f[191];  x6 = f[223];  x7 = f[255];
+    y = x1 - x0;  x0 = mont_red1(x0 + x1);  x1 = mont_mulq(y, 10764447);
+    y = x3 - x2;  x2 = mont_red1(x2 + x3);  x3 = mont_mulq(y, 19493511);
+    y = x5 - x4;  x4 = mont_red1(x4 + x5);  x5 = mont_mulq(y, 9265027);
+    y = x7 - x6;  x6 = mont_red1(x6 + x7);  x7 = mont_mulq(y, 5611999);
+    y = x2 - x0;  x0 = mont_red1(x0 + x2);  x2 = mont_mulq(y, 20051184);
+    y = x3 - x1;  x1 = mont_red1(x1 + x3);  x3 = mont_mulq(y, 20051184);
+    y = x6 - x4;  x4 = mont_red1(x4 + x6);  x6 = mont_mulq(y, 11611772);
+    y = x7 - x5;  x5 = mont_red1(x5 + x7);  x7 = mont_mulq(y, 11611772);
+    y = x4 - x0;  x0 = mont_cadd(mont_mulq(x0 + x4, MONT_DI));
+    x4 = mont_cadd(mont_mulq(y, 17091706));
+    y = x5 - x1;  x1 = mont_cadd(mont_mulq(x1 + x5, MONT_DI));
+    x5 = mont_cadd(mont_mulq(y, 17091706));
+    y = x6 - x2;  x2 = mont_cadd(mont_mulq(x2 + x6, MONT_DI));
+    x6 = mont_cadd(mont_mulq(y, 17091706));
+    y = x7 - x3;  x3 = mont_cadd(mont_mulq(x3 + x7, MONT_DI));
+    x7 = mont_cadd(mont_mulq(y, 17091706));
+    f[31] = x0;  f[63] = x1;  f[95] = x2;  f[127] = x3;
+    f[159] = x4;  f[191] = x5;  f[223] = x6;  f[255] = x7;
+}
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+//  mont_mulq(), mont_red1(), mont_cadd() on 8 lanes
+
+#ifdef MM_RED_SPQ
+
+//  x * QI mod 2^32 (low lanes), QI = 2^24 - 2^12 - 1
+
+static inline __m256i mulqi_x8(__m256i x)
+{
+    return _mm256_sub_epi32(_mm256_sub_epi32(_mm256_slli_epi32(x, 24),
+                            _mm256_slli_epi32(x, 12)), x);
+}
+
+//  x = h * 2^25 + l  ->  l + h * (2^12 - 1)
+
+static inline __m256i red1_x8(__m256i x)
+{
+    __m256i h;
+
+    h = _mm256_srai_epi32(x, MONT_LOGQ);
+    x = _mm256_and_si256(x, _mm256_set1_epi32((1 << MONT_LOGQ) - 1));
+    return _mm256_sub_epi32(_mm256_add_epi32(x, _mm256_slli_epi32(h, 12)), h);
+}
+
+#else
+
+//  x * QI mod 2^32 (low lanes)
+
+static inline __m256i mulqi_x8(__m256i x)
+{
+    return _mm256_mullo_epi32(x, _mm256_set1_epi32(MONT_QI));
+}
+
+static inline __m256i red1_x8(__m256i x)
+{
+    return _mm256_sub_epi32(x, _mm256_mullo_epi32(_mm256_srai_epi32(x,
+                            MONT_LOGQ), _mm256_set1_epi32(MONT_Q)));
+}
+
+#endif
+
+static inline __m256i mulq_x8(__m256i x, __m256i y)
+{
+    const __m256i q = _mm256_set1_epi32(MONT_Q);
+    __m256i e, o;
+
+    //  64-bit x * y + ((int32_t) (x * y) * QI) * q, even and odd lanes
+    e = _mm256_mul_epi32(x, y);
+    e = _mm256_add_epi64(e, _mm256_mul_epi32(mulqi_x8(e), q));
+    o = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32));
+    o = _mm256_add_epi64(o, _mm256_mul_epi32(mulqi_x8(o), q));
+
+    return _mm256_blend_epi32(_mm256_srli_epi64(e, 32), o, 0xAA);
+}
+
+static inline __m256i cadd_x8(__m256i x)
+{
+    return _mm256_add_epi32(x, _mm256_and_si256(_mm256_srai_epi32(x, 31),
+                            _mm256_set1_epi32(MONT_Q)));
+}
+
+//  Forward NTT, as polyr_fntt().
+
+static inline void ntt_gen_fwd_x8(int32_t *f)
+{
+    __m256i *v = (__m256i *) f;
+    __m256i x0, x1, x2, x3, x4, x5, x6, x7;
+    __m256i y, a, b, lo, hi;
+
+    x0 = _mm256_loadu_si256(v + 0);  x1 = _mm256_loadu_si256(v + 4);
+    x2 = _mm256_loadu_si256(v + 8);  x3 = _mm256_loadu_si256(v + 12);
+    x4 = _mm256_loadu_si256(v + 16);  x5 = _mm256_loadu_si256(v + 20);
+    x6 = _mm256_loadu_si256(v + 24);  x7 = _mm256_loadu_si256(v + 28);
+    y = mulq_x8(x4, _mm256_set1_epi32(6759380));
+    x4 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(6759380));
+    x5 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(6759380));
+    x6 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(6759380));
+    x7 = _mm256_sub_epi32(x3, y);  x3 = _mm256_add_epi32(x3, y);
+    y = mulq_x8(x2, _mm256_set1_epi32(11611772));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(11611772));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(20051184));
+    x6 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(20051184));
+    x7 = _mm256_sub_epi32(x5, y);  x5 = _mm256_add_epi32(x5, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(5611999));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(9265027));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(19493511));
+    x5 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(10764447));
+    x7 = _mm256_sub_epi32(x6, y);  x6 = _mm256_add_epi32(x6, y);
+    _mm256_storeu_si256(v + 0, x0);  _mm256_storeu_si256(v + 4, x1);
+    _mm256_storeu_si256(v + 8, x2);  _mm256_storeu_si256(v + 12, x3);
+    _mm256_storeu_si256(v + 16, x4);  _mm256_storeu_si256(v + 20, x5);
+    _mm256_storeu_si256(v + 24, x6);  _mm256_storeu_si256(v + 28, x7);
+    x0 = _mm256_loadu_si256(v + 1);  x1 = _mm256_loadu_si256(v + 5);
+    x2 = _mm256_loadu_si256(v + 9);  x3 = _mm256_loadu_si256(v + 13);
+    x4 = _mm256_loadu_si256(v + 17);  x5 = _mm256_loadu_si256(v + 21);
+    x6 = _mm256_loadu_si256(v + 25);  x7 = _mm256_loadu_si256(v + 29);
+    y = mulq_x8(x4, _mm256_set1_epi32(6759380));
+    x4 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(6759380));
+    x5 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(6759380));
+    x6 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(6759380));
+    x7 = _mm256_sub_epi32(x3, y);  x3 = _mm256_add_epi32(x3, y);
+    y = mulq_x8(x2, _mm256_set1_epi32(11611772));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(11611772));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(20051184));
+    x6 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(20051184));
+    x7 = _mm256_sub_epi32(x5, y);  x5 = _mm256_add_epi32(x5, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(5611999));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(9265027));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(19493511));
+    x5 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(10764447));
+    x7 = _mm256_sub_epi32(x6, y);  x6 = _mm256_add_epi32(x6, y);
+    _mm256_storeu_si256(v + 1, x0);  _mm256_storeu_si256(v + 5, x1);
+    _mm256_storeu_si256(v + 9, x2);  _mm256_storeu_si256(v + 13, x3);
+    _mm256_storeu_si256(v + 17, x4);  _mm256_storeu_si256(v + 21, x5);
+    _mm256_storeu_si256(v + 25, x6);  _mm256_storeu_si256(v + 29, x7);
+    x0 = _mm256_loadu_si256(v + 2);  x1 = _mm256_loadu_si256(v + 6);
+    x2 = _mm256_loadu_si256(v + 10);  x3 = _mm256_loadu_si256(v + 14);
+    x4 = _mm256_loadu_si256(v + 18);  x5 = _mm256_loadu_si256(v + 22);
+    x6 = _mm256_loadu_si256(v + 26);  x7 = _mm256_loadu_si256(v + 30);
+    y = mulq_x8(x4, _mm256_set1_epi32(6759380));
+    x4 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(6759380));
+    x5 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(6759380));
+    x6 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(6759380));
+    x7 = _mm256_sub_epi32(x3, y);  x3 = _mm256_add_epi32(x3, y);
+    y = mulq_x8(x2, _mm256_set1_epi32(11611772));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(11611772));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(20051184));
+    x6 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(20051184));
+    x7 = _mm256_sub_epi32(x5, y);  x5 = _mm256_add_epi32(x5, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(5611999));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(9265027));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(19493511));
+    x5 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(10764447));
+    x7 = _mm256_sub_epi32(x6, y);  x6 = _mm256_add_epi32(x6, y);
+    _mm256_storeu_si256(v + 2, x0);  _mm256_storeu_si256(v + 6, x1);
+    _mm256_storeu_si256(v + 10, x2);  _mm256_storeu_si256(v + 14, x3);
+    _mm256_storeu_si256(v + 18, x4);  _mm256_storeu_si256(v + 22, x5);
+    _mm256_storeu_si256(v + 26, x6);  _mm256_storeu_si256(v + 30, x7);
+    x0 = _mm256_loadu_si256(v + 3);  x1 = _mm256_loadu_si256(v + 7);
+    x2 = _mm256_loadu_si256(v + 11);  x3 = _mm256_loadu_si256(v + 15);
+    x4 = _mm256_loadu_si256(v + 19);  x5 = _mm256_loadu_si256(v + 23);
+    x6 = _mm256_loadu_si256(v + 27);  x7 = _mm256_loadu_si256(v + 31);
+    y = mulq_x8(x4, _mm256_set1_epi32(6759380));
+    x4 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(6759380));
+    x5 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(6759380));
+    x6 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(6759380));
+    x7 = _mm256_sub_epi32(x3, y);  x3 = _mm256_add_epi32(x3, y);
+    y = mulq_x8(x2, _mm256_set1_epi32(11611772));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(11611772));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x6, _mm256_set1_epi32(20051184));
+    x6 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(20051184));
+    x7 = _mm256_sub_epi32(x5, y);  x5 = _mm256_add_epi32(x5, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(5611999));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(9265027));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    y = mulq_x8(x5, _mm256_set1_epi32(19493511));
+    x5 = _mm256_sub_epi32(x4, y);  x4 = _mm256_add_epi32(x4, y);
+    y = mulq_x8(x7, _mm256_set1_epi32(10764447));
+    x7 = _mm256_sub_epi32(x6, y);  x6 = _mm256_add_epi32(x6, y);
+    _mm256_storeu_si256(v + 3, x0);  _mm256_storeu_si256(v + 7, x1);
+    _mm256_storeu_si256(v + 11, x2);  _mm256_storeu_si256(v + 15, x3);
+    _mm256_storeu_si256(v + 19, x4);  _mm256_storeu_si256(v + 23, x5);
+    _mm256_storeu_si256(v + 27, x6);  _mm256_storeu_si256(v + 31, x7);
+    x0 = _mm256_loadu_si256(v + 0);  x1 = _mm256_loadu_si256(v + 1);
+    x2 = _mm256_loadu_si256(v + 2);  x3 = _mm256_loadu_si256(v + 3);
+    y = mulq_x8(x2, _mm256_set1_epi32(24000204));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(24000204));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(28206570));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(15280732));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 0, x0);  _mm256_storeu_si256(v + 1, x1);
+    _mm256_storeu_si256(v + 2, x2);  _mm256_storeu_si256(v + 3, x3);
+    x0 = _mm256_loadu_si256(v + 4);  x1 = _mm256_loadu_si256(v + 5);
+    x2 = _mm256_loadu_si256(v + 6);  x3 = _mm256_loadu_si256(v + 7);
+    y = mulq_x8(x2, _mm256_set1_epi32(6177812));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(6177812));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(17354707));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(12498775));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 4, x0);  _mm256_storeu_si256(v + 5, x1);
+    _mm256_storeu_si256(v + 6, x2);  _mm256_storeu_si256(v + 7, x3);
+    x0 = _mm256_loadu_si256(v + 8);  x1 = _mm256_loadu_si256(v + 9);
+    x2 = _mm256_loadu_si256(v + 10);  x3 = _mm256_loadu_si256(v + 11);
+    y = mulq_x8(x2, _mm256_set1_epi32(32900457));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(32900457));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(18285219));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(30499698));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 8, x0);  _mm256_storeu_si256(v + 9, x1);
+    _mm256_storeu_si256(v + 10, x2);  _mm256_storeu_si256(v + 11, x3);
+    x0 = _mm256_loadu_si256(v + 12);  x1 = _mm256_loadu_si256(v + 13);
+    x2 = _mm256_loadu_si256(v + 14);  x3 = _mm256_loadu_si256(v + 15);
+    y = mulq_x8(x2, _mm256_set1_epi32(32410281));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(32410281));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(12450192));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(5644069));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 12, x0);  _mm256_storeu_si256(v + 13, x1);
+    _mm256_storeu_si256(v + 14, x2);  _mm256_storeu_si256(v + 15, x3);
+    x0 = _mm256_loadu_si256(v + 16);  x1 = _mm256_loadu_si256(v + 17);
+    x2 = _mm256_loadu_si256(v + 18);  x3 = _mm256_loadu_si256(v + 19);
+    y = mulq_x8(x2, _mm256_set1_epi32(23400652));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(23400652));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(11930096));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(17535208));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 16, x0);  _mm256_storeu_si256(v + 17, x1);
+    _mm256_storeu_si256(v + 18, x2);  _mm256_storeu_si256(v + 19, x3);
+    x0 = _mm256_loadu_si256(v + 20);  x1 = _mm256_loadu_si256(v + 21);
+    x2 = _mm256_loadu_si256(v + 22);  x3 = _mm256_loadu_si256(v + 23);
+    y = mulq_x8(x2, _mm256_set1_epi32(3198144));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(3198144));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(32021213));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(28870577));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 20, x0);  _mm256_storeu_si256(v + 21, x1);
+    _mm256_storeu_si256(v + 22, x2);  _mm256_storeu_si256(v + 23, x3);
+    x0 = _mm256_loadu_si256(v + 24);  x1 = _mm256_loadu_si256(v + 25);
+    x2 = _mm256_loadu_si256(v + 26);  x3 = _mm256_loadu_si256(v + 27);
+    y = mulq_x8(x2, _mm256_set1_epi32(2200199));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(2200199));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(16657861));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(32738467));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 24, x0);  _mm256_storeu_si256(v + 25, x1);
+    _mm256_storeu_si256(v + 26, x2);  _mm256_storeu_si256(v + 27, x3);
+    x0 = _mm256_loadu_si256(v + 28);  x1 = _mm256_loadu_si256(v + 29);
+    x2 = _mm256_loadu_si256(v + 30);  x3 = _mm256_loadu_si256(v + 31);
+    y = mulq_x8(x2, _mm256_set1_epi32(24124141));
+    x2 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(24124141));
+    x3 = _mm256_sub_epi32(x1, y);  x1 = _mm256_add_epi32(x1, y);
+    y = mulq_x8(x1, _mm256_set1_epi32(28138468));
+    x1 = _mm256_sub_epi32(x0, y);  x0 = _mm256_add_epi32(x0, y);
+    y = mulq_x8(x3, _mm256_set1_epi32(33049270));
+    x3 = _mm256_sub_epi32(x2, y);  x2 = _mm256_add_epi32(x2, y);
+    _mm256_storeu_si256(v + 28, x0);  _mm256_storeu_si256(v + 29, x1);
+    _mm256_storeu_si256(v + 30, x2);  _mm256_storeu_si256(v + 31, x3);
+    a = _mm256_loadu_si256(v + 0);  b = _mm256_loadu_si256(v + 1);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            3925647, 3925647, 3925647, 3925647,
+            22891714, 22891714, 22891714, 22891714));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            29787612, 29787612, 11189900, 11189900,
+            7503285, 7503285, 31631832, 31631832));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            33073869, 8792503, 7192988, 29800114,
+            17918503, 10321733, 26258901, 31299552));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 0, a);  _mm256_storeu_si256(v + 1, b);
+    a = _mm256_loadu_si256(v + 2);  b = _mm256_loadu_si256(v + 3);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            32084204, 32084204, 32084204, 32084204,
+            20016426, 20016426, 20016426, 20016426));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            5860566, 5860566, 28381447, 28381447,
+            10986757, 10986757, 30095497, 30095497));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            27332300, 32966155, 23321992, 12553039,
+            12276016, 10730693, 24560419, 8395453));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 2, a);  _mm256_storeu_si256(v + 3, b);
+    a = _mm256_loadu_si256(v + 4);  b = _mm256_loadu_si256(v + 5);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            19793647, 19793647, 19793647, 19793647,
+            9217272, 9217272, 9217272, 9217272));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            6958801, 6958801, 274280, 274280,
+            20465111, 20465111, 27204547, 27204547));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            9254376, 7168707, 28613855, 20608463,
+            20172936, 14752366, 19639872, 350844));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 4, a);  _mm256_storeu_si256(v + 5, b);
+    a = _mm256_loadu_si256(v + 6);  b = _mm256_loadu_si256(v + 7);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            18447657, 18447657, 18447657, 18447657,
+            25090164, 25090164, 25090164, 25090164));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            1594993, 1594993, 11767139, 11767139,
+            13111549, 13111549, 10268342, 10268342));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            7143126, 5527986, 20006024, 4038243,
+            31109078, 5790148, 23863466, 5400208));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 6, a);  _mm256_storeu_si256(v + 7, b);
+    a = _mm256_loadu_si256(v + 8);  b = _mm256_loadu_si256(v + 9);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            17182522, 17182522, 17182522, 17182522,
+            23808311, 23808311, 23808311, 23808311));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            14317088, 14317088, 15944111, 15944111,
+            12984689, 12984689, 30813171, 30813171));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            32661754, 7865111, 11396388, 5957087,
+            22892358, 26801289, 24061947, 10088648));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 8, a);  _mm256_storeu_si256(v + 9, b);
+    a = _mm256_loadu_si256(v + 10);  b = _mm256_loadu_si256(v + 11);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            16908244, 16908244, 16908244, 16908244,
+            22122426, 22122426, 22122426, 22122426));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            2694593, 2694593, 6406585, 6406585,
+            26451815, 26451815, 20010985, 20010985));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            17583519, 17318481, 28710073, 23987117,
+            6137845, 22490456, 15764394, 27006783));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 10, a);  _mm256_storeu_si256(v + 11, b);
+    a = _mm256_loadu_si256(v + 12);  b = _mm256_loadu_si256(v + 13);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            17558876, 17558876, 17558876, 17558876,
+            22883012, 22883012, 22883012, 22883012));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            26966511, 26966511, 10350944, 10350944,
+            30969403, 30969403, 17755942, 17755942));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            17495707, 8448824, 21141507, 32554080,
+            15301221, 7050722, 15212341, 26202716));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 12, a);  _mm256_storeu_si256(v + 13, b);
+    a = _mm256_loadu_si256(v + 14);  b = _mm256_loadu_si256(v + 15);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            6983968, 6983968, 6983968, 6983968,
+            24272961, 24272961, 24272961, 24272961));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            31244694, 31244694, 15029351, 15029351,
+            16592269, 16592269, 31275530, 31275530));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            3544406, 5492562, 9331981, 23955081,
+            7467341, 15476051, 22876568, 26738484));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 14, a);  _mm256_storeu_si256(v + 15, b);
+    a = _mm256_loadu_si256(v + 16);  b = _mm256_loadu_si256(v + 17);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            875322, 875322, 875322, 875322,
+            18546326, 18546326, 18546326, 18546326));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            30598763, 30598763, 4158217, 4158217,
+            9444158, 9444158, 295408, 295408));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            18765598, 549280, 9821018, 16583057,
+            27900090, 28595224, 2391744, 2331434));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 16, a);  _mm256_storeu_si256(v + 17, b);
+    a = _mm256_loadu_si256(v + 18);  b = _mm256_loadu_si256(v + 19);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            6067746, 6067746, 6067746, 6067746,
+            24580770, 24580770, 24580770, 24580770));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            1312494, 1312494, 28382998, 28382998,
+            28869312, 28869312, 25119048, 25119048));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            32156118, 26379347, 10167038, 10798836,
+            28313524, 16811031, 29582106, 15015034));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 18, a);  _mm256_storeu_si256(v + 19, b);
+    a = _mm256_loadu_si256(v + 20);  b = _mm256_loadu_si256(v + 21);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            18170667, 18170667, 18170667, 18170667,
+            10496054, 10496054, 10496054, 10496054));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            21586133, 21586133, 971182, 971182,
+            2174608, 2174608, 16930314, 16930314));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            6681561, 3320266, 3493835, 26996082,
+            8152825, 28274051, 7409310, 1126043));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 20, a);  _mm256_storeu_si256(v + 21, b);
+    a = _mm256_loadu_si256(v + 22);  b = _mm256_loadu_si256(v + 23);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            15608693, 15608693, 15608693, 15608693,
+            2515533, 2515533, 2515533, 2515533));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            16089224, 16089224, 25578586, 25578586,
+            33164555, 33164555, 11520949, 11520949));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            24105137, 21309313, 20985077, 33504217,
+            1340079, 18429480, 25114323, 7283953));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 22, a);  _mm256_storeu_si256(v + 23, b);
+    a = _mm256_loadu_si256(v + 24);  b = _mm256_loadu_si256(v + 25);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            44602, 44602, 44602, 44602,
+            10865068, 10865068, 10865068, 10865068));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            11902971, 11902971, 25622482, 25622482,
+            25958325, 25958325, 5788647, 5788647));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            23346277, 1993842, 11970518, 5882189,
+            23696636, 890780, 32328326, 6581391));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 24, a);  _mm256_storeu_si256(v + 25, b);
+    a = _mm256_loadu_si256(v + 26);  b = _mm256_loadu_si256(v + 27);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            23754885, 23754885, 23754885, 23754885,
+            12096975, 12096975, 12096975, 12096975));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            1512189, 1512189, 33548073, 33548073,
+            23129892, 23129892, 33265110, 33265110));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            22682749, 21303665, 31118264, 21677573,
+            31075518, 5592919, 14228138, 11292275));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 26, a);  _mm256_storeu_si256(v + 27, b);
+    a = _mm256_loadu_si256(v + 28);  b = _mm256_loadu_si256(v + 29);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            16076627, 16076627, 16076627, 16076627,
+            9986178, 9986178, 9986178, 9986178));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            4757561, 4757561, 12394212, 12394212,
+            33361188, 33361188, 24969419, 24969419));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            16675504, 22854030, 31256330, 23926560,
+            1831143, 6911566, 29285890, 9587262));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 28, a);  _mm256_storeu_si256(v + 29, b);
+    a = _mm256_loadu_si256(v + 30);  b = _mm256_loadu_si256(v + 31);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            14086122, 14086122, 14086122, 14086122,
+            2292012, 2292012, 2292012, 2292012));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            29092517, 29092517, 27320357, 27320357,
+            24807116, 24807116, 356339, 356339));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = mulq_x8(hi, _mm256_setr_epi32(
+            18068068, 16494188, 24253081, 11613809,
+            8860636, 9193484, 32254537, 31413463));
+    hi = _mm256_sub_epi32(lo, y);  lo = _mm256_add_epi32(lo, y);
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    _mm256_storeu_si256(v + 30, a);  _mm256_storeu_si256(v + 31, b);
+}
+
+//  Reverse NTT with normalization; final vector k (coefficients 8k .. 8k+7)
+//  goes to out(k, x, arg) instead of "f".
+
+static XINLINE void ntt_gen_inv_out_x8(int32_t *f,
+                    void (*out)(int, __m256i, void *), void *arg)
+{
+    __m256i *v = (__m256i *) f;
+    __m256i x0, x1, x2, x3, x4, x5, x6, x7;
+    __m256i y, a, b, lo, hi;
+
+    a = _mm256_loadu_si256(v + 0);  b = _mm256_loadu_si256(v + 1);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            31413463, 32254537, 9193484, 8860636,
+            11613809, 24253081, 16494188, 18068068));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            356339, 356339, 24807116, 24807116,
+            27320357, 27320357, 29092517, 29092517));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            2292012, 2292012, 2292012, 2292012,
+            14086122, 14086122, 14086122, 14086122));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 0, a);  _mm256_storeu_si256(v + 1, b);
+    a = _mm256_loadu_si256(v + 2);  b = _mm256_loadu_si256(v + 3);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            9587262, 29285890, 6911566, 1831143,
+            23926560, 31256330, 22854030, 16675504));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            24969419, 24969419, 33361188, 33361188,
+            12394212, 12394212, 4757561, 4757561));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            9986178, 9986178, 9986178, 9986178,
+            16076627, 16076627, 16076627, 16076627));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 2, a);  _mm256_storeu_si256(v + 3, b);
+    a = _mm256_loadu_si256(v + 4);  b = _mm256_loadu_si256(v + 5);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            11292275, 14228138, 5592919, 31075518,
+            21677573, 31118264, 21303665, 22682749));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            33265110, 33265110, 23129892, 23129892,
+            33548073, 33548073, 1512189, 1512189));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            12096975, 12096975, 12096975, 12096975,
+            23754885, 23754885, 23754885, 23754885));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 4, a);  _mm256_storeu_si256(v + 5, b);
+    a = _mm256_loadu_si256(v + 6);  b = _mm256_loadu_si256(v + 7);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            6581391, 32328326, 890780, 23696636,
+            5882189, 11970518, 1993842, 23346277));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            5788647, 5788647, 25958325, 25958325,
+            25622482, 25622482, 11902971, 11902971));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            10865068, 10865068, 10865068, 10865068,
+            44602, 44602, 44602, 44602));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 6, a);  _mm256_storeu_si256(v + 7, b);
+    a = _mm256_loadu_si256(v + 8);  b = _mm256_loadu_si256(v + 9);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            7283953, 25114323, 18429480, 1340079,
+            33504217, 20985077, 21309313, 24105137));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            11520949, 11520949, 33164555, 33164555,
+            25578586, 25578586, 16089224, 16089224));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            2515533, 2515533, 2515533, 2515533,
+            15608693, 15608693, 15608693, 15608693));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 8, a);  _mm256_storeu_si256(v + 9, b);
+    a = _mm256_loadu_si256(v + 10);  b = _mm256_loadu_si256(v + 11);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            1126043, 7409310, 28274051, 8152825,
+            26996082, 3493835, 3320266, 6681561));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            16930314, 16930314, 2174608, 2174608,
+            971182, 971182, 21586133, 21586133));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            10496054, 10496054, 10496054, 10496054,
+            18170667, 18170667, 18170667, 18170667));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 10, a);  _mm256_storeu_si256(v + 11, b);
+    a = _mm256_loadu_si256(v + 12);  b = _mm256_loadu_si256(v + 13);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            15015034, 29582106, 16811031, 28313524,
+            10798836, 10167038, 26379347, 32156118));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            25119048, 25119048, 28869312, 28869312,
+            28382998, 28382998, 1312494, 1312494));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            24580770, 24580770, 24580770, 24580770,
+            6067746, 6067746, 6067746, 6067746));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 12, a);  _mm256_storeu_si256(v + 13, b);
+    a = _mm256_loadu_si256(v + 14);  b = _mm256_loadu_si256(v + 15);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            2331434, 2391744, 28595224, 27900090,
+            16583057, 9821018, 549280, 18765598));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            295408, 295408, 9444158, 9444158,
+            4158217, 4158217, 30598763, 30598763));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            18546326, 18546326, 18546326, 18546326,
+            875322, 875322, 875322, 875322));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 14, a);  _mm256_storeu_si256(v + 15, b);
+    a = _mm256_loadu_si256(v + 16);  b = _mm256_loadu_si256(v + 17);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            26738484, 22876568, 15476051, 7467341,
+            23955081, 9331981, 5492562, 3544406));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            31275530, 31275530, 16592269, 16592269,
+            15029351, 15029351, 31244694, 31244694));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            24272961, 24272961, 24272961, 24272961,
+            6983968, 6983968, 6983968, 6983968));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 16, a);  _mm256_storeu_si256(v + 17, b);
+    a = _mm256_loadu_si256(v + 18);  b = _mm256_loadu_si256(v + 19);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            26202716, 15212341, 7050722, 15301221,
+            32554080, 21141507, 8448824, 17495707));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            17755942, 17755942, 30969403, 30969403,
+            10350944, 10350944, 26966511, 26966511));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            22883012, 22883012, 22883012, 22883012,
+            17558876, 17558876, 17558876, 17558876));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 18, a);  _mm256_storeu_si256(v + 19, b);
+    a = _mm256_loadu_si256(v + 20);  b = _mm256_loadu_si256(v + 21);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            27006783, 15764394, 22490456, 6137845,
+            23987117, 28710073, 17318481, 17583519));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            20010985, 20010985, 26451815, 26451815,
+            6406585, 6406585, 2694593, 2694593));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            22122426, 22122426, 22122426, 22122426,
+            16908244, 16908244, 16908244, 16908244));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 20, a);  _mm256_storeu_si256(v + 21, b);
+    a = _mm256_loadu_si256(v + 22);  b = _mm256_loadu_si256(v + 23);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            10088648, 24061947, 26801289, 22892358,
+            5957087, 11396388, 7865111, 32661754));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            30813171, 30813171, 12984689, 12984689,
+            15944111, 15944111, 14317088, 14317088));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            23808311, 23808311, 23808311, 23808311,
+            17182522, 17182522, 17182522, 17182522));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 22, a);  _mm256_storeu_si256(v + 23, b);
+    a = _mm256_loadu_si256(v + 24);  b = _mm256_loadu_si256(v + 25);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            5400208, 23863466, 5790148, 31109078,
+            4038243, 20006024, 5527986, 7143126));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            10268342, 10268342, 13111549, 13111549,
+            11767139, 11767139, 1594993, 1594993));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            25090164, 25090164, 25090164, 25090164,
+            18447657, 18447657, 18447657, 18447657));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 24, a);  _mm256_storeu_si256(v + 25, b);
+    a = _mm256_loadu_si256(v + 26);  b = _mm256_loadu_si256(v + 27);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            350844, 19639872, 14752366, 20172936,
+            20608463, 28613855, 7168707, 9254376));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            27204547, 27204547, 20465111, 20465111,
+            274280, 274280, 6958801, 6958801));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            9217272, 9217272, 9217272, 9217272,
+            19793647, 19793647, 19793647, 19793647));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 26, a);  _mm256_storeu_si256(v + 27, b);
+    a = _mm256_loadu_si256(v + 28);  b = _mm256_loadu_si256(v + 29);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            8395453, 24560419, 10730693, 12276016,
+            12553039, 23321992, 32966155, 27332300));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            30095497, 30095497, 10986757, 10986757,
+            28381447, 28381447, 5860566, 5860566));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            20016426, 20016426, 20016426, 20016426,
+            32084204, 32084204, 32084204, 32084204));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 28, a);  _mm256_storeu_si256(v + 29, b);
+    a = _mm256_loadu_si256(v + 30);  b = _mm256_loadu_si256(v + 31);
+    a = _mm256_shuffle_epi32(a, 0xD8);  b = _mm256_shuffle_epi32(b, 0xD8);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            31299552, 26258901, 10321733, 17918503,
+            29800114, 7192988, 8792503, 33073869));
+    a = _mm256_unpacklo_epi32(lo, hi);
+    b = _mm256_unpackhi_epi32(lo, hi);
+    lo = _mm256_unpacklo_epi64(a, b);
+    hi = _mm256_unpackhi_epi64(a, b);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            31631832, 31631832, 7503285, 7503285,
+            11189900, 11189900, 29787612, 29787612));
+    a = _mm256_unpacklo_epi64(lo, hi);
+    b = _mm256_unpackhi_epi64(lo, hi);
+    lo = _mm256_permute2x128_si256(a, b, 0x20);
+    hi = _mm256_permute2x128_si256(a, b, 0x31);
+    y = _mm256_sub_epi32(hi, lo);  lo = red1_x8(_mm256_add_epi32(lo, hi));
+    hi = mulq_x8(y, _mm256_setr_epi32(
+            22891714, 22891714, 22891714, 22891714,
+            3925647, 3925647, 3925647, 3925647));
+    a = _mm256_permute2x128_si256(lo, hi, 0x20);
+    b = _mm256_permute2x128_si256(lo, hi, 0x31);
+    _mm256_storeu_si256(v + 30, a);  _mm256_storeu_si256(v + 31, b);
+    x0 = _mm256_loadu_si256(v + 0);  x1 = _mm256_loadu_si256(v + 1);
+    x2 = _mm256_loadu_si256(v + 2);  x3 = _mm256_loadu_si256(v + 3);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(33049270));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(28138468));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(24124141));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(24124141));
+    _mm256_storeu_si256(v + 0, x0);  _mm256_storeu_si256(v + 1, x1);
+    _mm256_storeu_si256(v + 2, x2);  _mm256_storeu_si256(v + 3, x3);
+    x0 = _mm256_loadu_si256(v + 4);  x1 = _mm256_loadu_si256(v + 5);
+    x2 = _mm256_loadu_si256(v + 6);  x3 = _mm256_loadu_si256(v + 7);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(32738467));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(16657861));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(2200199));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(2200199));
+    _mm256_storeu_si256(v + 4, x0);  _mm256_storeu_si256(v + 5, x1);
+    _mm256_storeu_si256(v + 6, x2);  _mm256_storeu_si256(v + 7, x3);
+    x0 = _mm256_loadu_si256(v + 8);  x1 = _mm256_loadu_si256(v + 9);
+    x2 = _mm256_loadu_si256(v + 10);  x3 = _mm256_loadu_si256(v + 11);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(28870577));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(32021213));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(3198144));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(3198144));
+    _mm256_storeu_si256(v + 8, x0);  _mm256_storeu_si256(v + 9, x1);
+    _mm256_storeu_si256(v + 10, x2);  _mm256_storeu_si256(v + 11, x3);
+    x0 = _mm256_loadu_si256(v + 12);  x1 = _mm256_loadu_si256(v + 13);
+    x2 = _mm256_loadu_si256(v + 14);  x3 = _mm256_loadu_si256(v + 15);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(17535208));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(11930096));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(23400652));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(23400652));
+    _mm256_storeu_si256(v + 12, x0);  _mm256_storeu_si256(v + 13, x1);
+    _mm256_storeu_si256(v + 14, x2);  _mm256_storeu_si256(v + 15, x3);
+    x0 = _mm256_loadu_si256(v + 16);  x1 = _mm256_loadu_si256(v + 17);
+    x2 = _mm256_loadu_si256(v + 18);  x3 = _mm256_loadu_si256(v + 19);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(5644069));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(12450192));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(32410281));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(32410281));
+    _mm256_storeu_si256(v + 16, x0);  _mm256_storeu_si256(v + 17, x1);
+    _mm256_storeu_si256(v + 18, x2);  _mm256_storeu_si256(v + 19, x3);
+    x0 = _mm256_loadu_si256(v + 20);  x1 = _mm256_loadu_si256(v + 21);
+    x2 = _mm256_loadu_si256(v + 22);  x3 = _mm256_loadu_si256(v + 23);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(30499698));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(18285219));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(32900457));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(32900457));
+    _mm256_storeu_si256(v + 20, x0);  _mm256_storeu_si256(v + 21, x1);
+    _mm256_storeu_si256(v + 22, x2);  _mm256_storeu_si256(v + 23, x3);
+    x0 = _mm256_loadu_si256(v + 24);  x1 = _mm256_loadu_si256(v + 25);
+    x2 = _mm256_loadu_si256(v + 26);  x3 = _mm256_loadu_si256(v + 27);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(12498775));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(17354707));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(6177812));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(6177812));
+    _mm256_storeu_si256(v + 24, x0);  _mm256_storeu_si256(v + 25, x1);
+    _mm256_storeu_si256(v + 26, x2);  _mm256_storeu_si256(v + 27, x3);
+    x0 = _mm256_loadu_si256(v + 28);  x1 = _mm256_loadu_si256(v + 29);
+    x2 = _mm256_loadu_si256(v + 30);  x3 = _mm256_loadu_si256(v + 31);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(15280732));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(28206570));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(24000204));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(24000204));
+    _mm256_storeu_si256(v + 28, x0);  _mm256_storeu_si256(v + 29, x1);
+    _mm256_storeu_si256(v + 30, x2);  _mm256_storeu_si256(v + 31, x3);
+    x0 = _mm256_loadu_si256(v + 0);  x1 = _mm256_loadu_si256(v + 4);
+    x2 = _mm256_loadu_si256(v + 8);  x3 = _mm256_loadu_si256(v + 12);
+    x4 = _mm256_loadu_si256(v + 16);  x5 = _mm256_loadu_si256(v + 20);
+    x6 = _mm256_loadu_si256(v + 24);  x7 = _mm256_loadu_si256(v + 28);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(10764447));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(19493511));
+    y = _mm256_sub_epi32(x5, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x5));
+    x5 = mulq_x8(y, _mm256_set1_epi32(9265027));
+    y = _mm256_sub_epi32(x7, x6);
+    x6 = red1_x8(_mm256_add_epi32(x6, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(5611999));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x6, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x6));
+    x6 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x7, x5);
+    x5 = red1_x8(_mm256_add_epi32(x5, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x4, x0);
+    x0 = cadd_x8(mulq_x8(_mm256_add_epi32(x0, x4), _mm256_set1_epi32(MONT_DI)));
+    x4 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x5, x1);
+    x1 = cadd_x8(mulq_x8(_mm256_add_epi32(x1, x5), _mm256_set1_epi32(MONT_DI)));
+    x5 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x6, x2);
+    x2 = cadd_x8(mulq_x8(_mm256_add_epi32(x2, x6), _mm256_set1_epi32(MONT_DI)));
+    x6 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x7, x3);
+    x3 = cadd_x8(mulq_x8(_mm256_add_epi32(x3, x7), _mm256_set1_epi32(MONT_DI)));
+    x7 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    out(0, x0, arg);  out(4, x1, arg);  out(8, x2, arg);  out(12, x3, arg);
+    out(16, x4, arg);  out(20, x5, arg);  out(24, x6, arg);  out(28, x7, arg);
+    x0 = _mm256_loadu_si256(v + 1);  x1 = _mm256_loadu_si256(v + 5);
+    x2 = _mm256_loadu_si256(v + 9);  x3 = _mm256_loadu_si256(v + 13);
+    x4 = _mm256_loadu_si256(v + 17);  x5 = _mm256_loadu_si256(v + 21);
+    x6 = _mm256_loadu_si256(v + 25);  x7 = _mm256_loadu_si256(v + 29);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(10764447));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(19493511));
+    y = _mm256_sub_epi32(x5, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x5));
+    x5 = mulq_x8(y, _mm256_set1_epi32(9265027));
+    y = _mm256_sub_epi32(x7, x6);
+    x6 = red1_x8(_mm256_add_epi32(x6, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(5611999));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x6, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x6));
+    x6 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x7, x5);
+    x5 = red1_x8(_mm256_add_epi32(x5, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x4, x0);
+    x0 = cadd_x8(mulq_x8(_mm256_add_epi32(x0, x4), _mm256_set1_epi32(MONT_DI)));
+    x4 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x5, x1);
+    x1 = cadd_x8(mulq_x8(_mm256_add_epi32(x1, x5), _mm256_set1_epi32(MONT_DI)));
+    x5 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x6, x2);
+    x2 = cadd_x8(mulq_x8(_mm256_add_epi32(x2, x6), _mm256_set1_epi32(MONT_DI)));
+    x6 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x7, x3);
+    x3 = cadd_x8(mulq_x8(_mm256_add_epi32(x3, x7), _mm256_set1_epi32(MONT_DI)));
+    x7 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    out(1, x0, arg);  out(5, x1, arg);  out(9, x2, arg);  out(13, x3, arg);
+    out(17, x4, arg);  out(21, x5, arg);  out(25, x6, arg);  out(29, x7, arg);
+    x0 = _mm256_loadu_si256(v + 2);  x1 = _mm256_loadu_si256(v + 6);
+    x2 = _mm256_loadu_si256(v + 10);  x3 = _mm256_loadu_si256(v + 14);
+    x4 = _mm256_loadu_si256(v + 18);  x5 = _mm256_loadu_si256(v + 22);
+    x6 = _mm256_loadu_si256(v + 26);  x7 = _mm256_loadu_si256(v + 30);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(10764447));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(19493511));
+    y = _mm256_sub_epi32(x5, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x5));
+    x5 = mulq_x8(y, _mm256_set1_epi32(9265027));
+    y = _mm256_sub_epi32(x7, x6);
+    x6 = red1_x8(_mm256_add_epi32(x6, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(5611999));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x6, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x6));
+    x6 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x7, x5);
+    x5 = red1_x8(_mm256_add_epi32(x5, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x4, x0);
+    x0 = cadd_x8(mulq_x8(_mm256_add_epi32(x0, x4), _mm256_set1_epi32(MONT_DI)));
+    x4 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x5, x1);
+    x1 = cadd_x8(mulq_x8(_mm256_add_epi32(x1, x5), _mm256_set1_epi32(MONT_DI)));
+    x5 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x6, x2);
+    x2 = cadd_x8(mulq_x8(_mm256_add_epi32(x2, x6), _mm256_set1_epi32(MONT_DI)));
+    x6 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x7, x3);
+    x3 = cadd_x8(mulq_x8(_mm256_add_epi32(x3, x7), _mm256_set1_epi32(MONT_DI)));
+    x7 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    out(2, x0, arg);  out(6, x1, arg);  out(10, x2, arg);  out(14, x3, arg);
+    out(18, x4, arg);  out(22, x5, arg);  out(26, x6, arg);  out(30, x7, arg);
+    x0 = _mm256_loadu_si256(v + 3);  x1 = _mm256_loadu_si256(v + 7);
+    x2 = _mm256_loadu_si256(v + 11);  x3 = _mm256_loadu_si256(v + 15);
+    x4 = _mm256_loadu_si256(v + 19);  x5 = _mm256_loadu_si256(v + 23);
+    x6 = _mm256_loadu_si256(v + 27);  x7 = _mm256_loadu_si256(v + 31);
+    y = _mm256_sub_epi32(x1, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x1));
+    x1 = mulq_x8(y, _mm256_set1_epi32(10764447));
+    y = _mm256_sub_epi32(x3, x2);
+    x2 = red1_x8(_mm256_add_epi32(x2, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(19493511));
+    y = _mm256_sub_epi32(x5, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x5));
+    x5 = mulq_x8(y, _mm256_set1_epi32(9265027));
+    y = _mm256_sub_epi32(x7, x6);
+    x6 = red1_x8(_mm256_add_epi32(x6, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(5611999));
+    y = _mm256_sub_epi32(x2, x0);
+    x0 = red1_x8(_mm256_add_epi32(x0, x2));
+    x2 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x3, x1);
+    x1 = red1_x8(_mm256_add_epi32(x1, x3));
+    x3 = mulq_x8(y, _mm256_set1_epi32(20051184));
+    y = _mm256_sub_epi32(x6, x4);
+    x4 = red1_x8(_mm256_add_epi32(x4, x6));
+    x6 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x7, x5);
+    x5 = red1_x8(_mm256_add_epi32(x5, x7));
+    x7 = mulq_x8(y, _mm256_set1_epi32(11611772));
+    y = _mm256_sub_epi32(x4, x0);
+    x0 = cadd_x8(mulq_x8(_mm256_add_epi32(x0, x4), _mm256_set1_epi32(MONT_DI)));
+    x4 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x5, x1);
+    x1 = cadd_x8(mulq_x8(_mm256_add_epi32(x1, x5), _mm256_set1_epi32(MONT_DI)));
+    x5 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x6, x2);
+    x2 = cadd_x8(mulq_x8(_mm256_add_epi32(x2, x6), _mm256_set1_epi32(MONT_DI)));
+    x6 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    y = _mm256_sub_epi32(x7, x3);
+    x3 = cadd_x8(mulq_x8(_mm256_add_epi32(x3, x7), _mm256_set1_epi32(MONT_DI)));
+    x7 = cadd_x8(mulq_x8(y, _mm256_set1_epi32(17091706)));
+    out(3, x0, arg);  out(7, x1, arg);  out(11, x2, arg);  out(15, x3, arg);
+    out(19, x4, arg);  out(23, x5, arg);  out(27, x6, arg);  out(31, x7, arg);
+}
+
+static XINLINE void ntt_gen_st_x8(int k, __m256i x, void *arg)
+{
+    _mm256_storeu_si256((__m256i *) arg + k, x);
+}
+
+//  Reverse NTT with normalization, as polyr_intt().
+
+static inline void ntt_gen_inv_x8(int32_t *f)
+{
+    ntt_gen_inv_out_x8(f, ntt_gen_st_x8, f);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,78 @@
+//  mm_ops.h
+//  === Header: All parameter sets in one library, selected at run time.
+
+#ifndef _MM_OPS_H_
+#define _MM_OPS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+//  Function table and sizes of one parameter set. The functions are the
+//  mmkyber.h calls of that level's instance (mm_ns.h); both mmKEM and
+//  mmPKE are available in every instance.
+
+typedef struct {
+    const char *name;               //  "mmKyber-128" ..
+    int level;                      //  128, 192, 256
+    int m, n, du, dv;
+
+    size_t a_sz;                    //  bytes of A (mm_setup() output)
+    size_t pk_sz, sk_sz, ctu_sz;
+    size_t kem_cti_sz, pke_cti_sz;
+    size_t k_sz, m_sz;
+
+    void (*setup)(int32_t *a, const uint8_t seed_a[16]);
+    size_t (*kgen)( uint8_t *pk, uint8_t *sk,
+                    const int32_t *a_mat, const uint8_t seed_k[32]);
+    size_t (*encap)(uint8_t *ct, uint8_t *kk,
+                    const int32_t *a_mat, const uint8_t *pk[],
+                    const uint8_t seed_e[32], size_t n);
+    void (*decap)(  uint8_t *k, const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti);
+    size_t (*enc)(  uint8_t *ct, const int32_t *a_mat,
+                    const uint8_t *pk[], const uint8_t *mm,
+                    const uint8_t seed_e[32], size_t n);
+    void (*dec)(    uint8_t *m, const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti);
+} mm_ops_t;
+
+//  context: a parameter set and its public parameters A
+
+typedef struct {
+    const mm_ops_t *ops;
+    int32_t *a_mat;
+} mm_ctx_t;
+
+//  Function table of security level "level" (128, 192, 256), or NULL.
+const mm_ops_t *mm_ops_get(int level);
+
+//  Create a context for "level" with A from "seed_a". Returns 0 on
+//  success, -1 for an unknown level or if A cannot be allocated.
+int mm_ctx_init(mm_ctx_t *ctx, int level, const uint8_t seed_a[16]);
+
+//  Free A of the context.
+void mm_ctx_clear(mm_ctx_t *ctx);
+
+//  mmKEM & mmPKE: mm_kgen() of the context's parameter set.
+size_t mm_ctx_kgen( const mm_ctx_t *ctx, uint8_t *pk, uint8_t *sk,
+                    const uint8_t seed_k[32]);
+
+//  mmKEM: mm_encap() of the context's parameter set.
+size_t mm_ctx_encap(const mm_ctx_t *ctx, uint8_t *ct, uint8_t *kk,
+                    const uint8_t *pk[], const uint8_t seed_e[32],
+                    size_t n);
+
+//  mmKEM: mm_decap() of the context's parameter set.
+void mm_ctx_decap(  const mm_ctx_t *ctx, uint8_t *k, const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti);
+
+//  mmPKE: mm_enc() of the context's parameter set.
+size_t mm_ctx_enc(  const mm_ctx_t *ctx, uint8_t *ct,
+                    const uint8_t *pk[], const uint8_t *mm,
+                    const uint8_t seed_e[32], size_t n);
+
+//  mmPKE: mm_dec() of the context's parameter set.
+void mm_ctx_dec(const mm_ctx_t *ctx, uint8_t *m, const uint8_t *sk,
+                const uint8_t *ctu, const uint8_t *cti);
+
+#endif
@@ -18,6 +18,7 @@
 
 //  mmKyber-KEM & mmKyber-PKE-128
 #define MM_PAR      (MM_NAME "-128")
+#define MM_LEVEL    128
 #define MM_M        4
 #define MM_N        4
 #define MM_DU       10
@@ -29,6 +30,7 @@
 
 //  mmKyber-KEM & mmKyber-PKE-192
 #define MM_PAR      (MM_NAME "-192")
+#define MM_LEVEL    192
 #define MM_M        7
 #define MM_N        7
 #define MM_DU       11
@@ -41,6 +43,7 @@
 
 //  mmKyber-KEM & mmKyber-PKE-256
 #define MM_PAR      (MM_NAME "-256")
+#define MM_LEVEL    256
 #define MM_M        9
 #define MM_N        9
 #define MM_DU       11
@@ -75,8 +78,23 @@
 #define MMKEM_CTI_SZ    (MM_D / 8)
 #define MMPKE_CTI_SZ    ((MMPKE_DV * MM_D) / 8)
 
+#ifdef MM_KEM
+#define MM_CTI_SZ       MMKEM_CTI_SZ
+#else
+#define MM_CTI_SZ       MMPKE_CTI_SZ
+#endif
+
 #define MM_CTU_SZ       ((MM_M * MM_DU * MM_D) / 8)
 #define MM_PK_SZ        ((MM_N * MM_LOGQ * MM_D) / 8)
 #define MM_SK_SZ        (MM_NU_SZ * MM_M)
 
+//  expanded keys (bytes)
+#define MM_PKX_SZ       (4 * MM_N * MM_D)
+#define MM_SKX_SZ       (4 * MM_M * MM_D)
+
+//  one instance per level in the multi-parameter library
+#ifdef MM_MULTI
+#include "mm_ns.h"
+#endif
+
 #endif
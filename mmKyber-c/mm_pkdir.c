@@ -0,0 +1,369 @@
+//  mm_pkdir.c
+//  === Memory-mapped public key directory.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mm_pkdir.h"
+
+#define PKD_NIL (~((uint64_t) 0))
+
+//  byte order flag of expanded keys written / accepted by this host
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define PKD_HOST_BIG    MM_PKD_BIG
+#else
+#define PKD_HOST_BIG    0
+#endif
+
+//  round up to section alignment
+
+static inline uint64_t pkd_align(uint64_t x)
+{
+    return (x + 63) & ~((uint64_t) 63);
+}
+
+//  mix the recipient id (same function for builder and reader)
+
+static inline uint64_t pkd_hash(uint64_t id)
+{
+    id ^= id >> 33;
+    id *= 0xFF51AFD7ED558CCDull;
+    id ^= id >> 33;
+    return id;
+}
+
+//  number of index slots for "n" keys (load factor <= 1/2)
+
+static uint64_t pkd_slots(uint64_t n)
+{
+    uint64_t h = 1;
+
+    while (h < 2 * n) {
+        h <<= 1;
+    }
+    return h;
+}
+
+//  Write directory file "fn" with "n" keys pk[] (and optional ids[]).
+
+int mm_pkd_build(   const char *fn, const uint8_t dom[16],
+                    const uint64_t *ids, const uint8_t *pk[],
+                    uint64_t n, int expand)
+{
+    uint8_t hdr[MM_PKD_HDR_SZ], pad[64], ok;
+    uint64_t i, h, slots, stride, key_sz, idx_off, sz;
+    uint8_t *idx = NULL;
+    int32_t *pkx = NULL;
+    FILE *fp;
+    int ret = -1;
+
+    key_sz  = expand ? MM_PKX_SZ : MM_PK_SZ;
+    stride  = pkd_align(key_sz);
+    slots   = ids != NULL ? pkd_slots(n) : 0;
+    idx_off = ids != NULL ? MM_PKD_HDR_SZ + n * stride : 0;
+    sz      = MM_PKD_HDR_SZ + n * stride + 16 * slots;
+
+    memset(hdr, 0, sizeof(hdr));
+    memset(pad, 0, sizeof(pad));
+    memcpy(hdr, MM_PKD_MAGIC, 4);
+    put16u_le(hdr + 4, MM_PKD_VERSION);
+    put16u_le(hdr + 6, MM_LEVEL);
+    hdr[8] = (expand ? MM_PKD_EXPANDED | PKD_HOST_BIG : 0) |
+                (ids != NULL ? MM_PKD_INDEX : 0);
+    put32u_le(hdr + 12, stride);
+    put64u_le(hdr + 16, n);
+    memcpy(hdr + 24, dom, 16);
+    put64u_le(hdr + 40, MM_PKD_HDR_SZ);
+    put64u_le(hdr + 48, idx_off);
+    put64u_le(hdr + 56, slots);
+    put64u_le(hdr + 64, sz);
+
+    fp = fopen(fn, "wb");
+    if (fp == NULL) {
+        return -1;
+    }
+    pkx = (int32_t *) malloc(MM_PKX_SZ);
+    if (pkx == NULL || fwrite(hdr, MM_PKD_HDR_SZ, 1, fp) != 1) {
+        goto fail;
+    }
+
+    //  keys
+    for (i = 0; i < n; i++) {
+        if (mm_pk_validate_batch(pkx, &ok, &pk[i], 1) != 1) {
+            goto fail;
+        }
+        if (expand) {
+            if (fwrite(pkx, MM_PKX_SZ, 1, fp) != 1) {
+                goto fail;
+            }
+        } else {
+            if (fwrite(pk[i], MM_PK_SZ, 1, fp) != 1) {
+                goto fail;
+            }
+        }
+        if (stride > key_sz &&
+            fwrite(pad, stride - key_sz, 1, fp) != 1) {
+            goto fail;
+        }
+    }
+
+    //  recipient index
+    if (ids != NULL) {
+        idx = (uint8_t *) malloc(16 * slots);
+        if (idx == NULL) {
+            goto fail;
+        }
+        for (i = 0; i < slots; i++) {
+            put64u_le(idx + 16 * i, 0);
+            put64u_le(idx + 16 * i + 8, PKD_NIL);
+        }
+        for (i = 0; i < n; i++) {
+            h = pkd_hash(ids[i]) & (slots - 1);
+            while (get64u_le(idx + 16 * h + 8) != PKD_NIL) {
+                h = (h + 1) & (slots - 1);
+            }
+            put64u_le(idx + 16 * h, ids[i]);
+            put64u_le(idx + 16 * h + 8, i);
+        }
+        if (fwrite(idx, 16 * slots, 1, fp) != 1) {
+            goto fail;
+        }
+    }
+    ret = 0;
+
+fail:
+    if (fclose(fp) != 0) {
+        ret = -1;
+    }
+    if (ret != 0) {
+        remove(fn);
+    }
+    free(idx);
+    free(pkx);
+
+    return ret;
+}
+
+//  Parse and check a directory of "sz" bytes. Returns 0 on success.
+
+int mm_pkd_open(mm_pkd_t *d, const uint8_t *buf, size_t sz)
+{
+    uint64_t n, stride, slots, idx_off, tot;
+    int flags;
+
+    memset(d, 0, sizeof(mm_pkd_t));
+    if (sz < MM_PKD_HDR_SZ ||
+        memcmp(buf, MM_PKD_MAGIC, 4) != 0 ||
+        get16u_le(buf + 4) != MM_PKD_VERSION ||
+        get16u_le(buf + 6) != MM_LEVEL ||
+        get64u_le(buf + 40) != MM_PKD_HDR_SZ) {
+        return -1;
+    }
+    flags = buf[8];
+    stride = get32u_le(buf + 12);
+    n = get64u_le(buf + 16);
+    idx_off = get64u_le(buf + 48);
+    slots = get64u_le(buf + 56);
+    tot = get64u_le(buf + 64);
+
+    if (stride != pkd_align((flags & MM_PKD_EXPANDED) ?
+                            MM_PKX_SZ : MM_PK_SZ) ||
+        n > sz / stride) {
+        return -1;
+    }
+
+    //  expanded keys are used in place: only in the byte order of the host
+    if ((flags & ~(MM_PKD_EXPANDED | MM_PKD_INDEX | MM_PKD_BIG)) != 0 ||
+        (flags & MM_PKD_BIG) !=
+            ((flags & MM_PKD_EXPANDED) ? PKD_HOST_BIG : 0)) {
+        return -1;
+    }
+    if (flags & MM_PKD_INDEX) {
+        if (idx_off != MM_PKD_HDR_SZ + n * stride || slots != pkd_slots(n)) {
+            return -1;
+        }
+    } else if (idx_off != 0 || slots != 0) {
+        return -1;
+    }
+    if (tot != MM_PKD_HDR_SZ + n * stride + 16 * slots || tot > sz) {
+        return -1;
+    }
+
+    d->buf = buf;
+    d->sz = sz;
+    d->n = n;
+    d->slots = slots;
+    d->stride = stride;
+    d->flags = flags;
+    d->dom = buf + 24;
+    d->key = buf + MM_PKD_HDR_SZ;
+    d->idx = idx_off != 0 ? buf + idx_off : NULL;
+
+    return 0;
+}
+
+//  Map directory file "fn" with MM_PKD_POPULATE / MM_PKD_HUGE options.
+
+int mm_pkd_map(mm_pkd_t *d, const char *fn, int opt)
+{
+    int fd, fl;
+    struct stat st;
+    void *p = MAP_FAILED;
+
+    fd = open(fn, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size < MM_PKD_HDR_SZ) {
+        close(fd);
+        return -1;
+    }
+
+    fl = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (opt & MM_PKD_POPULATE) {
+        fl |= MAP_POPULATE;
+    }
+#endif
+
+    //  explicit huge pages only work on hugetlbfs; fall back to THP hint
+#ifdef MAP_HUGETLB
+    if (opt & MM_PKD_HUGE) {
+        p = mmap(NULL, st.st_size, PROT_READ, fl | MAP_HUGETLB, fd, 0);
+    }
+#endif
+    if (p == MAP_FAILED) {
+        p = mmap(NULL, st.st_size, PROT_READ, fl, fd, 0);
+#ifdef MADV_HUGEPAGE
+        if (p != MAP_FAILED && (opt & MM_PKD_HUGE)) {
+            madvise(p, st.st_size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+
+    if (mm_pkd_open(d, (const uint8_t *) p, st.st_size) != 0) {
+        munmap(p, st.st_size);
+        return -1;
+    }
+    d->mapped = 1;
+
+    return 0;
+}
+
+//  Unmap a directory opened with mm_pkd_map().
+
+void mm_pkd_unmap(mm_pkd_t *d)
+{
+    if (d->mapped) {
+        munmap((void *) d->buf, d->sz);
+    }
+    memset(d, 0, sizeof(mm_pkd_t));
+}
+
+//  Find the index of recipient "id". Returns -1 if not found.
+
+int64_t mm_pkd_find(const mm_pkd_t *d, uint64_t id)
+{
+    uint64_t h, i, j;
+
+    if (d->idx == NULL) {
+        return -1;
+    }
+    h = pkd_hash(id) & (d->slots - 1);
+    for (j = 0; j < d->slots; j++) {
+        i = get64u_le(d->idx + 16 * h + 8);
+        if (i == PKD_NIL) {
+            break;
+        }
+        if (get64u_le(d->idx + 16 * h) == id) {
+            return i < d->n ? (int64_t) i : -1;
+        }
+        h = (h + 1) & (d->slots - 1);
+    }
+
+    return -1;
+}
+
+//  Recipient source (mm_src_t) over a packed directory; "arg" is mm_pkd_t.
+
+size_t mm_pkd_src(  void *arg, const uint8_t *pk[], const uint8_t *m[],
+                    size_t i, size_t max)
+{
+    const mm_pkd_t *d = (const mm_pkd_t *) arg;
+    size_t j;
+
+    (void) m;
+    if (d->flags & MM_PKD_EXPANDED) {
+        return 0;
+    }
+    for (j = 0; j < max && i + j < d->n; j++) {
+        pk[j] = d->key + (i + j) * d->stride;
+    }
+
+    return j;
+}
+
+//  mmKEM: Encapsulate to keys [i0, i0 + n) of the directory (ct_u, ct_i..).
+
+size_t mm_pkd_encap(uint8_t *ct, uint8_t *kk, const int32_t *a_mat,
+                    const mm_pkd_t *d, uint64_t i0, uint64_t n,
+                    const uint8_t seed_e[32])
+{
+    mm_ses_t ses;
+    uint64_t i;
+    size_t ct_sz;
+
+    if (i0 > d->n || n > d->n - i0) {
+        return 0;
+    }
+    ct_sz = mm_ses_init(&ses, ct, a_mat, seed_e, n);
+    for (i = i0; i < i0 + n; i++) {
+        if (d->flags & MM_PKD_EXPANDED) {
+            mm_ses_encap_x(&ses, ct + ct_sz, kk, mm_pkd_pkx(d, i));
+        } else {
+            mm_ses_encap(&ses, ct + ct_sz, kk, mm_pkd_pk(d, i));
+        }
+        ct_sz += MMKEM_CTI_SZ;
+        kk += MMKEM_K_SZ;
+    }
+    mm_ses_clear(&ses);
+
+    return ct_sz;
+}
+
+//  mmPKE: Encrypt "mm" to keys [i0, i0 + n) of the directory.
+
+size_t mm_pkd_enc(  uint8_t *ct, const int32_t *a_mat,
+                    const mm_pkd_t *d, uint64_t i0, uint64_t n,
+                    const uint8_t *mm, const uint8_t seed_e[32])
+{
+    mm_ses_t ses;
+    uint64_t i;
+    size_t ct_sz;
+
+    if (i0 > d->n || n > d->n - i0) {
+        return 0;
+    }
+    ct_sz = mm_ses_init(&ses, ct, a_mat, seed_e, n);
+    for (i = i0; i < i0 + n; i++) {
+        if (d->flags & MM_PKD_EXPANDED) {
+            mm_ses_enc_x(&ses, ct + ct_sz, mm_pkd_pkx(d, i), mm);
+        } else {
+            mm_ses_enc(&ses, ct + ct_sz, mm_pkd_pk(d, i), mm);
+        }
+        ct_sz += MMPKE_CTI_SZ;
+        mm += MMPKE_M_SZ;
+    }
+    mm_ses_clear(&ses);
+
+    return ct_sz;
+}
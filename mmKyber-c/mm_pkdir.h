@@ -0,0 +1,114 @@
+//  mm_pkdir.h
+//  === Header: Memory-mapped public key directory.
+
+#ifndef _MM_PKDIR_H_
+#define _MM_PKDIR_H_
+
+#include "plat_local.h"
+#include "mm_param.h"
+#include "mmkyber.h"
+
+/*
+    Directory layout (little-endian except expanded keys, all sections
+    64-byte aligned):
+
+    offset  size    header field
+    0       4       magic "mmKD"
+    4       2       format version (1)
+    6       2       security level (128, 192, 256)
+    8       1       flags (bit 0: expanded keys, bit 1: id index present,
+                    bit 2: expanded keys are big-endian)
+    9       3       reserved (zero)
+    12      4       key stride in bytes
+    16      8       number of keys N
+    24      16      seed domain (seed_a of the public parameters)
+    40      8       key section offset
+    48      8       index offset (0 if none)
+    56      8       index slots (power of two)
+    64      8       total size
+    72      56      reserved (zero)
+
+    keys:   N keys at "stride" intervals; MM_PK_SZ bytes packed, or
+            MM_PKX_SZ bytes expanded (int32 in the byte order of the
+            builder, as from mm_pk_validate_batch; used in place, so an
+            expanded directory only opens on hosts of the same order)
+    index:  slots * { u64 recipient id, u64 key index }, open addressing
+            with linear probing; empty slots have index ~0.
+*/
+
+#define MM_PKD_MAGIC    "mmKD"
+#define MM_PKD_VERSION  1
+#define MM_PKD_HDR_SZ   128
+
+//  flags
+#define MM_PKD_EXPANDED 1
+#define MM_PKD_INDEX    2
+#define MM_PKD_BIG      4
+
+//  mm_pkd_map() options
+#define MM_PKD_POPULATE 1           //  MAP_POPULATE: fault in all pages
+#define MM_PKD_HUGE     2           //  MAP_HUGETLB or MADV_HUGEPAGE
+
+//  an opened directory
+
+typedef struct {
+    const uint8_t *buf;             //  start of directory
+    size_t sz;                      //  mapped size
+    uint64_t n;                     //  number of keys
+    uint64_t slots;                 //  index slots (0 if no index)
+    size_t stride;                  //  key stride
+    int flags;                      //  MM_PKD_EXPANDED, MM_PKD_INDEX
+    const uint8_t *dom;             //  seed domain (16 bytes)
+    const uint8_t *key;             //  key section
+    const uint8_t *idx;             //  index section or NULL
+    int mapped;                     //  from mm_pkd_map()
+} mm_pkd_t;
+
+//  Write directory file "fn" with "n" keys pk[] (and optional ids[]);
+//  keys are range checked and stored expanded if "expand" is set.
+//  Returns 0 on success, -1 on I/O error or an invalid key.
+int mm_pkd_build(   const char *fn, const uint8_t dom[16],
+                    const uint64_t *ids, const uint8_t *pk[],
+                    uint64_t n, int expand);
+
+//  Parse and check a directory of "sz" bytes. Returns 0 on success.
+int mm_pkd_open(mm_pkd_t *d, const uint8_t *buf, size_t sz);
+
+//  Map directory file "fn" with MM_PKD_POPULATE / MM_PKD_HUGE options.
+//  Returns 0 on success.
+int mm_pkd_map(mm_pkd_t *d, const char *fn, int opt);
+
+//  Unmap a directory opened with mm_pkd_map().
+void mm_pkd_unmap(mm_pkd_t *d);
+
+//  Find the index of recipient "id". Returns -1 if not found.
+int64_t mm_pkd_find(const mm_pkd_t *d, uint64_t id);
+
+//  Packed key "i" (NULL in an expanded directory)
+static inline const uint8_t *mm_pkd_pk(const mm_pkd_t *d, uint64_t i)
+{
+    return (d->flags & MM_PKD_EXPANDED) ? NULL : d->key + i * d->stride;
+}
+
+//  Expanded key "i" (NULL in a packed directory)
+static inline const int32_t *mm_pkd_pkx(const mm_pkd_t *d, uint64_t i)
+{
+    return (d->flags & MM_PKD_EXPANDED) ?
+        (const int32_t *) (d->key + i * d->stride) : NULL;
+}
+
+//  Recipient source (mm_src_t) over a packed directory; "arg" is mm_pkd_t.
+size_t mm_pkd_src(  void *arg, const uint8_t *pk[], const uint8_t *m[],
+                    size_t i, size_t max);
+
+//  mmKEM: Encapsulate to keys [i0, i0 + n) of the directory (ct_u, ct_i..).
+size_t mm_pkd_encap(uint8_t *ct, uint8_t *kk, const int32_t *a_mat,
+                    const mm_pkd_t *d, uint64_t i0, uint64_t n,
+                    const uint8_t seed_e[32]);
+
+//  mmPKE: Encrypt "mm" to keys [i0, i0 + n) of the directory.
+size_t mm_pkd_enc(  uint8_t *ct, const int32_t *a_mat,
+                    const mm_pkd_t *d, uint64_t i0, uint64_t n,
+                    const uint8_t *mm, const uint8_t seed_e[32]);
+
+#endif
@@ -0,0 +1,564 @@
+//  mm_poly.hpp
+//  === Header: C++20 typed polynomials over the mm_ring.h kernels.
+
+#ifndef _MM_POLY_HPP_
+#define _MM_POLY_HPP_
+
+#include <concepts>
+#include <cstring>
+#include <utility>
+
+extern "C" {
+#include "mm_ring.h"
+#include "mm_serial.h"
+#include "mm_sample.h"
+#include "sha3_t.h"
+}
+
+/*
+    poly<D, B> is a view of MM_D coefficients in domain D whose values are
+    known to lie in the interval B. "mont_ntt" is the NTT domain times
+    R^-1, the result of a multiply-add; polyr_intt() takes it back to
+    "normal" and mont_mulq() by R^2 to "ntt". Each operation computes the
+    bound of its result at compile time. A reduction is inserted (if
+    constexpr) only where the input contract of the next operation would
+    be broken; a contract that cannot be met is a compile error.
+
+    mont_redc() is tracked exactly: for |x| <= 64 q^2 it returns
+    (x + t * q) / 2^32 with t in [-2^31, 2^31), so the product with a
+    twiddle or a small operand stays near [-q/2, q/2]. The looser "fma"
+    bounds (mm_kern_fma.c) are included; the types hold for all backends.
+
+    +, from_mont() are lazy; eval() or norm() writes the chain in one pass.
+    The scheme functions below give the same bytes as mmkyber.c with A
+    from "a_mat" (tools/mm_poly_main.cpp checks this).
+*/
+
+namespace mm {
+
+//  === parameter sets (mm_param.h)
+
+struct param_t {
+    int level, m, n, du, dv, nu_bar;
+    double gw0, gw1;                //  Gaussian widths MM_SIGMA0, MM_SIGMA1
+};
+
+inline constexpr param_t par_128 = { 128, 4, 4, 10, 2, 3, 15.90, 368459.34 };
+inline constexpr param_t par_192 = { 192, 7, 7, 11, 2, 2, 15.90, 488797.36 };
+inline constexpr param_t par_256 = { 256, 9, 9, 11, 2, 2, 15.90, 554941.07 };
+
+//  the one this build (-DMM_128 ..) is for
+inline constexpr param_t par =  MM_LEVEL == 128 ? par_128 :
+                                MM_LEVEL == 192 ? par_192 : par_256;
+
+static_assert(  par.m == MM_M && par.n == MM_N && par.du == MM_DU &&
+                par.dv == MMPKE_DV && par.nu_bar == MM_NU_BAR &&
+                par.gw0 == MM_SIGMA0 && par.gw1 == MM_SIGMA1,
+                "mm_poly.hpp: parameter set differs from mm_param.h");
+
+inline constexpr int64_t q = MM_Q;
+
+//  === coefficient bounds, closed interval [lo, hi]
+
+struct bound_t {
+    int64_t lo, hi;
+};
+
+constexpr bound_t operator+(bound_t a, bound_t b)
+{
+    return { a.lo + b.lo, a.hi + b.hi };
+}
+
+//  a is within b
+
+constexpr bool bnd_in(bound_t a, bound_t b)
+{
+    return a.lo >= b.lo && a.hi <= b.hi;
+}
+
+constexpr bound_t bnd_hull(bound_t a, bound_t b)
+{
+    return { a.lo < b.lo ? a.lo : b.lo, a.hi > b.hi ? a.hi : b.hi };
+}
+
+//  { x * y : x in a, y in b }
+
+constexpr bound_t bnd_mul(bound_t a, bound_t b)
+{
+    int64_t x[4] = { a.lo * b.lo, a.lo * b.hi, a.hi * b.lo, a.hi * b.hi };
+    bound_t r = { x[0], x[0] };
+
+    for (int i = 1; i < 4; i++) {
+        r = bnd_hull(r, { x[i], x[i] });
+    }
+    return r;
+}
+
+inline constexpr bound_t bnd_i32    = { INT32_MIN, INT32_MAX };
+inline constexpr bound_t bnd_q      = { 0, q - 1 };         //  canonical
+inline constexpr bound_t bnd_red1   = { -0x3FFC0, 0x203EFC0 };  //  mont_red1()
+inline constexpr bound_t bnd_w      = { -(q - 1), q - 1 };  //  twiddles
+inline constexpr bound_t bnd_rr     = { MONT_RR, MONT_RR };
+
+//  mont_redc() input contract and exact output
+
+constexpr bool redc_ok(bound_t x)
+{
+    return bnd_in(x, { -64 * q * q, 64 * q * q });
+}
+
+constexpr bound_t redc_bnd(bound_t x)
+{
+    return {    (x.lo - (1ll << 31) * q) >> 32,
+                (x.hi + ((1ll << 31) - 1) * q) >> 32 };
+}
+
+//  fntt(): per layer x +- mont_mulq(y, w); "fma" returns (-5q, 5q).
+//  Empty bound if a layer breaks a contract.
+
+constexpr bound_t fntt_bnd(bound_t b)
+{
+    bound_t t;
+
+    for (int j = MM_D >> 1; j > 0; j >>= 1) {
+        t = bnd_mul(b, bnd_w);
+        if (!redc_ok(t)) {
+            return { 1, 0 };
+        }
+        t = redc_bnd(t);
+        b = bnd_hull(b + t, { b.lo - t.hi, b.hi - t.lo });
+        if (!bnd_in(b, bnd_i32)) {
+            return { 1, 0 };
+        }
+    }
+    return bnd_hull(b, { -5 * q, 5 * q });
+}
+
+constexpr bool fntt_ok(bound_t b)
+{
+    return fntt_bnd(b).lo <= fntt_bnd(b).hi;
+}
+
+//  intt(): first layer red1(x + y), mont_mulq(y - x, w); "fma" takes any
+//  int32. Output always in [0, q-1].
+
+constexpr bool intt_ok(bound_t b)
+{
+    return  bnd_in(b + b, bnd_i32) &&
+            redc_ok(bnd_mul({ b.lo - b.hi, b.hi - b.lo }, bnd_w));
+}
+
+//  one term of polyr_ntt_mul_add(); "fma" wants |g| <= 8q
+
+constexpr bool mul_add_ok(bound_t f, bound_t g)
+{
+    return redc_ok(bnd_mul(f, g)) && bnd_in(g, { -8 * q, 8 * q });
+}
+
+constexpr bound_t mul_add_bnd(bound_t f, bound_t g)
+{
+    return bnd_hull(redc_bnd(bnd_mul(f, g)), { -(q / 2 + 1), q / 2 + 1 });
+}
+
+//  poly_compress() divides exactly for these (and more)
+inline constexpr bound_t bnd_compress = { -2 * q, 3 * q };
+
+//  poly_deserial(): signed dx-bit, unsigned for dx = MM_LOGQ
+
+constexpr bound_t deserial_bnd(int dx)
+{
+    if (dx == MM_LOGQ) {
+        return { 0, (1ll << dx) - 1 };
+    }
+    return { -(1ll << (dx - 1)), (1ll << (dx - 1)) - 1 };
+}
+
+//  poly_nu(): binary or ternary
+inline constexpr bound_t bnd_nu = { par.nu_bar == 2 ? 0 : -1, 1 };
+
+//  poly_gauss() with width gw: w >= 2^-126 so |rint(x * w)| is at most
+//  gw * sqrt(126 * log(2) / pi) < 5.28 gw
+
+constexpr bound_t gauss_bnd(double gw)
+{
+    return { -(int64_t) (5.28 * gw) - 1, (int64_t) (5.28 * gw) + 1 };
+}
+
+//  === polynomials
+
+enum class domain { normal, ntt, mont_ntt };
+
+//  MM_D coefficients at "v" (not owned); T = const int32_t is read-only.
+//  The constructor takes the caller's word for D and B.
+
+template <domain D, bound_t B, typename T = int32_t>
+class poly {
+  public:
+    static constexpr domain dom = D;
+    static constexpr bound_t bnd = B;
+
+    static_assert(B.lo <= B.hi && bnd_in(B, bnd_i32));
+
+    explicit poly(T *v) : v_(v) { }
+
+    int32_t operator[](int i) const { return v_[i]; }
+    T *data() const { return v_; }
+
+  private:
+    T *v_;
+};
+
+template <domain D, bound_t B>
+using cpoly = poly<D, B, const int32_t>;
+
+//  lazy elementwise result
+
+template <domain D, bound_t B, typename F>
+struct pexpr {
+    static constexpr domain dom = D;
+    static constexpr bound_t bnd = B;
+
+    static_assert(bnd_in(B, bnd_i32), "mm_poly.hpp: int32 overflow");
+
+    F f;
+
+    int32_t operator[](int i) const { return f(i); }
+};
+
+template <typename P>
+concept coefs = requires (const P &p, int i) {
+    { P::dom } -> std::convertible_to<domain>;
+    { P::bnd } -> std::convertible_to<bound_t>;
+    { p[i] } -> std::convertible_to<int32_t>;
+};
+
+template <typename P>
+concept stored = coefs<P> && requires (const P &p) {
+    { p.data() } -> std::convertible_to<const int32_t *>;
+};
+
+//  === elementwise (lazy)
+
+template <coefs A, coefs B>
+    requires (A::dom == B::dom)
+auto operator+(const A &a, const B &b)
+{
+    auto f = [a, b](int i) { return a[i] + b[i]; };
+
+    return pexpr<A::dom, A::bnd + B::bnd, decltype(f)>{ f };
+}
+
+//  x * R^2 / R: remove the Montgomery factor of a multiply-add
+
+template <coefs A>
+    requires (A::dom == domain::mont_ntt)
+auto from_mont(const A &a)
+{
+    static_assert(redc_ok(bnd_mul(A::bnd, bnd_rr)));
+    auto f = [a](int i) { return mont_mulq(a[i], MONT_RR); };
+
+    return pexpr<domain::ntt, redc_bnd(bnd_mul(A::bnd, bnd_rr)),
+                    decltype(f)>{ f };
+}
+
+//  === one pass into "r" (which may be an input)
+
+template <coefs A>
+auto eval(const A &a, int32_t *r)
+{
+    for (int i = 0; i < MM_D; i++) {
+        r[i] = a[i];
+    }
+    return poly<A::dom, A::bnd>(r);
+}
+
+//  to [0, q-1] with only the steps of polyr_norm() that B needs
+
+template <coefs A>
+auto norm(const A &a, int32_t *r)
+{
+    constexpr bool red = !bnd_in(A::bnd, { -q, 2 * q - 1 });
+    constexpr bound_t b = red ? bnd_red1 : A::bnd;
+
+    for (int i = 0; i < MM_D; i++) {
+        int32_t x = a[i];
+        if constexpr (red) {
+            x = mont_red1(x);
+        }
+        if constexpr (b.lo < 0) {
+            x = mont_cadd(x);
+        }
+        if constexpr (b.hi >= q) {
+            x = mont_cadd(x - MONT_Q);
+        }
+        r[i] = x;
+    }
+    return poly<A::dom, bnd_q>(r);
+}
+
+//  mont_red1() in place; nothing if B is already within its output
+
+template <domain D, bound_t B>
+auto red1(poly<D, B> a)
+{
+    if constexpr (bnd_in(B, bnd_red1)) {
+        return a;
+    } else {
+        int32_t *v = a.data();
+        for (int i = 0; i < MM_D; i++) {
+            v[i] = mont_red1(v[i]);
+        }
+        return poly<D, bnd_red1>(v);
+    }
+}
+
+template <domain D>
+auto zero(int32_t *r)
+{
+    polyr_zero(r);
+    return poly<D, bound_t{ 0, 0 }>(r);
+}
+
+//  === kernels, in place
+
+static_assert(fntt_ok(bnd_q) && intt_ok(bnd_red1));
+
+template <bound_t B>
+auto fntt(poly<domain::normal, B> a)
+{
+    if constexpr (!fntt_ok(B)) {
+        return fntt(norm(a, a.data()));
+    } else {
+        polyr_fntt(a.data());
+        return poly<domain::ntt, fntt_bnd(B)>(a.data());
+    }
+}
+
+template <bound_t B>
+auto intt(poly<domain::mont_ntt, B> a)
+{
+    if constexpr (!intt_ok(B)) {
+        return intt(red1(a));
+    } else {
+        polyr_intt(a.data());
+        return poly<domain::normal, bnd_q>(a.data());
+    }
+}
+
+//  acc += f * g / R; the sum stays lazy while intt() would still take it
+
+template <bound_t A, stored F, stored G>
+    requires (F::dom == domain::ntt && G::dom == domain::ntt)
+auto mul_add(poly<domain::mont_ntt, A> acc, const F &f, const G &g)
+{
+    static_assert(mul_add_ok(F::bnd, G::bnd));
+    constexpr bound_t t = mul_add_bnd(F::bnd, G::bnd);
+
+    if constexpr (!intt_ok(A + t) && !bnd_in(A, bnd_red1)) {
+        return mul_add(red1(acc), f, g);
+    } else {
+        polyr_ntt_mul_add(acc.data(), f.data(), g.data());
+        return poly<domain::mont_ntt, A + t>(acc.data());
+    }
+}
+
+//  acc + sum_j f(j) * g(j) / R, j in [J, K); each step may have a new type
+
+template <int K, int J = 0, bound_t A, typename F, typename G>
+auto dot(poly<domain::mont_ntt, A> acc, F f, G g)
+{
+    if constexpr (J == K) {
+        return acc;
+    } else {
+        return dot<K, J + 1>(mul_add(acc, f(J), g(J)), f, g);
+    }
+}
+
+template <typename P>
+using fntt_t = decltype(fntt(std::declval<P>()));
+
+//  === sources and sinks
+
+using nu_t = poly<domain::normal, bnd_nu>;
+
+inline nu_t nu(int32_t *r, const uint8_t *s)
+{
+    poly_nu(r, s);
+    return nu_t(r);
+}
+
+template <double GW>
+using gauss_t = poly<domain::normal, gauss_bnd(GW)>;
+
+template <double GW>
+gauss_t<GW> gauss(int32_t *r, sha3_t *kec)
+{
+    poly_gauss(r, kec, GW);
+    return gauss_t<GW>(r);
+}
+
+//  unpack from "b" and advance it
+
+template <int DX>
+poly<domain::normal, deserial_bnd(DX)> deserial(int32_t *r, const uint8_t *&b)
+{
+    b += poly_deserial(r, b, DX);
+    return poly<domain::normal, deserial_bnd(DX)>(r);
+}
+
+template <int DX, stored P>
+size_t serial(uint8_t *b, const P &p)
+{
+    static_assert(bnd_in(P::bnd, bnd_q), "mm_poly.hpp: serial needs norm()");
+    return poly_serial(b, p.data(), DX);
+}
+
+template <int DX, stored P>
+    requires (P::dom == domain::normal)
+size_t compress(uint8_t *b, const P &p)
+{
+    static_assert(bnd_in(P::bnd, bnd_compress));
+    return poly_compress(b, p.data(), DX);
+}
+
+//  A[i][j] (ntt domain, [0, q-1])
+
+inline cpoly<domain::ntt, bnd_q> a_at(const int32_t *a_mat, int i, int j)
+{
+    return cpoly<domain::ntt, bnd_q>(&a_mat[(i * MM_N + j) * MM_D]);
+}
+
+//  === mmKyber on typed polynomials (mmkyber.c)
+
+inline void kec_setup(sha3_t *kec, const uint8_t *buf, size_t len)
+{
+    sha3_init(kec, par.level == 128 ? SHAKE128_RATE : SHAKE256_RATE);
+    sha3_absorb(kec, buf, len);
+    sha3_pad(kec, SHAKE_PAD);
+}
+
+//  mm_kgen(): A^T s, R^2 scaling, + e and the normalization in one pass
+
+inline size_t kgen( uint8_t *pk, uint8_t *sk,
+                    const int32_t *a_mat, const uint8_t seed_k[32])
+{
+    using s_t = fntt_t<nu_t>;
+    int32_t s[MM_M][MM_D], e[MM_D], b[MM_D];
+    uint8_t seed[33], buf[MM_NU_SZ];
+    size_t pk_sz = 0;
+    sha3_t kec;
+
+    //  (s, e) <- U(Snu^m) x U(Snu^n)
+    memcpy(seed, seed_k, 32);
+    seed[32] = 'S';
+    kec_setup(&kec, seed, 33);
+    for (int i = 0; i < MM_M; i++) {
+        sample_nu(sk, &kec);
+        fntt(nu(s[i], sk));
+        sk += MM_NU_SZ;
+    }
+
+    //  t := b := A^T * s + e
+    seed[32] = 'E';
+    kec_setup(&kec, seed, 33);
+    for (int i = 0; i < MM_N; i++) {
+        sample_nu(buf, &kec);
+        auto ei = fntt(nu(e, buf));
+        auto bi = dot<MM_M>(zero<domain::mont_ntt>(b),
+                    [&](int j) { return a_at(a_mat, j, i); },
+                    [&](int j) { return s_t(s[j]); });
+        pk_sz += serial<MM_LOGQ>(pk + pk_sz, norm(from_mont(bi) + ei, b));
+    }
+
+    return pk_sz;
+}
+
+//  mmEnc^i(pp; r) from r(j) (ntt domain) and e(i)
+
+template <typename R, typename E>
+size_t enc_i(uint8_t *ct, const int32_t *a_mat, R r, E e)
+{
+    int32_t c[MM_D];
+    size_t ct_sz = 0;
+
+    for (int i = 0; i < MM_M; i++) {
+
+        //  c := A * r + e_u; u := [c mod q] (2^du)
+        auto ci = dot<MM_N>(zero<domain::mont_ntt>(c),
+                    [&](int j) { return a_at(a_mat, i, j); }, r);
+        ct_sz += compress<MM_DU>(ct + ct_sz, eval(intt(ci) + e(i), c));
+    }
+
+    return ct_sz;
+}
+
+//  mm_enc_u(): sample r (ntt domain into "r_u"), e_u; create ^ct
+
+inline size_t enc_u(uint8_t *ct, int32_t r_u[][MM_D],
+                    const int32_t *a_mat, const uint8_t seed_e[32])
+{
+    using e_t = gauss_t<par.gw0>;
+    using r_t = fntt_t<e_t>;
+    int32_t e_u[MM_M][MM_D];
+    uint8_t buf[33];
+    sha3_t kec;
+
+    memcpy(buf, seed_e, 32);
+    buf[32] = 'R';
+    kec_setup(&kec, buf, 33);
+    for (int i = 0; i < MM_N; i++) {
+        fntt(gauss<par.gw0>(r_u[i], &kec));
+    }
+    buf[32] = 'e';
+    kec_setup(&kec, buf, 33);
+    for (int i = 0; i < MM_M; i++) {
+        gauss<par.gw0>(e_u[i], &kec);
+    }
+
+    return enc_i(ct, a_mat,
+                [&](int j) { return r_t(r_u[j]); },
+                [&](int i) { return e_t(e_u[i]); });
+}
+
+#ifdef MM_KEM
+
+//  mm_decap_w(): key bits from w = <c', s> in [0, q-1]
+
+template <stored W>
+void decap_w(uint8_t *k, const W &w, const uint8_t *cti)
+{
+    static_assert(W::dom == domain::normal && bnd_in(W::bnd, bnd_q));
+
+    memset(k, 0, MMKEM_K_SZ);
+    for (int i = 0; i < MMKEM_K_SZ * 8; i++) {
+        int32_t x = w[i];
+        x -= ~((x - (MM_Q / 2)) >> 31) & MM_Q;
+        x >>= MM_DU - 3;
+
+        int b = (cti[i >> 3] >> (i & 7)) & 1;
+        x = ((x + 2 * b + 1) >> 2) & 1;
+        k[i >> 3] |= x << (i & 7);
+    }
+}
+
+//  mm_decap() (ntt path): no reduction is needed between the kernels
+
+inline void decap(  uint8_t *k, const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti)
+{
+    int32_t s[MM_D], c[MM_D], w[MM_D];
+
+    //  w := <c', s>, c' := u mod 2^du
+    auto wi = dot<MM_M>(zero<domain::mont_ntt>(w),
+                [&](int) { return fntt(deserial<MM_DU>(c, ctu)); },
+                [&](int) {  auto si = fntt(nu(s, sk));
+                            sk += MM_NU_SZ;
+                            return si; });
+    decap_w(k, intt(wi), cti);
+}
+
+#endif
+
+}   //  namespace mm
+
+#endif
@@ -6,6 +6,7 @@
 
 #include "plat_local.h"
 #include "mm_param.h"
+#include "mm_kern.h"
 
 /*
 d = 256
@@ -24,11 +25,45 @@ qi = lift(Mod(-q,2^32)^-1)
 #define MONT_DI     33157153l
 #define MONT_QI     16773119l
 
+/*
+    Reduction: Montgomery with multiplications by QI and q, or with
+    -DMM_RED_SPQ (make RED=spq) the same values from shifts and subtractions
+    that use the sparse forms of this prime:
+
+    q   = 2^25 - 2^12 + 1,      2^25 == 2^12 - 1  (mod q)
+    qi  = 2^24 - 2^12 - 1       (-q^-1 mod 2^32)
+
+    Both give bit-identical results; `make redbench` compares them.
+*/
+
+#ifdef MM_RED_SPQ
+#if MM_Q != 33550337l || MONT_QI != 16773119l
+#error "MM_RED_SPQ requires q = 2^25 - 2^12 + 1"
+#endif
+#define MM_RED_NAME "spq"
+#else
+#define MM_RED_NAME "mont"
+#endif
+
 //  fast normalizing reduction
+
 static inline int32_t mont_red1(int32_t x)
 {
+#ifdef MM_RED_SPQ
+    int32_t h;
+    XTMPVAR(const int32_t x0 = x);
+
+    //  x = h * 2^25 + l  ->  l + h * (2^12 - 1)
+    h = x >> MONT_LOGQ;
+    x = (x & ((1l << MONT_LOGQ) - 1)) + h * (1 << 12) - h;
+
+    //  same value as the generic form below
+    XASSERT(h >= -64 && h <= 63);
+    XASSERT(x == x0 - h * MONT_Q);
+#else
     //  (no input restrictions)
     x -= (x >> MONT_LOGQ) * MONT_Q;
+#endif
 
     //  these are the exact bounds for 32-bit signed x
     XASSERT(x >= -0x3FFC0);     //  -262079
@@ -41,13 +76,30 @@ static inline int32_t mont_red1(int32_t x)
 static inline int32_t mont_redc(int64_t x)
 {
     int32_t r;
+#ifdef MM_RED_SPQ
+    uint32_t t;
+    uint64_t u;
+#endif
 
     //  prove these input bounds; -(8*q)^2 < x < (8*q)^2
     XASSUME(x >= -(64l * MONT_Q * MONT_Q));
     XASSUME(x <= (64l * MONT_Q * MONT_Q));
 
+#ifdef MM_RED_SPQ
+    //  t = x * qi mod 2^32
+    t = (uint32_t) x;
+    t = (t << 24) - (t << 12) - t;
+    XASSERT(t == (uint32_t) ((int32_t) x * MONT_QI));
+
+    //  u = t * q mod 2^64 (t signed); x + u == 0 mod 2^32
+    u = (uint64_t) (int64_t) (int32_t) t;
+    u = (u << 25) - (u << 12) + u;
+    XASSERT((int64_t) u == ((int64_t) (int32_t) t) * MONT_Q);
+    r = ((int64_t) ((uint64_t) x + u)) >> 32;
+#else
     r = (int32_t) x * MONT_QI;
     r = (x + ((int64_t) r) * ((int64_t) MONT_Q)) >> 32;
+#endif
 
     //  prove output bounds (only one coditional addition is required)
     XASSERT(r >= -MONT_Q);
@@ -183,24 +235,28 @@ static inline void polyr_ntt_mul(   int32_t *fg,
     }
 }
 
+//  === Kernels -- mm_ntt.c, mm_kern_poly.c via the backend table (mm_kern.h)
+
 //  Coefficient multiply and add:  r += a * b, Montgomery reduction.
 
 static inline void  polyr_ntt_mul_add(  int32_t *fg,
                                         const int32_t *f, const int32_t *g)
 {
-    int i;
-
-    for (i = 0; i < MM_D; i++) {
-        fg[i] += mont_mulq(f[i], g[i]);
-    }
+    mm_kern->polyr_ntt_mul_add(fg, f, g);
 }
 
-//  === Protytpes -- polyr.c
-
 //  Forward NTT (negacyclic -- evaluate polynomial at factors of x^n+1).
-void polyr_fntt(int32_t *f);
+
+static inline void polyr_fntt(int32_t *f)
+{
+    mm_kern->polyr_fntt(f);
+}
 
 //  Reverse NTT (negacyclic -- x^n+1), normalize by 1/(n*r).
-void polyr_intt(int32_t *f);
+
+static inline void polyr_intt(int32_t *f)
+{
+    mm_kern->polyr_intt(f);
+}
 
 #endif
@@ -2,7 +2,9 @@
 //  === Simple Samplers (XXX: the Gaussian ones are placeholders.)
 
 #include <math.h>
+#include <string.h>
 #include "mm_param.h"
+#include "mm_ring.h"
 #include "mm_sample.h"
 
 //  Uniform sampler [0, q-1]
@@ -26,6 +28,83 @@ void poly_unif(int32_t *r, sha3_t *kec)
     }
 }
 
+//  Four-lane uniform sampling. Enough blocks for all MM_D samples are
+//  squeezed at once (more are needed with negligible probability); a lane is
+//  continued on its own if it does not. A draw never straddles a block.
+
+#define MM_UNIF_NB  7
+#if ((SHAKE128_RATE % MM_Q_SZ) != 0) || \
+    (MM_UNIF_NB * SHAKE128_RATE < MM_D * MM_Q_SZ)
+#error "MM_UNIF_NB * SHAKE128_RATE must be enough for MM_D samples."
+#endif
+
+//  Return next uniform [0, q-1] sample from "buf" or lane "l" of "kx".
+
+static inline int32_t unif_x4_next( const uint8_t *buf, size_t *j,
+                                    sha3_t *kec, const sha3x4_t *kx, int l)
+{
+    uint8_t h[4] = { 0 };
+    int32_t x;
+
+    do {
+        if (*j < MM_UNIF_NB * SHAKE128_RATE) {
+            x = get32u_le(buf + *j) & MM_Q_MASK;
+            *j += MM_Q_SZ;
+        } else {
+            if (*j == MM_UNIF_NB * SHAKE128_RATE) {
+                sha3x4_lane(kec, kx, l);
+                *j += MM_Q_SZ;
+            }
+            sha3_squeeze(kec, h, MM_Q_SZ);
+            x = get32u_le(h) & MM_Q_MASK;
+        }
+    } while (x >= MM_Q);
+
+    return x;
+}
+
+//  Uniform sampler [0, q-1] for "nl" <= 4 polynomials r[l] in parallel
+
+void poly_unif_x4(int32_t *r[4], sha3x4_t *kx, int nl)
+{
+    uint8_t buf[4][MM_UNIF_NB * SHAKE128_RATE];
+    uint8_t *h[4] = { buf[0], buf[1], buf[2], buf[3] };
+    sha3_t kec;
+    size_t j;
+    int i, l;
+
+    sha3x4_squeeze_blocks(kx, h, MM_UNIF_NB);
+    for (l = 0; l < nl; l++) {
+        j = 0;
+        for (i = 0; i < MM_D; i++) {
+            r[l][i] = unif_x4_next(buf[l], &j, &kec, kx, l);
+        }
+    }
+}
+
+//  Fused uniform sampling and multiply-add: c += sum_l unif(l) * r[l],
+//  Montgomery reduction. The uniform polynomials are never stored.
+
+void poly_unif_mul_add_x4(  int32_t *c, sha3x4_t *kx,
+                            const int32_t *r[4], int nl)
+{
+    uint8_t buf[4][MM_UNIF_NB * SHAKE128_RATE];
+    uint8_t *h[4] = { buf[0], buf[1], buf[2], buf[3] };
+    sha3_t kec;
+    size_t j;
+    int i, l;
+    int32_t x;
+
+    sha3x4_squeeze_blocks(kx, h, MM_UNIF_NB);
+    for (l = 0; l < nl; l++) {
+        j = 0;
+        for (i = 0; i < MM_D; i++) {
+            x = unif_x4_next(buf[l], &j, &kec, kx, l);
+            c[i] += mont_mulq(x, r[l][i]);
+        }
+    }
+}
+
 //  Uniform sampler [-nu, nu]
 /*
 #define MM_NU_S     (2 * (MM_NU) + 1)
@@ -149,29 +228,83 @@ void poly_nu(int32_t *r, const uint8_t *s)
     See comments in mm_sample.py for further explanation.
 */
 
+//  One Box-Muller draw from 16 bytes "h": two samples to r[0], r[1], or
+//  none (returns 0) if the point is rejected.
+
+static inline int gauss_pair(int32_t *r, const uint8_t *h, double cs2)
+{
+    const double d63 = 0x1p-63;
+    double x, y, w;
+
+    x = d63 * ((double) get64u_le(h)) - 1.0;
+    y = d63 * ((double) get64u_le(h + 8)) - 1.0;
+    w = x*x + y*y;
+    if (w > 0.0 && w <= 1.0) {
+        w = sqrt( cs2 * log(w) / w );
+        r[0] = rint( x * w );
+        r[1] = rint( y * w );
+        return 1;
+    }
+    return 0;
+}
+
 //  Gaussian sampler. gw = Gaussian width, gw = sqrt(2*Pi)*sigma
 
 void poly_gauss(int32_t *r, sha3_t *kec, double gw)
 {
     int i;
-    double cs2, d63;
-    double x, y, w;
+    double cs2;
     uint8_t h[16] = { 0 };
 
     cs2 = (1.0 / 6.0) - M_1_PI * (gw * gw); //  M_1_PI = 1/Pi
-    d63 = ldexp(1.0, -63);
 
     i = 0;
     while (i < MM_D) {
         sha3_squeeze(kec, h, 16);
-        x = d63 * ((double) get64u_le(h)) - 1.0;
-        y = d63 * ((double) get64u_le(h + 8)) - 1.0;
-        w = x*x + y*y;
-        if (w > 0.0 && w <= 1.0) {
-            w = sqrt( cs2 * log(w) / w );
-            r[i++] = rint( x * w );
-            r[i++] = rint( y * w );
-        }
+        i += 2 * gauss_pair(r + i, h, cs2);
     }
 }
 
+//  Four-lane Gaussian sampling. The lanes are squeezed MM_GAUSS_NB blocks
+//  at a time until all are done; the bytes of a draw that straddles two
+//  refills are carried over, so each lane reads its stream exactly as
+//  poly_gauss() does.
+
+#define MM_GAUSS_NB 4
+
+void poly_gauss_x4(int32_t *r[4], sha3x4_t *kx, int nl, int np, double gw)
+{
+    uint8_t buf[4][16 + MM_GAUSS_NB * SHAKE128_RATE];
+    uint8_t *h[4];
+    size_t j[4] = { 0 }, e[4] = { 0 };
+    int i[4] = { 0 };
+    int l, left;
+    double cs2;
+
+    cs2 = (1.0 / 6.0) - M_1_PI * (gw * gw);
+
+    left = nl;
+    while (left > 0) {
+        for (l = 0; l < 4; l++) {
+            memmove(buf[l], buf[l] + j[l], e[l] - j[l]);
+            e[l] -= j[l];
+            j[l] = 0;
+            h[l] = buf[l] + e[l];
+        }
+        sha3x4_squeeze_blocks(kx, h, MM_GAUSS_NB);
+
+        left = 0;
+        for (l = 0; l < nl; l++) {
+            e[l] += MM_GAUSS_NB * kx->r;
+            while (i[l] < np * MM_D && e[l] - j[l] >= 16) {
+                i[l] += 2 * gauss_pair(r[l] + i[l], buf[l] + j[l], cs2);
+                j[l] += 16;
+            }
+            if (i[l] < np * MM_D) {
+                left++;
+            } else {
+                j[l] = e[l];            //  lane done
+            }
+        }
+    }
+}
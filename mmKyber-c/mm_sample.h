@@ -6,10 +6,18 @@
 
 #include "plat_local.h"
 #include "sha3_t.h"
+#include "sha3x4_t.h"
 
 //  Uniform sampler [0, q-1]
 void poly_unif(int32_t *r, sha3_t *kec);
 
+//  Uniform sampler [0, q-1] for "nl" <= 4 polynomials r[l] in parallel
+void poly_unif_x4(int32_t *r[4], sha3x4_t *kx, int nl);
+
+//  Fused uniform sampling and multiply-add: c += sum_l unif(l) * r[l]
+void poly_unif_mul_add_x4(  int32_t *c, sha3x4_t *kx,
+                            const int32_t *r[4], int nl);
+
 //  Sample bytes for a nu-distribution polynomial
 void sample_nu(uint8_t *r, sha3_t *kec);
 
@@ -19,4 +27,8 @@ void poly_nu(int32_t *r, const uint8_t *s);
 //  Gaussian sampler. gw = Gaussian width, gw = sqrt(2*Pi)*sigma
 void poly_gauss(int32_t *r, sha3_t *kec, double gw);
 
+//  Gaussian sampler for "nl" <= 4 lanes in parallel: "np" consecutive
+//  polynomials r[l] (np * MM_D coefficients) per lane, as np poly_gauss()
+void poly_gauss_x4(int32_t *r[4], sha3x4_t *kx, int nl, int np, double gw);
+
 #endif
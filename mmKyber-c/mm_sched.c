@@ -0,0 +1,492 @@
+//  mm_sched.c
+//  === Work-stealing scheduler for keygen, encap and decap work.
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mm_sched.h"
+#include "mm_tune.h"
+#include "mmkyber.h"
+
+//  a job: tasks not finished yet
+
+typedef struct {
+    _Atomic size_t left;
+} sch_job_t;
+
+typedef struct {
+    mm_task_t fn;
+    void *arg;
+    size_t i0, i1;
+    sch_job_t *job;
+} sch_task_t;
+
+//  worker: deques (head: oldest, tail: newest) and statistics under "mx"
+
+typedef struct {
+    sch_task_t q[2][MM_SCHED_Q_MAX];
+    uint64_t head[2], tail[2];
+    pthread_mutex_t mx;
+    mm_sched_stat_t st;
+    mm_sched_t *s;
+    int t;
+    pthread_t th;
+} sch_worker_t;
+
+struct mm_sched_s {
+    int nt, quit;
+    _Atomic uint64_t pending;       //  queued tasks, all workers
+    _Atomic uint32_t rr;            //  next worker to deal to
+    pthread_mutex_t mx;             //  for the conditions
+    pthread_cond_t work, done;
+    sch_worker_t *w;
+};
+
+#define SCH_MASK    (MM_SCHED_Q_MAX - 1)
+
+//  queued tasks of worker "w" (mx held)
+
+static void sch_depth(sch_worker_t *w)
+{
+    w->st.depth = (w->tail[0] - w->head[0]) + (w->tail[1] - w->head[1]);
+    if (w->st.depth > w->st.depth_max) {
+        w->st.depth_max = w->st.depth;
+    }
+}
+
+//  append "tk" to a deque of "w". Returns 0, or -1 if it is full.
+
+static int sch_push(sch_worker_t *w, const sch_task_t *tk, int pri)
+{
+    pthread_mutex_lock(&w->mx);
+    if (w->tail[pri] - w->head[pri] >= MM_SCHED_Q_MAX) {
+        pthread_mutex_unlock(&w->mx);
+        return -1;
+    }
+    w->q[pri][w->tail[pri] & SCH_MASK] = *tk;
+    w->tail[pri]++;
+    atomic_fetch_add(&w->s->pending, 1);
+    sch_depth(w);
+    pthread_mutex_unlock(&w->mx);
+
+    return 0;
+}
+
+//  take the newest ("own") or oldest task of a deque of "w"
+
+static int sch_take(sch_worker_t *w, sch_task_t *tk, int pri, int own)
+{
+    int r = 0;
+
+    pthread_mutex_lock(&w->mx);
+    if (w->tail[pri] > w->head[pri]) {
+        if (own) {
+            w->tail[pri]--;
+            *tk = w->q[pri][w->tail[pri] & SCH_MASK];
+        } else {
+            *tk = w->q[pri][w->head[pri] & SCH_MASK];
+            w->head[pri]++;
+        }
+        atomic_fetch_sub(&w->s->pending, 1);
+        sch_depth(w);
+        r = 1;
+    }
+    pthread_mutex_unlock(&w->mx);
+
+    return r;
+}
+
+//  find a task for worker "w": own, then stolen; high priority first.
+//  Returns the priority class, or -1 if there is none.
+
+static int sch_find(sch_worker_t *w, sch_task_t *tk)
+{
+    mm_sched_t *s = w->s;
+    int pri, k;
+
+    for (pri = MM_SCHED_HI; pri <= MM_SCHED_LO; pri++) {
+        if (sch_take(w, tk, pri, 1)) {
+            return pri;
+        }
+        for (k = 1; k < s->nt; k++) {
+            if (sch_take(&s->w[(w->t + k) % s->nt], tk, pri, 0)) {
+                pthread_mutex_lock(&w->mx);
+                w->st.steals++;
+                pthread_mutex_unlock(&w->mx);
+                return pri;
+            }
+        }
+    }
+    return -1;
+}
+
+//  a task is done; signal its job if it was the last one
+
+static void sch_done(mm_sched_t *s, const sch_task_t *tk)
+{
+    if (atomic_fetch_sub(&tk->job->left, 1) == 1) {
+        pthread_mutex_lock(&s->mx);
+        pthread_cond_broadcast(&s->done);
+        pthread_mutex_unlock(&s->mx);
+    }
+}
+
+//  worker thread
+
+static void *sch_thread(void *arg)
+{
+    sch_worker_t *w = (sch_worker_t *) arg;
+    mm_sched_t *s = w->s;
+    sch_task_t tk;
+    uint64_t t0, t1;
+    int pri, quit;
+
+    for (;;) {
+        t0 = plat_get_ns();
+        pri = sch_find(w, &tk);
+        if (pri >= 0) {
+            tk.fn(tk.arg, tk.i0, tk.i1);
+            t1 = plat_get_ns();
+            pthread_mutex_lock(&w->mx);
+            w->st.tasks[pri]++;
+            w->st.busy_ns += t1 - t0;
+            pthread_mutex_unlock(&w->mx);
+            sch_done(s, &tk);
+            continue;
+        }
+
+        pthread_mutex_lock(&s->mx);
+        while (!s->quit && atomic_load(&s->pending) == 0) {
+            pthread_cond_wait(&s->work, &s->mx);
+        }
+        quit = s->quit;
+        pthread_mutex_unlock(&s->mx);
+
+        t1 = plat_get_ns();
+        pthread_mutex_lock(&w->mx);
+        w->st.idle_ns += t1 - t0;
+        pthread_mutex_unlock(&w->mx);
+        if (quit) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static void sch_wake(mm_sched_t *s)
+{
+    pthread_mutex_lock(&s->mx);
+    pthread_cond_broadcast(&s->work);
+    pthread_mutex_unlock(&s->mx);
+}
+
+//  Start "threads" workers. Returns NULL on failure.
+
+mm_sched_t *mm_sched_start(int threads)
+{
+    mm_sched_t *s;
+    int t;
+
+    if (threads < 1) {
+        threads = mm_tune.threads > 0 ? mm_tune.threads : 1;
+    }
+    if (threads > MM_SCHED_THR_MAX) {
+        threads = MM_SCHED_THR_MAX;
+    }
+    s = (mm_sched_t *) calloc(1, sizeof(mm_sched_t));
+    if (s == NULL) {
+        return NULL;
+    }
+    s->w = (sch_worker_t *) calloc(threads, sizeof(sch_worker_t));
+    if (s->w == NULL) {
+        free(s);
+        return NULL;
+    }
+    pthread_mutex_init(&s->mx, NULL);
+    pthread_cond_init(&s->work, NULL);
+    pthread_cond_init(&s->done, NULL);
+    for (t = 0; t < threads; t++) {
+        pthread_mutex_init(&s->w[t].mx, NULL);
+        s->w[t].s = s;
+        s->w[t].t = t;
+    }
+
+    //  nt is final before any worker looks at other deques
+    s->nt = threads;
+    for (t = 0; t < threads; t++) {
+        if (pthread_create(&s->w[t].th, NULL, sch_thread, &s->w[t]) != 0) {
+            break;
+        }
+    }
+    if (t < threads) {
+        s->nt = t;
+        mm_sched_stop(s);
+        return NULL;
+    }
+
+    return s;
+}
+
+//  Number of workers.
+
+int mm_sched_threads(const mm_sched_t *s)
+{
+    return s->nt;
+}
+
+//  Copy the statistics of worker "t".
+
+void mm_sched_stat(mm_sched_t *s, int t, mm_sched_stat_t *st)
+{
+    sch_worker_t *w = &s->w[t];
+
+    pthread_mutex_lock(&w->mx);
+    *st = w->st;
+    pthread_mutex_unlock(&w->mx);
+}
+
+//  Stop the workers and free the scheduler (no jobs may be pending).
+
+void mm_sched_stop(mm_sched_t *s)
+{
+    int t;
+
+    pthread_mutex_lock(&s->mx);
+    s->quit = 1;
+    pthread_cond_broadcast(&s->work);
+    pthread_mutex_unlock(&s->mx);
+    for (t = 0; t < s->nt; t++) {
+        pthread_join(s->w[t].th, NULL);
+    }
+    for (t = 0; t < s->nt; t++) {
+        pthread_mutex_destroy(&s->w[t].mx);
+    }
+    pthread_cond_destroy(&s->work);
+    pthread_cond_destroy(&s->done);
+    pthread_mutex_destroy(&s->mx);
+    free(s->w);
+    free(s);
+}
+
+//  Run fn(arg, i0, i1) over [0, n) in tasks of "blk" items with priority
+//  "pri"; return when all are done.
+
+void mm_sched_run(  mm_sched_t *s, mm_task_t fn, void *arg,
+                    size_t n, size_t blk, int pri)
+{
+    sch_job_t job;
+    sch_task_t tk;
+    uint32_t w;
+    int k;
+
+    if (n == 0) {
+        return;
+    }
+    if (blk == 0) {
+        blk = 1;
+    }
+    pri = pri == MM_SCHED_HI ? MM_SCHED_HI : MM_SCHED_LO;
+    atomic_init(&job.left, (n + blk - 1) / blk);
+
+    //  deal round robin; if every deque is full, run the task here
+    tk.fn = fn;
+    tk.arg = arg;
+    tk.job = &job;
+    for (tk.i0 = 0; tk.i0 < n; tk.i0 = tk.i1) {
+        tk.i1 = n - tk.i0 > blk ? tk.i0 + blk : n;
+        w = atomic_fetch_add(&s->rr, 1);
+        for (k = 0; k < s->nt; k++) {
+            if (sch_push(&s->w[(w + k) % s->nt], &tk, pri) == 0) {
+                break;
+            }
+        }
+        if (k == s->nt) {
+            sch_wake(s);
+            fn(arg, tk.i0, tk.i1);
+            sch_done(s, &tk);
+        }
+    }
+    sch_wake(s);
+
+    pthread_mutex_lock(&s->mx);
+    while (atomic_load(&job.left) > 0) {
+        pthread_cond_wait(&s->done, &s->mx);
+    }
+    pthread_mutex_unlock(&s->mx);
+}
+
+//  encapsulation job: a copy of the session per task
+
+typedef struct {
+    mm_ses_t ses;
+    uint8_t *cti, *kk;
+    const uint8_t **pk;
+    const uint8_t *mm;
+} sch_enc_t;
+
+//  copy of session "ses" for indices [i0, i1) of its unused range (an
+//  expired copy otherwise, so that no y_i is ever used twice)
+
+static void sch_ses_sub(mm_ses_t *sub, const mm_ses_t *ses,
+                        uint64_t i0, uint64_t i1)
+{
+    if (i0 < ses->idx || i0 > i1 || i1 > ses->lim) {
+        mm_ses_clear(sub);
+        return;
+    }
+    memcpy(sub, ses, sizeof(mm_ses_t));
+    sub->idx = i0;
+    sub->lim = i1;
+}
+
+static void sch_enc_task(void *arg, size_t i0, size_t i1)
+{
+    sch_enc_t *e = (sch_enc_t *) arg;
+    mm_ses_t ses;
+    size_t i;
+
+    sch_ses_sub(&ses, &e->ses, i0, i1);
+    for (i = i0; i < i1; i++) {
+        if (e->mm == NULL) {
+            mm_ses_encap(&ses, e->cti + i * MMKEM_CTI_SZ,
+                            e->kk + i * MMKEM_K_SZ, e->pk[i]);
+        } else {
+            mm_ses_enc(&ses, e->cti + i * MMPKE_CTI_SZ, e->pk[i],
+                        e->mm + i * MMPKE_M_SZ);
+        }
+    }
+    mm_ses_clear(&ses);
+}
+
+//  mmKEM: mm_encap() with recipient blocks on the workers (MM_SCHED_LO).
+
+size_t mm_sched_encap(  mm_sched_t *s, uint8_t *ct, uint8_t *kk,
+                        const int32_t *a_mat, const uint8_t *pk[],
+                        const uint8_t seed_e[32], size_t n)
+{
+    sch_enc_t e;
+    size_t ct_sz;
+
+    ct_sz = mm_ses_init(&e.ses, ct, a_mat, seed_e, n);
+    e.cti = ct + ct_sz;
+    e.kk = kk;
+    e.pk = pk;
+    e.mm = NULL;
+    mm_sched_run(s, sch_enc_task, &e, n, mm_tune.rblk, MM_SCHED_LO);
+    mm_ses_clear(&e.ses);
+
+    return ct_sz + n * MMKEM_CTI_SZ;
+}
+
+//  mmPKE: mm_enc() with recipient blocks on the workers (MM_SCHED_LO).
+
+size_t mm_sched_enc(mm_sched_t *s, uint8_t *ct, const int32_t *a_mat,
+                    const uint8_t *pk[], const uint8_t *mm,
+                    const uint8_t seed_e[32], size_t n)
+{
+    sch_enc_t e;
+    size_t ct_sz;
+
+    ct_sz = mm_ses_init(&e.ses, ct, a_mat, seed_e, n);
+    e.cti = ct + ct_sz;
+    e.kk = NULL;
+    e.pk = pk;
+    e.mm = mm;
+    mm_sched_run(s, sch_enc_task, &e, n, mm_tune.rblk, MM_SCHED_LO);
+    mm_ses_clear(&e.ses);
+
+    return ct_sz + n * MMPKE_CTI_SZ;
+}
+
+//  key generation job
+
+typedef struct {
+    uint8_t **pk, **sk;
+    const int32_t *a_mat;
+    const uint8_t **seed_k;
+} sch_kgen_t;
+
+static void sch_kgen_task(void *arg, size_t i0, size_t i1)
+{
+    sch_kgen_t *g = (sch_kgen_t *) arg;
+    size_t i;
+
+    for (i = i0; i < i1; i++) {
+        mm_kgen(g->pk[i], g->sk[i], g->a_mat, g->seed_k[i]);
+    }
+}
+
+//  mmKEM & mmPKE: "n" mm_kgen(pk[i], sk[i], a_mat, seed_k[i])
+//  (MM_SCHED_LO).
+
+void mm_sched_kgen( mm_sched_t *s, uint8_t *pk[], uint8_t *sk[],
+                    const int32_t *a_mat, const uint8_t *seed_k[],
+                    size_t n)
+{
+    sch_kgen_t g;
+
+    g.pk = pk;
+    g.sk = sk;
+    g.a_mat = a_mat;
+    g.seed_k = seed_k;
+    mm_sched_run(s, sch_kgen_task, &g, n, MM_SCHED_KBLK, MM_SCHED_LO);
+}
+
+//  decapsulation / decryption job
+
+typedef struct {
+    uint8_t *out;
+    const uint8_t **sk;
+    const uint8_t *ctu;
+    const uint8_t **cti;
+    int pke;
+} sch_dec_t;
+
+static void sch_dec_task(void *arg, size_t i0, size_t i1)
+{
+    sch_dec_t *d = (sch_dec_t *) arg;
+    size_t i;
+
+    for (i = i0; i < i1; i++) {
+        if (d->pke) {
+            mm_dec(d->out + i * MMPKE_M_SZ, d->sk[i], d->ctu, d->cti[i]);
+        } else {
+            mm_decap(d->out + i * MMKEM_K_SZ, d->sk[i], d->ctu, d->cti[i]);
+        }
+    }
+}
+
+//  mmKEM: "n" mm_decap(kk + i * MMKEM_K_SZ, sk[i], ctu, cti[i])
+//  (MM_SCHED_HI).
+
+void mm_sched_decap(mm_sched_t *s, uint8_t *kk, const uint8_t *sk[],
+                    const uint8_t *ctu, const uint8_t *cti[], size_t n)
+{
+    sch_dec_t d;
+
+    d.out = kk;
+    d.sk = sk;
+    d.ctu = ctu;
+    d.cti = cti;
+    d.pke = 0;
+    mm_sched_run(s, sch_dec_task, &d, n, MM_SCHED_DBLK, MM_SCHED_HI);
+}
+
+//  mmPKE: "n" mm_dec(mm + i * MMPKE_M_SZ, sk[i], ctu, cti[i])
+//  (MM_SCHED_HI).
+
+void mm_sched_dec(  mm_sched_t *s, uint8_t *mm, const uint8_t *sk[],
+                    const uint8_t *ctu, const uint8_t *cti[], size_t n)
+{
+    sch_dec_t d;
+
+    d.out = mm;
+    d.sk = sk;
+    d.ctu = ctu;
+    d.cti = cti;
+    d.pke = 1;
+    mm_sched_run(s, sch_dec_task, &d, n, MM_SCHED_DBLK, MM_SCHED_HI);
+}
@@ -0,0 +1,107 @@
+//  mm_sched.h
+//  === Header: Work-stealing scheduler for keygen, encap and decap work.
+
+#ifndef _MM_SCHED_H_
+#define _MM_SCHED_H_
+
+#include "plat_local.h"
+#include "mm_param.h"
+
+/*
+    Every worker thread has a deque per priority class. A job is split
+    into tasks of a few items (recipients, keys or decapsulations) that
+    are dealt round robin to the workers. A worker takes its own newest
+    task first and, when it has none, steals the oldest task of another
+    worker. Before each task a worker looks for MM_SCHED_HI work (its own,
+    then stolen) before MM_SCHED_LO work, so decapsulations preempt bulk
+    encapsulation and key generation at task boundaries.
+
+    The entry points submit a job and block the calling thread until it
+    is done; their output is identical to the plain library calls. Many
+    threads may submit concurrently, but not tasks themselves.
+*/
+
+//  priority classes
+#define MM_SCHED_HI     0
+#define MM_SCHED_LO     1
+
+#ifndef MM_SCHED_THR_MAX
+#define MM_SCHED_THR_MAX    64
+#endif
+
+#ifndef MM_SCHED_Q_MAX
+#define MM_SCHED_Q_MAX  1024        //  tasks per deque, power of two
+#endif
+
+//  default task sizes (encap / enc: mm_tune.rblk)
+#ifndef MM_SCHED_RBLK
+#define MM_SCHED_RBLK   32          //  recipients per encap / enc task
+#endif
+
+#ifndef MM_SCHED_KBLK
+#define MM_SCHED_KBLK   4           //  keys per kgen task
+#endif
+
+#ifndef MM_SCHED_DBLK
+#define MM_SCHED_DBLK   1           //  decapsulations per task
+#endif
+
+//  task body: items [i0, i1) of a job
+
+typedef void (*mm_task_t)(void *arg, size_t i0, size_t i1);
+
+//  per-worker statistics
+
+typedef struct {
+    uint64_t tasks[2];              //  tasks run, by priority class
+    uint64_t steals;                //  .. of which taken from other workers
+    uint64_t depth, depth_max;      //  queued tasks now, maximum
+    uint64_t busy_ns, idle_ns;      //  time running tasks, waiting
+} mm_sched_stat_t;
+
+typedef struct mm_sched_s mm_sched_t;
+
+//  Start "threads" workers (0: mm_tune.threads). Returns NULL on failure.
+mm_sched_t *mm_sched_start(int threads);
+
+//  Number of workers.
+int mm_sched_threads(const mm_sched_t *s);
+
+//  Copy the statistics of worker "t".
+void mm_sched_stat(mm_sched_t *s, int t, mm_sched_stat_t *st);
+
+//  Stop the workers and free the scheduler (no jobs may be pending).
+void mm_sched_stop(mm_sched_t *s);
+
+//  Run fn(arg, i0, i1) over [0, n) in tasks of "blk" items with priority
+//  "pri"; return when all are done.
+void mm_sched_run(  mm_sched_t *s, mm_task_t fn, void *arg,
+                    size_t n, size_t blk, int pri);
+
+//  mmKEM: mm_encap() with recipient blocks on the workers (MM_SCHED_LO).
+size_t mm_sched_encap(  mm_sched_t *s, uint8_t *ct, uint8_t *kk,
+                        const int32_t *a_mat, const uint8_t *pk[],
+                        const uint8_t seed_e[32], size_t n);
+
+//  mmPKE: mm_enc() with recipient blocks on the workers (MM_SCHED_LO).
+size_t mm_sched_enc(mm_sched_t *s, uint8_t *ct, const int32_t *a_mat,
+                    const uint8_t *pk[], const uint8_t *mm,
+                    const uint8_t seed_e[32], size_t n);
+
+//  mmKEM & mmPKE: "n" mm_kgen(pk[i], sk[i], a_mat, seed_k[i])
+//  (MM_SCHED_LO).
+void mm_sched_kgen( mm_sched_t *s, uint8_t *pk[], uint8_t *sk[],
+                    const int32_t *a_mat, const uint8_t *seed_k[],
+                    size_t n);
+
+//  mmKEM: "n" mm_decap(kk + i * MMKEM_K_SZ, sk[i], ctu, cti[i])
+//  (MM_SCHED_HI).
+void mm_sched_decap(mm_sched_t *s, uint8_t *kk, const uint8_t *sk[],
+                    const uint8_t *ctu, const uint8_t *cti[], size_t n);
+
+//  mmPKE: "n" mm_dec(mm + i * MMPKE_M_SZ, sk[i], ctu, cti[i])
+//  (MM_SCHED_HI).
+void mm_sched_dec(  mm_sched_t *s, uint8_t *mm, const uint8_t *sk[],
+                    const uint8_t *ctu, const uint8_t *cti[], size_t n);
+
+#endif
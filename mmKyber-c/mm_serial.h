@@ -6,39 +6,14 @@
 
 #include "plat_local.h"
 #include "mm_param.h"
+#include "mm_kern.h"
 
 //  Pack dx-bit elements from "p" to "b". Return byte length written to "b".
 
 static inline
 size_t poly_serial(uint8_t *b, const int32_t *p, int dx)
 {
-    int64_t x, t, m;
-    int i, j, l;
-
-    m = (1 << dx) - 1;
-    l = 0;
-    t = 0;
-    j = 0;
-    for (i = 0; i < MM_D; i++) {
-
-        //  read coefficint
-        x = p[i] & m;
-
-        //  serialize
-        t |= x << l;
-        l += dx;
-        while (l >= 8) {
-            b[j++] = t & 0xFF;
-            t >>= 8;
-            l -= 8;
-        }
-    }
-    //  remaining part?
-    if (l > 0) {
-        b[j++] = t & 0xFF;
-    }
-
-    return (size_t) j;
+    return mm_kern->poly_serial(b, p, dx);
 }
 
 
@@ -47,32 +22,17 @@ size_t poly_serial(uint8_t *b, const int32_t *p, int dx)
 static inline
 size_t poly_deserial(int32_t *p, const uint8_t *b, int dx)
 {
-    uint32_t t, m, s;
-    int i, j, l;
-
-    if (dx == MM_LOGQ) {        //  signedness
-        s = 0;
-    } else {
-        s = 1 << (dx - 1);
-    }
+    return mm_kern->poly_deserial(p, b, dx);
+}
 
-    m = (1 << dx) - 1;
-    i = 0;
-    l = 0;
-    t = 0;
-    for (j = 0; j < MM_D; j++) {
 
-        //  decode a coefficient
-        while (l < dx) {
-            t |= ((uint32_t) b[i++]) << l;
-            l += 8;
-        }
-        p[j] = ((t + s) & m) - s;
-        l -= dx;
-        t >>= dx;
-    }
+//  Unpack MM_LOGQ-bit public key elements from "b" to "p" and check their
+//  range. Returns 0 iff all coefficients are in [0, q-1] (no early exit).
 
-    return (size_t) i;
+static inline
+int32_t poly_deserial_q(int32_t *p, const uint8_t *b)
+{
+    return mm_kern->poly_deserial_q(p, b);
 }
 
 
@@ -110,41 +70,7 @@ size_t poly_deserial16(uint16_t *p, const uint8_t *b, int dx, int len)
 static inline
 size_t poly_compress(uint8_t *b, const int32_t *p, int dx)
 {
-    int64_t d, x, y;
-    int64_t t, m;
-    int i, j, l;
-
-    m = (1 << dx) - 1;
-    l = 0;
-    t = 0;
-    j = 0;
-    for (i = 0; i < MM_D; i++) {
-
-        //  scale, add a rounding constant
-        x = (((int64_t) p[i]) << dx) + (MM_Q / 2l);
-
-        //  divide by Q, constant time (x < 2**51)
-        d = x >> MM_LOGQ;
-        y = x - d * MM_Q;
-        d += y >> MM_LOGQ;
-        y = x - d * MM_Q;
-        d += ((y - MM_Q) >> 31) + 1;
-
-        //  serialize
-        t |= (d & m) << l;
-        l += dx;
-        while (l >= 8) {
-            b[j++] = t & 0xFF;
-            t >>= 8;
-            l -= 8;
-        }
-    }
-    //  remaining part?
-    if (l > 0) {
-        b[j++] = t & 0xFF;
-    }
-
-    return (size_t) j;
+    return mm_kern->poly_compress(b, p, dx);
 }
 
 
@@ -154,30 +80,28 @@ size_t poly_compress(uint8_t *b, const int32_t *p, int dx)
 static inline
 size_t poly_decompress(int32_t *p, const uint8_t *b, int dx)
 {
-    int64_t x, t, m;
-    int i, j, l;
+    return mm_kern->poly_decompress(p, b, dx);
+}
 
-    m = (1 << dx) - 1;
-    i = 0;
-    l = 0;
-    t = 0;
-    for (j = 0; j < MM_D; j++) {
+//  round(c * 2^dx / q) of one coefficient, as in poly_compress() but
+//  without the mask. Exact for any representative c in [-2q, 3q].
 
-        //  decode a coefficient
-        while (l < dx) {
-            t |= ((int64_t) b[i++]) << l;
-            l += 8;
-        }
-        x = t & m;
-        l -= dx;
-        t >>= dx;
+static inline
+int64_t poly_cmpr1(int32_t c, int dx)
+{
+    int64_t d, x, y;
 
-        //  round up and store coefficient
-        x = (x * MM_Q) + (1l << (dx - 1));
-        p[j] = (int32_t) (x >> dx);
-    }
+    //  scale, add a rounding constant
+    x = (((int64_t) c) << dx) + (MM_Q / 2l);
 
-    return (size_t) i;
+    //  divide by Q, constant time (x < 2**51)
+    d = x >> MM_LOGQ;
+    y = x - d * MM_Q;
+    d += y >> MM_LOGQ;
+    y = x - d * MM_Q;
+    d += ((y - MM_Q) >> 31) + 1;
+
+    return d;
 }
 
 //  Create ciphertext and key bits from "approximate shared secret."
@@ -186,7 +110,7 @@ static inline
 void poly_gen_ct_k(uint8_t *ct, uint8_t *k, int32_t *c)
 {
     int i, j;
-    int64_t d, x, y;
+    int64_t d;
     uint8_t a, b;
 
     for (i = 0; i < MMKEM_CTI_SZ; i++) {
@@ -194,17 +118,8 @@ void poly_gen_ct_k(uint8_t *ct, uint8_t *k, int32_t *c)
         b = 0;
         for (j = 0; j < 8; j++) {
 
-            //  scale, add a rounding constant
-            //  (2025-01-07; current spec has this middle step)
-            x = (int64_t) c[8 * i + j];
-            x = (x << MM_DU) + (MM_Q / 2l);
-
-            //  divide by Q, constant time (x < 2**51)
-            d = x >> MM_LOGQ;
-            y = x - d * MM_Q;
-            d += y >> MM_LOGQ;
-            y = x - d * MM_Q;
-            d += ((y - MM_Q) >> 31) + 1;
+            //  scale, round (2025-01-07; current spec has this middle step)
+            d = poly_cmpr1(c[8 * i + j], MM_DU);
 
             //  shift again
             d >>= MM_DU - 2;
@@ -217,4 +132,18 @@ void poly_gen_ct_k(uint8_t *ct, uint8_t *k, int32_t *c)
     }
 }
 
+//  Fused ciphertext output from "f" in the NTT domain (as left by
+//  polyr_ntt_mul_add(); "f" is overwritten): c := intt(f) + e, plus
+//  [q/2] * m_i if "m" != NULL, then poly_gen_ct_k(ct, k, c) if "k" !=
+//  NULL (dx = du), else poly_compress(ct, c, dx). |e| < q/2. Returns bytes
+//  written to "ct"; the same bytes as the separate steps (polyr_norm()
+//  included). The kernels are shared by all levels: du comes from "dx".
+
+static inline
+size_t polyr_intt_ct(   uint8_t *ct, uint8_t *k, int32_t *f,
+                        const int32_t *e, const uint8_t *m, int dx)
+{
+    return mm_kern->polyr_intt_ct(ct, k, f, e, m, dx);
+}
+
 #endif
@@ -0,0 +1,534 @@
+//  mm_shard.c
+//  === Sharded encapsulation over worker processes.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/random.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+#include "mm_shard.h"
+#include "mm_dem.h"
+#include "mmkyber.h"
+#include "sha3_t.h"
+
+//  body sizes
+#define SHD_RU_SZ   (MM_N * MM_D * 4)
+#define SHD_Q_FIX   (56 + SHD_RU_SZ)
+#define SHD_R_FIX   8
+
+//  send / receive exactly "len" bytes
+
+static int shd_write(int fd, const uint8_t *buf, size_t len)
+{
+    ssize_t r;
+
+    while (len > 0) {
+        r = send(fd, buf, len, MSG_NOSIGNAL);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        buf += r;
+        len -= r;
+    }
+    return 0;
+}
+
+//  returns 1 if the link was closed before the first byte
+
+static int shd_read(int fd, uint8_t *buf, size_t len)
+{
+    size_t got = 0;
+    ssize_t r;
+
+    while (got < len) {
+        r = recv(fd, buf + got, len - got, 0);
+        if (r <= 0) {
+            if (r < 0 && errno == EINTR) {
+                continue;
+            }
+            return r == 0 && got == 0 ? 1 : -1;
+        }
+        got += r;
+    }
+    return 0;
+}
+
+//  fresh randomness for the session id
+
+static int shd_rand(uint8_t *buf, size_t len)
+{
+    ssize_t r;
+
+    while (len > 0) {
+        r = getrandom(buf, len, 0);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        buf += r;
+        len -= r;
+    }
+    return 0;
+}
+
+//  session key := SHAKE256(link key || "mmSH" || sid)
+
+static void shd_skey(   uint8_t sk[MM_SHARD_KEY_SZ],
+                        const uint8_t key[MM_SHARD_KEY_SZ], uint64_t sid)
+{
+    uint8_t b[8];
+    sha3_t kec;
+
+    put64u_le(b, sid);
+    sha3_init(&kec, SHAKE256_RATE);
+    sha3_absorb(&kec, key, MM_SHARD_KEY_SZ);
+    sha3_absorb(&kec, (const uint8_t *) MM_SHARD_MAGIC, 4);
+    sha3_absorb(&kec, b, 8);
+    sha3_pad(&kec, SHAKE_PAD);
+    sha3_squeeze(&kec, sk, MM_SHARD_KEY_SZ);
+    sha3_clear(&kec);
+}
+
+//  link cipher for message "seq" in direction "dir"
+
+static void shd_init(   mm_dem_t *st, const uint8_t key[MM_SHARD_KEY_SZ],
+                        uint8_t dir, uint64_t seq)
+{
+    uint8_t nonce[MM_DEM_NONCE_SZ];
+
+    memset(nonce, 0, sizeof(nonce));
+    nonce[0] = dir;
+    put64u_le(nonce + 8, seq);
+    mm_dem_init(st, key, nonce);
+}
+
+//  send "buf" as message "seq"
+
+static int shd_send(int fd, const uint8_t key[MM_SHARD_KEY_SZ],
+                    uint8_t dir, uint64_t sid, uint64_t seq,
+                    const uint8_t *buf, size_t len)
+{
+    uint8_t h[MM_SHARD_HDR_SZ], *c;
+    mm_dem_t st;
+    size_t off, l, c_sz;
+    int last, r = 0;
+
+    memcpy(h, MM_SHARD_MAGIC, 4);
+    h[4] = dir;
+    memset(h + 5, 0, 3);
+    put64u_le(h + 8, sid);
+    put64u_le(h + 16, seq);
+    put64u_le(h + 24, len);
+    c = (uint8_t *) malloc(MM_DEM_CHUNK + MM_DEM_TAG_SZ);
+    if (c == NULL || shd_write(fd, h, sizeof(h)) != 0) {
+        free(c);
+        return -1;
+    }
+
+    shd_init(&st, key, dir, seq);
+    off = 0;
+    do {
+        l = len - off > MM_DEM_CHUNK ? MM_DEM_CHUNK : len - off;
+        last = off + l == len;
+        c_sz = mm_dem_enc_chunk(&st, c, buf + off, l, last);
+        r = shd_write(fd, c, c_sz);
+        off += l;
+    } while (r == 0 && !last);
+
+    mm_dem_clear(&st);
+    free(c);
+    return r;
+}
+
+//  receive a header in direction "dir". Returns 1 if the link is closed.
+
+static int shd_recv_hdr(int fd, uint8_t dir, uint64_t *sid,
+                        uint64_t *seq, uint64_t *len)
+{
+    uint8_t h[MM_SHARD_HDR_SZ];
+    int r;
+
+    r = shd_read(fd, h, sizeof(h));
+    if (r != 0) {
+        return r;
+    }
+    if (memcmp(h, MM_SHARD_MAGIC, 4) != 0 || h[4] != dir) {
+        return -1;
+    }
+    *sid = get64u_le(h + 8);
+    *seq = get64u_le(h + 16);
+    *len = get64u_le(h + 24);
+
+    return 0;
+}
+
+//  receive and authenticate a body of "len" bytes into "buf"
+
+static int shd_recv_body(   int fd, const uint8_t key[MM_SHARD_KEY_SZ],
+                            uint8_t dir, uint64_t seq,
+                            uint8_t *buf, size_t len)
+{
+    uint8_t *c;
+    mm_dem_t st;
+    size_t off, l;
+    int last, r = 0;
+
+    c = (uint8_t *) malloc(MM_DEM_CHUNK + MM_DEM_TAG_SZ);
+    if (c == NULL) {
+        return -1;
+    }
+    shd_init(&st, key, dir, seq);
+    off = 0;
+    do {
+        l = len - off > MM_DEM_CHUNK ? MM_DEM_CHUNK : len - off;
+        last = off + l == len;
+        if (shd_read(fd, c, l + MM_DEM_TAG_SZ) != 0 ||
+            mm_dem_dec_chunk(&st, buf + off, c, l + MM_DEM_TAG_SZ,
+                                last) != (int64_t) l) {
+            r = -1;
+        }
+        off += l;
+    } while (r == 0 && !last);
+
+    mm_dem_clear(&st);
+    free(c);
+    return r;
+}
+
+//  key index of recipient "id" (as in the service)
+
+static int64_t shd_key(const mm_pkd_t *d, uint64_t id)
+{
+    if (d->idx != NULL) {
+        return mm_pkd_find(d, id);
+    }
+    return id < d->n ? (int64_t) id : -1;
+}
+
+//  worker: one shard "q" of "len" bytes; the response into "*rp"
+
+static size_t shd_work( uint8_t **rp, const uint8_t *q, size_t len,
+                        const mm_pkd_t *pkd)
+{
+    mm_ses_t ses;
+    uint8_t op, *r, *cti, *ki;
+    uint64_t i, i0, i1, cnt;
+    size_t j, k, cti_sz, r_sz;
+    const uint8_t *p, *m;
+    int64_t x;
+    uint32_t st;
+
+    op = q[0];
+    i0 = get64u_le(q + 8);
+    i1 = get64u_le(q + 16);
+    cnt = i1 - i0;
+    cti_sz = op == 'P' ? MMPKE_CTI_SZ : MMKEM_CTI_SZ;
+    k = op == 'P' ? 0 : MMKEM_K_SZ;
+
+    st = MM_SHARD_OK;
+    if ((op != 'E' && op != 'P') || i1 < i0 || cnt > MM_SHARD_N_MAX ||
+        len != SHD_Q_FIX + cnt * (8 + (op == 'P' ? MMPKE_M_SZ : 0))) {
+        st = MM_SHARD_EREQ;
+        cnt = 0;
+    }
+    r_sz = SHD_R_FIX + cnt * (cti_sz + k);
+    r = (uint8_t *) calloc(1, r_sz);
+    *rp = r;
+    if (r == NULL) {
+        return 0;
+    }
+
+    //  the coordinator's session, restricted to [i0, i1)
+    memcpy(ses.seed_e, q + 24, 32);
+    p = q + 56;
+    for (i = 0; i < MM_N; i++) {
+        for (j = 0; j < MM_D; j++) {
+            ses.r_u[i][j] = (int32_t) get32u_le(p);
+            p += 4;
+        }
+    }
+    ses.idx = i0;
+    ses.lim = i1;
+    m = p + cnt * 8;
+
+    cti = r + SHD_R_FIX;
+    ki = cti + cnt * cti_sz;
+    for (i = 0; st == MM_SHARD_OK && i < cnt; i++) {
+        x = shd_key(pkd, get64u_le(p + 8 * i));
+        if (x < 0) {
+            st = MM_SHARD_ENOKEY;
+            break;
+        }
+        if (op == 'P' && (pkd->flags & MM_PKD_EXPANDED)) {
+            mm_ses_enc_x(&ses, cti, mm_pkd_pkx(pkd, x), m + i * MMPKE_M_SZ);
+        } else if (op == 'P') {
+            mm_ses_enc(&ses, cti, mm_pkd_pk(pkd, x), m + i * MMPKE_M_SZ);
+        } else if (pkd->flags & MM_PKD_EXPANDED) {
+            mm_ses_encap_x(&ses, cti, ki + i * k, mm_pkd_pkx(pkd, x));
+        } else {
+            mm_ses_encap(&ses, cti, ki + i * k, mm_pkd_pk(pkd, x));
+        }
+        cti += cti_sz;
+    }
+    mm_ses_clear(&ses);
+
+    if (st != MM_SHARD_OK) {
+        memset(r, 0, r_sz);
+        r_sz = SHD_R_FIX;
+    }
+    put32u_le(r, st);
+
+    return r_sz;
+}
+
+//  Worker: serve shards on "fd" until the link is closed (returns 0) or
+//  a message fails to authenticate (returns -1).
+
+int mm_shard_serve( int fd, const uint8_t key[MM_SHARD_KEY_SZ],
+                    const mm_pkd_t *pkd)
+{
+    uint64_t sid, s, seq, last, len;
+    uint8_t sk[MM_SHARD_KEY_SZ], *q, *r;
+    size_t r_sz;
+    int x;
+
+    sid = 0;
+    last = 0;
+    for (;;) {
+        x = shd_recv_hdr(fd, 'Q', &s, &seq, &len);
+        if (x != 0) {
+            x = x > 0 ? 0 : -1;
+            break;
+        }
+        x = -1;
+        if (s == 0 || (sid != 0 && s != sid) || seq <= last ||
+            len < SHD_Q_FIX ||
+            len > SHD_Q_FIX + (uint64_t) MM_SHARD_N_MAX * (8 + MMPKE_M_SZ)) {
+            break;
+        }
+        if (sid == 0) {
+            sid = s;
+            shd_skey(sk, key, sid);
+        }
+        q = (uint8_t *) malloc(len);
+        if (q == NULL) {
+            break;
+        }
+        if (shd_recv_body(fd, sk, 'Q', seq, q, len) != 0) {
+            memset(q, 0, len);
+            free(q);
+            break;
+        }
+        last = seq;
+
+        r_sz = shd_work(&r, q, len, pkd);
+        memset(q, 0, len);
+        free(q);
+        if (r == NULL) {
+            break;
+        }
+        x = shd_send(fd, sk, 'R', sid, seq, r, r_sz);
+        memset(r, 0, r_sz);
+        free(r);
+        if (x != 0) {
+            break;
+        }
+    }
+    memset(sk, 0, sizeof(sk));
+
+    return x;
+}
+
+//  Fork "nw" local workers serving directory "pkd" over socket pairs
+//  with link key "key". Returns 0 on success.
+
+int mm_shard_spawn( mm_shard_t *sh, int nw,
+                    const uint8_t key[MM_SHARD_KEY_SZ], const mm_pkd_t *pkd)
+{
+    int w, v, sv[2];
+
+    memset(sh, 0, sizeof(mm_shard_t));
+    memcpy(sh->key, key, MM_SHARD_KEY_SZ);
+    if (nw < 1 || nw > MM_SHARD_MAX) {
+        return -1;
+    }
+    for (w = 0; w < nw; w++) {
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+            break;
+        }
+        sh->pid[w] = fork();
+        if (sh->pid[w] == 0) {
+            for (v = 0; v < w; v++) {
+                close(sh->fd[v]);
+            }
+            close(sv[0]);
+            _exit(mm_shard_serve(sv[1], key, pkd) != 0);
+        }
+        close(sv[1]);
+        if (sh->pid[w] < 0) {
+            sh->pid[w] = 0;
+            close(sv[0]);
+            break;
+        }
+        sh->fd[w] = sv[0];
+    }
+    sh->nw = w;
+    if (w < nw) {
+        mm_shard_close(sh);
+        return -1;
+    }
+
+    return 0;
+}
+
+//  coordinator: ^ct here, ct_i (and K_i) from the workers
+
+static size_t shd_run(  mm_shard_t *sh, uint8_t *ct, uint8_t *kk,
+                        const int32_t *a_mat, const uint64_t *ids,
+                        const uint8_t *mm, size_t n,
+                        const uint8_t seed_e[32])
+{
+    mm_ses_t ses;
+    uint64_t i0[MM_SHARD_MAX], i1[MM_SHARD_MAX], seq[MM_SHARD_MAX];
+    uint64_t s, sid, len, cnt;
+    uint8_t *q, *p, *r;
+    size_t i, j, ct_sz, cti_sz, m_sz, k, q_sz, r_sz;
+    int w, fail = 0;
+
+    if (sh->nw < 1) {
+        return 0;
+    }
+    //  new session on first use
+    while (sh->sid == 0) {
+        if (shd_rand((uint8_t *) &sh->sid, sizeof(sh->sid)) != 0) {
+            return 0;
+        }
+        shd_skey(sh->sk, sh->key, sh->sid);
+    }
+    ct_sz = mm_ses_init(&ses, ct, a_mat, seed_e, n);
+    cti_sz = mm != NULL ? MMPKE_CTI_SZ : MMKEM_CTI_SZ;
+    m_sz = mm != NULL ? MMPKE_M_SZ : 0;
+    k = mm != NULL ? 0 : MMKEM_K_SZ;
+
+    //  shards out
+    for (w = 0; w < sh->nw; w++) {
+        i0[w] = n * w / sh->nw;
+        i1[w] = n * (w + 1) / sh->nw;
+        cnt = i1[w] - i0[w];
+        seq[w] = 0;
+        if (cnt == 0 || fail) {
+            continue;
+        }
+        q_sz = SHD_Q_FIX + cnt * (8 + m_sz);
+        q = (uint8_t *) malloc(q_sz);
+        if (q == NULL) {
+            fail++;
+            continue;
+        }
+        memset(q, 0, 8);
+        q[0] = mm != NULL ? 'P' : 'E';
+        put64u_le(q + 8, i0[w]);
+        put64u_le(q + 16, i1[w]);
+        memcpy(q + 24, ses.seed_e, 32);
+        p = q + 56;
+        for (i = 0; i < MM_N; i++) {
+            for (j = 0; j < MM_D; j++) {
+                put32u_le(p, (uint32_t) ses.r_u[i][j]);
+                p += 4;
+            }
+        }
+        for (i = 0; i < cnt; i++) {
+            put64u_le(p, ids[i0[w] + i]);
+            p += 8;
+        }
+        if (mm != NULL) {
+            memcpy(p, mm + i0[w] * m_sz, cnt * m_sz);
+        }
+        seq[w] = ++sh->seq;
+        fail += shd_send(sh->fd[w], sh->sk, 'Q', sh->sid, seq[w],
+                            q, q_sz) != 0;
+        memset(q, 0, q_sz);
+        free(q);
+    }
+    mm_ses_clear(&ses);
+
+    //  slices back in index order; drain every link that has a shard
+    for (w = 0; w < sh->nw; w++) {
+        cnt = i1[w] - i0[w];
+        if (seq[w] == 0) {
+            continue;
+        }
+        r_sz = SHD_R_FIX + cnt * (cti_sz + k);
+        if (shd_recv_hdr(sh->fd[w], 'R', &sid, &s, &len) != 0 ||
+            sid != sh->sid || s != seq[w] ||
+            (len != r_sz && len != SHD_R_FIX)) {
+            fail++;
+            continue;
+        }
+        r = (uint8_t *) malloc(len);
+        if (r == NULL ||
+            shd_recv_body(sh->fd[w], sh->sk, 'R', s, r, len) != 0 ||
+            len != r_sz || get32u_le(r) != MM_SHARD_OK) {
+            fail++;
+        } else {
+            memcpy(ct + ct_sz + i0[w] * cti_sz, r + SHD_R_FIX, cnt * cti_sz);
+            if (kk != NULL) {
+                memcpy(kk + i0[w] * k, r + SHD_R_FIX + cnt * cti_sz,
+                        cnt * k);
+            }
+        }
+        if (r != NULL) {
+            memset(r, 0, len);
+            free(r);
+        }
+    }
+
+    if (fail) {
+        if (kk != NULL) {
+            memset(kk, 0, n * k);
+        }
+        return 0;
+    }
+    return ct_sz + n * cti_sz;
+}
+
+//  mmKEM: mm_encap() to directory ids[0..n-1], split across the workers.
+
+size_t mm_shard_encap(  mm_shard_t *sh, uint8_t *ct, uint8_t *kk,
+                        const int32_t *a_mat, const uint64_t *ids,
+                        size_t n, const uint8_t seed_e[32])
+{
+    return shd_run(sh, ct, kk, a_mat, ids, NULL, n, seed_e);
+}
+
+//  mmPKE: mm_enc() to directory ids[0..n-1] with messages "mm".
+
+size_t mm_shard_enc(mm_shard_t *sh, uint8_t *ct, const int32_t *a_mat,
+                    const uint64_t *ids, const uint8_t *mm, size_t n,
+                    const uint8_t seed_e[32])
+{
+    return shd_run(sh, ct, NULL, a_mat, ids, mm, n, seed_e);
+}
+
+//  Close the links and wait for spawned workers.
+
+void mm_shard_close(mm_shard_t *sh)
+{
+    int w, st;
+
+    for (w = 0; w < sh->nw; w++) {
+        close(sh->fd[w]);
+        if (sh->pid[w] > 0) {
+            waitpid(sh->pid[w], &st, 0);
+        }
+    }
+    memset(sh, 0, sizeof(mm_shard_t));
+}
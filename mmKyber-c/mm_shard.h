@@ -0,0 +1,98 @@
+//  mm_shard.h
+//  === Header: Sharded encapsulation over worker processes.
+
+#ifndef _MM_SHARD_H_
+#define _MM_SHARD_H_
+
+#include <sys/types.h>
+
+#include "plat_local.h"
+#include "mm_param.h"
+#include "mm_pkdir.h"
+
+/*
+    The coordinator computes ^ct once and gives each worker a shard: the
+    encapsulation session (r in ntt domain, seed_e) positioned at a
+    recipient range, and the directory ids of those recipients. Workers
+    hold the same public key directory and return ct_i (and K_i) of their
+    range; the coordinator places them in index order, so the output is
+    that of mm_encap() / mm_enc() with the directory keys.
+
+    Every message is a 32-byte header and a body encrypted and
+    authenticated as MM_DEM_CHUNK chunks (mm_dem.h):
+
+    offset  size    header field
+    0       4       magic "mmSH"
+    4       1       direction ('Q' to the worker, 'R' back)
+    5       3       reserved (zero)
+    8       8       session id
+    16      8       sequence number; nonce = direction || 0^7 || seq
+    24      8       body size
+
+    The coordinator draws a random nonzero session id when it first uses
+    its links, and the body key is SHAKE256(link key || "mmSH" || id), so
+    a zeroed mm_shard_t (sequence numbers from 1 again) does not reuse
+    keystream. Within a session each sequence number is used once (for
+    all workers); a worker binds to the id of the first shard and rejects
+    other ids and numbers that do not increase.
+
+    'Q' body:   op ('E' mmKEM, 'P' mmPKE) || 0^7 || i0 || i1 || seed_e ||
+                r (int32) || ids (u64) [|| messages]
+    'R' body:   status (u32) || 0^4 || ct_i0 .. [|| K_i0 ..]
+*/
+
+#define MM_SHARD_MAGIC  "mmSH"
+#define MM_SHARD_HDR_SZ 32
+#define MM_SHARD_KEY_SZ 32
+
+//  status
+#define MM_SHARD_OK     0
+#define MM_SHARD_EREQ   1           //  malformed shard
+#define MM_SHARD_ENOKEY 2           //  unknown recipient id
+
+#ifndef MM_SHARD_MAX
+#define MM_SHARD_MAX    64          //  workers
+#endif
+
+#ifndef MM_SHARD_N_MAX
+#define MM_SHARD_N_MAX  (1 << 24)   //  recipients per shard
+#endif
+
+//  coordinator: links to "nw" workers
+
+typedef struct {
+    int nw;
+    int fd[MM_SHARD_MAX];           //  connected stream sockets
+    pid_t pid[MM_SHARD_MAX];        //  from mm_shard_spawn(), else 0
+    uint8_t key[MM_SHARD_KEY_SZ];   //  link key
+    uint64_t sid;                   //  session id, 0 until first use
+    uint8_t sk[MM_SHARD_KEY_SZ];    //  session key
+    uint64_t seq;                   //  last sequence number used
+} mm_shard_t;
+
+//  Fork "nw" local workers serving directory "pkd" over socket pairs
+//  with link key "key". Returns 0 on success.
+int mm_shard_spawn( mm_shard_t *sh, int nw,
+                    const uint8_t key[MM_SHARD_KEY_SZ], const mm_pkd_t *pkd);
+
+//  Worker: serve shards on "fd" until the link is closed (returns 0) or
+//  a message fails to authenticate (returns -1).
+int mm_shard_serve( int fd, const uint8_t key[MM_SHARD_KEY_SZ],
+                    const mm_pkd_t *pkd);
+
+//  mmKEM: mm_encap() to directory ids[0..n-1], split across the workers.
+//  Returns the length of ct, or 0 on failure.
+size_t mm_shard_encap(  mm_shard_t *sh, uint8_t *ct, uint8_t *kk,
+                        const int32_t *a_mat, const uint64_t *ids,
+                        size_t n, const uint8_t seed_e[32]);
+
+//  mmPKE: mm_enc() to directory ids[0..n-1] with messages "mm".
+//  Returns the length of ct, or 0 on failure.
+size_t mm_shard_enc(mm_shard_t *sh, uint8_t *ct, const int32_t *a_mat,
+                    const uint64_t *ids, const uint8_t *mm, size_t n,
+                    const uint8_t seed_e[32]);
+
+//  Close the links and wait for spawned workers.
+void mm_shard_close(mm_shard_t *sh);
+
+#endif
@@ -0,0 +1,393 @@
+//  mm_shq.c
+//  === Shared-memory submission / completion queues.
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mm_shq.h"
+#include "mmkyber.h"
+
+//  the indexes are on their own cache lines
+typedef char shq_hdr_chk[sizeof(mm_shq_hdr_t) == 320 ? 1 : -1];
+
+//  a worker and the regions it consumes
+
+typedef struct {
+    mm_shq_pool_t *p;
+    pthread_t th;
+    mm_shq_t *q[MM_SHQ_Q_MAX];
+    _Atomic int nq;
+} shq_worker_t;
+
+struct mm_shq_pool_s {
+    const int32_t *a_mat;
+    int nt, busy, next;
+    uint32_t idle_us;
+    _Atomic int stop;
+    pthread_mutex_t mx;             //  serializes mm_shq_pool_add()
+    shq_worker_t w[MM_SHQ_THR_MAX];
+};
+
+//  spin-wait hint
+
+static inline void shq_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+//  set up the pointers of a mapped region; -1 if the header is bad
+
+static int shq_attach(mm_shq_t *q, uint8_t *p, size_t sz)
+{
+    mm_shq_hdr_t *h = (mm_shq_hdr_t *) p;
+    uint64_t s;
+
+    if (sz < sizeof(mm_shq_hdr_t) || memcmp(h->magic, MM_SHQ_MAGIC, 4) ||
+        h->version != MM_SHQ_VERSION || h->level != MM_LEVEL) {
+        return -1;
+    }
+    s = h->slots;
+    if (s == 0 || (s & (s - 1)) != 0 || h->size != sz ||
+        h->sq_off < sizeof(mm_shq_hdr_t) ||
+        h->cq_off < h->sq_off + s * sizeof(mm_shq_req_t) ||
+        h->data_off < h->cq_off + s * sizeof(mm_shq_cpl_t) ||
+        h->data_off > sz || h->data_sz > sz - h->data_off) {
+        return -1;
+    }
+    q->hdr = h;
+    q->sq = (mm_shq_req_t *) (p + h->sq_off);
+    q->cq = (mm_shq_cpl_t *) (p + h->cq_off);
+    q->data = p + h->data_off;
+    q->slots = (uint32_t) s;
+    q->data_sz = h->data_sz;
+    q->sz = sz;
+
+    return 0;
+}
+
+//  Create region file "fn" with "slots" entries and "data_sz" bytes.
+
+int mm_shq_create(mm_shq_t *q, const char *fn, uint32_t slots,
+                    size_t data_sz)
+{
+    mm_shq_hdr_t h;
+    uint64_t s, sz;
+    void *p;
+    int fd;
+
+    s = 1;
+    while (s < slots) {
+        s <<= 1;
+    }
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, MM_SHQ_MAGIC, 4);
+    h.version = MM_SHQ_VERSION;
+    h.level = MM_LEVEL;
+    h.slots = (uint32_t) s;
+    h.sq_off = sizeof(mm_shq_hdr_t);
+    h.cq_off = h.sq_off + s * sizeof(mm_shq_req_t);
+    h.data_off = (h.cq_off + s * sizeof(mm_shq_cpl_t) + 63) & ~63ull;
+    h.data_sz = data_sz;
+    sz = h.data_off + data_sz;
+    h.size = sz;
+
+    fd = open(fn, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return -1;
+    }
+    if (ftruncate(fd, sz) != 0) {
+        close(fd);
+        return -1;
+    }
+    p = mmap(NULL, sz, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    memcpy(p, &h, sizeof(h));
+
+    return shq_attach(q, (uint8_t *) p, sz);
+}
+
+//  Map an existing region file "fn". Returns 0 on success.
+
+int mm_shq_open(mm_shq_t *q, const char *fn)
+{
+    struct stat st;
+    void *p;
+    int fd;
+
+    fd = open(fn, O_RDWR);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(mm_shq_hdr_t)) {
+        close(fd);
+        return -1;
+    }
+    p = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return -1;
+    }
+    if (shq_attach(q, (uint8_t *) p, st.st_size) != 0) {
+        munmap(p, st.st_size);
+        return -1;
+    }
+
+    return 0;
+}
+
+//  Unmap a region.
+
+void mm_shq_close(mm_shq_t *q)
+{
+    if (q->hdr != NULL) {
+        munmap(q->hdr, q->sz);
+    }
+    memset(q, 0, sizeof(mm_shq_t));
+}
+
+//  Client: submit request "r". Returns 0, or -1 if the queue is full.
+
+int mm_shq_submit(mm_shq_t *q, const mm_shq_req_t *r)
+{
+    uint64_t t, h;
+
+    t = atomic_load_explicit(&q->hdr->sq_tail, memory_order_relaxed);
+    h = atomic_load_explicit(&q->hdr->sq_head, memory_order_acquire);
+    if (t - h >= q->slots) {
+        return -1;
+    }
+    q->sq[t & (q->slots - 1)] = *r;
+    atomic_store_explicit(&q->hdr->sq_tail, t + 1, memory_order_release);
+
+    return 0;
+}
+
+//  Client: take one completion. Returns 1 if "c" was filled, else 0.
+
+int mm_shq_poll(mm_shq_t *q, mm_shq_cpl_t *c)
+{
+    uint64_t t, h;
+
+    h = atomic_load_explicit(&q->hdr->cq_head, memory_order_relaxed);
+    t = atomic_load_explicit(&q->hdr->cq_tail, memory_order_acquire);
+    if (h == t) {
+        return 0;
+    }
+    *c = q->cq[h & (q->slots - 1)];
+    atomic_store_explicit(&q->hdr->cq_head, h + 1, memory_order_release);
+
+    return 1;
+}
+
+//  Client: wait for a completion; spin if "busy", else yield the cpu.
+
+void mm_shq_wait(mm_shq_t *q, mm_shq_cpl_t *c, int busy)
+{
+    while (!mm_shq_poll(q, c)) {
+        if (busy) {
+            shq_relax();
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+//  is [off, off + len) inside the data area?
+
+static inline int shq_in(const mm_shq_t *q, uint64_t off, uint64_t len)
+{
+    return off <= q->data_sz && len <= q->data_sz - off;
+}
+
+//  execute one request on buffers of the data area
+
+static uint32_t shq_exec(   const int32_t *a_mat, const mm_shq_t *q,
+                            const mm_shq_req_t *r)
+{
+    mm_ses_t ses;
+    uint64_t i, n = r->n;
+    uint8_t *d = q->data;
+    size_t ct_sz;
+
+    if (r->op == MM_SHQ_ENCAP) {
+        if (n == 0 || n > q->data_sz / MM_PK_SZ ||
+            !shq_in(q, r->in, n * MM_PK_SZ) ||
+            !shq_in(q, r->out, MM_CTU_SZ + n * MMKEM_CTI_SZ) ||
+            !shq_in(q, r->key, n * MMKEM_K_SZ)) {
+            return MM_SHQ_EREQ;
+        }
+        ct_sz = mm_ses_init(&ses, d + r->out, a_mat, r->seed_e, n);
+        for (i = 0; i < n; i++) {
+            mm_ses_encap(&ses, d + r->out + ct_sz,
+                            d + r->key + i * MMKEM_K_SZ,
+                            d + r->in + i * MM_PK_SZ);
+            ct_sz += MMKEM_CTI_SZ;
+        }
+        mm_ses_clear(&ses);
+        return MM_SHQ_OK;
+    }
+
+    if (r->op == MM_SHQ_DECAP) {
+        if (!shq_in(q, r->in, MM_SK_SZ) || !shq_in(q, r->out, MM_CTU_SZ) ||
+            !shq_in(q, r->aux, MMKEM_CTI_SZ) ||
+            !shq_in(q, r->key, MMKEM_K_SZ)) {
+            return MM_SHQ_EREQ;
+        }
+        mm_decap(d + r->key, d + r->in, d + r->out, d + r->aux);
+        return MM_SHQ_OK;
+    }
+
+    return MM_SHQ_EREQ;
+}
+
+//  drain the submissions of region "q" while there is completion space
+
+static int shq_drain(const int32_t *a_mat, mm_shq_t *q)
+{
+    mm_shq_hdr_t *h = q->hdr;
+    mm_shq_req_t r;
+    mm_shq_cpl_t *c;
+    uint64_t sh, st, ch, ct, t0;
+    uint64_t msk = q->slots - 1;
+    int k = 0;
+
+    sh = atomic_load_explicit(&h->sq_head, memory_order_relaxed);
+    st = atomic_load_explicit(&h->sq_tail, memory_order_acquire);
+    ct = atomic_load_explicit(&h->cq_tail, memory_order_relaxed);
+    ch = atomic_load_explicit(&h->cq_head, memory_order_acquire);
+
+    while (sh != st) {
+        if (ct - ch >= q->slots) {
+            ch = atomic_load_explicit(&h->cq_head, memory_order_acquire);
+            if (ct - ch >= q->slots) {
+                break;
+            }
+        }
+        r = q->sq[sh & msk];
+        atomic_store_explicit(&h->sq_head, ++sh, memory_order_release);
+
+        t0 = plat_get_ns();
+        c = &q->cq[ct & msk];
+        c->st = shq_exec(a_mat, q, &r);
+        c->tag = r.tag;
+        c->n = r.n;
+        c->t_sub = r.t_sub;
+        c->t_start = t0;
+        c->t_done = plat_get_ns();
+        atomic_store_explicit(&h->cq_tail, ++ct, memory_order_release);
+        k++;
+    }
+    memset(&r, 0, sizeof(r));
+
+    return k;
+}
+
+//  worker thread
+
+static void *shq_worker(void *arg)
+{
+    shq_worker_t *w = (shq_worker_t *) arg;
+    mm_shq_pool_t *p = w->p;
+    int i, nq, k;
+
+    while (!atomic_load_explicit(&p->stop, memory_order_relaxed)) {
+        nq = atomic_load_explicit(&w->nq, memory_order_acquire);
+        k = 0;
+        for (i = 0; i < nq; i++) {
+            k += shq_drain(p->a_mat, w->q[i]);
+        }
+        if (k == 0) {
+            if (p->busy) {
+                shq_relax();
+            } else {
+                usleep(p->idle_us);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+//  Start "threads" workers using public parameters "a_mat".
+
+mm_shq_pool_t *mm_shq_pool_start(   const int32_t *a_mat, int threads,
+                                    int busy, uint32_t idle_us)
+{
+    mm_shq_pool_t *p;
+    int t;
+
+    p = (mm_shq_pool_t *) calloc(1, sizeof(mm_shq_pool_t));
+    if (p == NULL) {
+        return NULL;
+    }
+    p->a_mat = a_mat;
+    p->busy = busy;
+    p->idle_us = idle_us;
+    pthread_mutex_init(&p->mx, NULL);
+    if (threads < 1) {
+        threads = 1;
+    }
+    if (threads > MM_SHQ_THR_MAX) {
+        threads = MM_SHQ_THR_MAX;
+    }
+    for (t = 0; t < threads; t++) {
+        p->w[t].p = p;
+        if (pthread_create(&p->w[t].th, NULL, shq_worker, &p->w[t]) != 0) {
+            break;
+        }
+    }
+    p->nt = t;
+    if (t == 0) {
+        pthread_mutex_destroy(&p->mx);
+        free(p);
+        return NULL;
+    }
+
+    return p;
+}
+
+//  Assign region "q" to a worker (round robin). Returns 0 on success.
+
+int mm_shq_pool_add(mm_shq_pool_t *p, mm_shq_t *q)
+{
+    shq_worker_t *w;
+    int nq, r = -1;
+
+    pthread_mutex_lock(&p->mx);
+    w = &p->w[p->next % p->nt];
+    nq = atomic_load_explicit(&w->nq, memory_order_relaxed);
+    if (nq < MM_SHQ_Q_MAX) {
+        w->q[nq] = q;
+        atomic_store_explicit(&w->nq, nq + 1, memory_order_release);
+        p->next++;
+        r = 0;
+    }
+    pthread_mutex_unlock(&p->mx);
+
+    return r;
+}
+
+//  Stop the workers and free the pool.
+
+void mm_shq_pool_stop(mm_shq_pool_t *p)
+{
+    int t;
+
+    atomic_store(&p->stop, 1);
+    for (t = 0; t < p->nt; t++) {
+        pthread_join(p->w[t].th, NULL);
+    }
+    pthread_mutex_destroy(&p->mx);
+    free(p);
+}
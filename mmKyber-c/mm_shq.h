@@ -0,0 +1,139 @@
+//  mm_shq.h
+//  === Header: Shared-memory submission / completion queues.
+
+#ifndef _MM_SHQ_H_
+#define _MM_SHQ_H_
+
+#include <stdatomic.h>
+
+#include "plat_local.h"
+#include "mm_param.h"
+
+/*
+    One region (a file, typically in /dev/shm) per client process:
+
+    header      320 bytes; queue indexes on separate cache lines
+    sq          "slots" mm_shq_req_t entries (client -> worker)
+    cq          "slots" mm_shq_cpl_t entries (worker -> client)
+    data        buffer area; requests refer to it by offset
+
+    Both queues are single-producer / single-consumer rings: the client
+    is the only producer of sq and consumer of cq, and the worker the
+    region is assigned to is the only consumer of sq and producer of cq.
+    Indexes increase monotonically; entry i is at i mod slots.
+
+    MM_SHQ_ENCAP    in:  n packed public keys (n * MM_PK_SZ bytes)
+                    out: ct = ct_u || ct_1 .. ct_n, as from mm_encap()
+                    key: K_1 .. K_n
+    MM_SHQ_DECAP    in:  sk; out: ct_u; aux: ct_i; key: K_i
+*/
+
+#define MM_SHQ_MAGIC    "mmKQ"
+#define MM_SHQ_VERSION  1
+
+//  operations
+#define MM_SHQ_ENCAP    'E'
+#define MM_SHQ_DECAP    'D'
+
+//  completion status
+#define MM_SHQ_OK       0
+#define MM_SHQ_EREQ     1           //  bad operation or buffer range
+
+#ifndef MM_SHQ_THR_MAX
+#define MM_SHQ_THR_MAX  64
+#endif
+
+#ifndef MM_SHQ_Q_MAX
+#define MM_SHQ_Q_MAX    256         //  regions per worker
+#endif
+
+//  submission entry
+
+typedef struct {
+    uint64_t tag;                   //  echoed in the completion
+    uint8_t op;                     //  MM_SHQ_ENCAP, MM_SHQ_DECAP
+    uint8_t rsv[3];
+    uint32_t n;                     //  recipients
+    uint64_t in, out, aux, key;     //  data area offsets
+    uint64_t t_sub;                 //  submission time (plat_get_ns())
+    uint8_t seed_e[32];             //  mmEncap randomness
+} mm_shq_req_t;
+
+//  completion entry with per-request timing (CLOCK_MONOTONIC ns)
+
+typedef struct {
+    uint64_t tag;
+    uint32_t st;                    //  MM_SHQ_OK ..
+    uint32_t n;
+    uint64_t t_sub, t_start, t_done;
+} mm_shq_cpl_t;
+
+//  region header
+
+typedef struct {
+    char magic[4];
+    uint16_t version, level;
+    uint32_t slots;                 //  power of two
+    uint32_t rsv;
+    uint64_t sq_off, cq_off;        //  ring offsets
+    uint64_t data_off, data_sz;     //  data area
+    uint64_t size;                  //  region size
+    uint8_t pad0[8];
+    _Atomic uint64_t sq_head;       //  consumed by the worker
+    uint8_t pad1[56];
+    _Atomic uint64_t sq_tail;       //  produced by the client
+    uint8_t pad2[56];
+    _Atomic uint64_t cq_head;       //  consumed by the client
+    uint8_t pad3[56];
+    _Atomic uint64_t cq_tail;       //  produced by the worker
+    uint8_t pad4[56];
+} mm_shq_hdr_t;
+
+//  a mapped region
+
+typedef struct {
+    mm_shq_hdr_t *hdr;
+    mm_shq_req_t *sq;
+    mm_shq_cpl_t *cq;
+    uint8_t *data;                  //  data area base
+    uint32_t slots;                 //  copies of the header at open
+    uint64_t data_sz;
+    size_t sz;
+} mm_shq_t;
+
+//  worker pool
+
+typedef struct mm_shq_pool_s mm_shq_pool_t;
+
+//  Create region file "fn" with "slots" queue entries (rounded up to a
+//  power of two) and "data_sz" bytes of data area, and map it.
+int mm_shq_create(mm_shq_t *q, const char *fn, uint32_t slots,
+                    size_t data_sz);
+
+//  Map an existing region file "fn". Returns 0 on success.
+int mm_shq_open(mm_shq_t *q, const char *fn);
+
+//  Unmap a region.
+void mm_shq_close(mm_shq_t *q);
+
+//  Client: submit request "r". Returns 0, or -1 if the queue is full.
+int mm_shq_submit(mm_shq_t *q, const mm_shq_req_t *r);
+
+//  Client: take one completion. Returns 1 if "c" was filled, else 0.
+int mm_shq_poll(mm_shq_t *q, mm_shq_cpl_t *c);
+
+//  Client: wait for a completion; spin if "busy", else yield the cpu.
+void mm_shq_wait(mm_shq_t *q, mm_shq_cpl_t *c, int busy);
+
+//  Start "threads" workers using public parameters "a_mat". Workers
+//  busy-poll if "busy", otherwise sleep "idle_us" when there is no work.
+mm_shq_pool_t *mm_shq_pool_start(   const int32_t *a_mat, int threads,
+                                    int busy, uint32_t idle_us);
+
+//  Assign region "q" to a worker (round robin). Returns 0 on success.
+int mm_shq_pool_add(mm_shq_pool_t *p, mm_shq_t *q);
+
+//  Stop the workers and free the pool.
+void mm_shq_pool_stop(mm_shq_pool_t *p);
+
+#endif
@@ -0,0 +1,268 @@
+//  mm_skcache.c
+//  === Seed-only private keys with an LRU cache of expanded keys.
+
+#include <string.h>
+
+#include "mm_skcache.h"
+#include "mmkyber.h"
+
+#define SKC_NIL 0xFFFFFFFFu
+
+//  mix the tenant id into a hash table index
+
+static inline uint32_t skc_hash(const mm_skc_t *c, uint64_t id)
+{
+    id ^= id >> 33;
+    id *= 0xFF51AFD7ED558CCDull;
+    id ^= id >> 33;
+    return ((uint32_t) id) & c->hmsk;
+}
+
+//  hash table size for "n" entries (power of two)
+
+static size_t skc_hsz(size_t n)
+{
+    size_t h = 1;
+
+    while (h < n) {
+        h <<= 1;
+    }
+    return h;
+}
+
+//  Memory required for a cache that holds "n" expanded keys.
+
+size_t mm_skc_mem_sz(size_t n)
+{
+    return 63 + n * sizeof(mm_skc_ent_t) + skc_hsz(n) * sizeof(uint32_t);
+}
+
+//  Initialize cache "c" in "mem" (mem_sz bytes). Return capacity in keys.
+
+size_t mm_skc_init(mm_skc_t *c, void *mem, size_t mem_sz)
+{
+    size_t i, n, hsz;
+    uint8_t *p;
+
+    memset(c, 0, sizeof(mm_skc_t));
+    c->head = SKC_NIL;
+    c->tail = SKC_NIL;
+
+    //  largest capacity that fits
+    n = mem_sz / sizeof(mm_skc_ent_t);
+    while (n > 0 && mm_skc_mem_sz(n) > mem_sz) {
+        n--;
+    }
+    if (n == 0 || n >= SKC_NIL) {
+        return 0;
+    }
+    hsz = skc_hsz(n);
+
+    //  entries are 64-byte aligned, hash table follows
+    p = (uint8_t *) mem;
+    p += (64 - (((uintptr_t) p) & 63)) & 63;
+    c->ent  = (mm_skc_ent_t *) p;
+    c->htab = (uint32_t *) (p + n * sizeof(mm_skc_ent_t));
+    c->cap  = n;
+    c->hmsk = hsz - 1;
+
+    for (i = 0; i < hsz; i++) {
+        c->htab[i] = SKC_NIL;
+    }
+
+    return n;
+}
+
+//  unlink entry "x" from the LRU list
+
+static void skc_unlink(mm_skc_t *c, uint32_t x)
+{
+    mm_skc_ent_t *e = &c->ent[x];
+
+    if (e->prv != SKC_NIL) {
+        c->ent[e->prv].nxt = e->nxt;
+    } else {
+        c->head = e->nxt;
+    }
+    if (e->nxt != SKC_NIL) {
+        c->ent[e->nxt].prv = e->prv;
+    } else {
+        c->tail = e->prv;
+    }
+}
+
+//  insert entry "x" at the head (most recently used)
+
+static void skc_push(mm_skc_t *c, uint32_t x)
+{
+    mm_skc_ent_t *e = &c->ent[x];
+
+    e->prv = SKC_NIL;
+    e->nxt = c->head;
+    if (c->head != SKC_NIL) {
+        c->ent[c->head].prv = x;
+    } else {
+        c->tail = x;
+    }
+    c->head = x;
+}
+
+//  remove entry "x" from its hash chain
+
+static void skc_unhash(mm_skc_t *c, uint32_t x)
+{
+    uint32_t *pp;
+
+    pp = &c->htab[skc_hash(c, c->ent[x].id)];
+    while (*pp != x) {
+        pp = &c->ent[*pp].hnx;
+    }
+    *pp = c->ent[x].hnx;
+}
+
+//  expand "seed_k" into entry "e"
+
+static void skc_expand(mm_skc_ent_t *e, uint64_t id, const uint8_t seed_k[32])
+{
+    uint8_t sk[MM_SK_SZ];
+
+    e->id = id;
+    memcpy(e->seed, seed_k, 32);
+    mm_sk_expand(sk, seed_k);
+    mm_sk_ntt(e->s, sk);
+    memset(sk, 0, sizeof(sk));
+}
+
+//  Get the expanded secret of tenant "id", expanding "seed_k" on a miss.
+
+const int32_t *mm_skc_get(  mm_skc_t *c, uint64_t id,
+                            const uint8_t seed_k[32])
+{
+    int i;
+    uint32_t x, h;
+    uint8_t d;
+    mm_skc_ent_t *e;
+
+    h = skc_hash(c, id);
+    for (x = c->htab[h]; x != SKC_NIL; x = c->ent[x].hnx) {
+        if (c->ent[x].id == id) {
+            break;
+        }
+    }
+
+    if (x != SKC_NIL) {
+        e = &c->ent[x];
+        skc_unlink(c, x);
+        skc_push(c, x);
+
+        //  the seed may have been rotated; compare without early exit
+        d = 0;
+        for (i = 0; i < 32; i++) {
+            d |= e->seed[i] ^ seed_k[i];
+        }
+        if (d == 0) {
+            c->hits++;
+            return e->s;
+        }
+        c->miss++;
+        skc_expand(e, id, seed_k);
+        return e->s;
+    }
+
+    //  miss: take a free entry or evict the least recently used one
+    c->miss++;
+    if (c->used < c->cap) {
+        x = c->used++;
+    } else {
+        x = c->tail;
+        skc_unlink(c, x);
+        skc_unhash(c, x);
+    }
+    e = &c->ent[x];
+    skc_expand(e, id, seed_k);
+
+    e->hnx = c->htab[h];
+    c->htab[h] = x;
+    skc_push(c, x);
+
+    return e->s;
+}
+
+//  Remove tenant "id" from the cache (and clear its key material).
+
+void mm_skc_drop(mm_skc_t *c, uint64_t id)
+{
+    uint32_t x, y;
+    mm_skc_ent_t *e;
+
+    if (c->cap == 0) {
+        return;
+    }
+    for (x = c->htab[skc_hash(c, id)]; x != SKC_NIL; x = c->ent[x].hnx) {
+        if (c->ent[x].id == id) {
+            break;
+        }
+    }
+    if (x == SKC_NIL) {
+        return;
+    }
+    skc_unlink(c, x);
+    skc_unhash(c, x);
+
+    //  keep the used entries contiguous: move the last one into the hole,
+    //  at the same place in the LRU list
+    y = --c->used;
+    if (y != x) {
+        skc_unhash(c, y);
+        e = &c->ent[x];
+        memcpy(e, &c->ent[y], sizeof(mm_skc_ent_t));
+        if (e->prv != SKC_NIL) {
+            c->ent[e->prv].nxt = x;
+        } else {
+            c->head = x;
+        }
+        if (e->nxt != SKC_NIL) {
+            c->ent[e->nxt].prv = x;
+        } else {
+            c->tail = x;
+        }
+        e->hnx = c->htab[skc_hash(c, e->id)];
+        c->htab[skc_hash(c, e->id)] = x;
+    }
+    memset(&c->ent[y], 0, sizeof(mm_skc_ent_t));
+}
+
+//  Clear all key material from the cache.
+
+void mm_skc_clear(mm_skc_t *c)
+{
+    uint32_t i;
+
+    if (c->ent != NULL) {
+        memset(c->ent, 0, c->cap * sizeof(mm_skc_ent_t));
+        for (i = 0; i <= c->hmsk; i++) {
+            c->htab[i] = SKC_NIL;
+        }
+    }
+    c->used = 0;
+    c->head = SKC_NIL;
+    c->tail = SKC_NIL;
+}
+
+//  mmKEM: Decapsulate for tenant "id" stored as "seed_k".
+
+void mm_skc_decap(  mm_skc_t *c, uint8_t *k, uint64_t id,
+                    const uint8_t seed_k[32],
+                    const uint8_t *ctu, const uint8_t *cti)
+{
+    mm_decap_ntt(k, mm_skc_get(c, id, seed_k), ctu, cti);
+}
+
+//  mmPKE: Decrypt for tenant "id" stored as "seed_k".
+
+void mm_skc_dec(mm_skc_t *c, uint8_t *m, uint64_t id,
+                const uint8_t seed_k[32],
+                const uint8_t *ctu, const uint8_t *cti)
+{
+    mm_dec_ntt(m, mm_skc_get(c, id, seed_k), ctu, cti);
+}
@@ -0,0 +1,58 @@
+//  mm_skcache.h
+//  === Header: Seed-only private keys with an LRU cache of expanded keys.
+
+#ifndef _MM_SKCACHE_H_
+#define _MM_SKCACHE_H_
+
+#include "plat_local.h"
+#include "mm_param.h"
+
+//  A tenant is stored as its 32-byte "seed_k" only; the NTT-domain secret
+//  (M * D words) is re-derived on a cache miss. All memory is supplied by
+//  the caller, which bounds the number of cached keys.
+
+typedef struct {
+    uint64_t id;                    //  tenant identifier
+    uint8_t  seed[32];              //  seed_k of the cached key
+    uint32_t prv, nxt;              //  LRU list (MRU at head)
+    uint32_t hnx;                   //  hash chain
+    int32_t  s[MM_M * MM_D];        //  NTT domain secret
+} mm_skc_ent_t;
+
+typedef struct {
+    mm_skc_ent_t *ent;              //  entries
+    uint32_t *htab;                 //  hash buckets
+    uint32_t cap, used, hmsk;       //  capacity, used, hash mask
+    uint32_t head, tail;            //  LRU list ends
+    uint64_t hits, miss;            //  statistics
+} mm_skc_t;
+
+//  Memory required for a cache that holds "n" expanded keys.
+size_t mm_skc_mem_sz(size_t n);
+
+//  Initialize cache "c" in "mem" (mem_sz bytes). Return capacity in keys;
+//  0 if "mem" is too small, and then only drop and clear may be called.
+size_t mm_skc_init(mm_skc_t *c, void *mem, size_t mem_sz);
+
+//  Get the expanded secret of tenant "id", expanding "seed_k" on a miss.
+//  The pointer remains valid until the next mm_skc_get() on the same cache.
+const int32_t *mm_skc_get(  mm_skc_t *c, uint64_t id,
+                            const uint8_t seed_k[32]);
+
+//  Remove tenant "id" from the cache (and clear its key material).
+void mm_skc_drop(mm_skc_t *c, uint64_t id);
+
+//  Clear all key material from the cache.
+void mm_skc_clear(mm_skc_t *c);
+
+//  mmKEM: Decapsulate for tenant "id" stored as "seed_k".
+void mm_skc_decap(  mm_skc_t *c, uint8_t *k, uint64_t id,
+                    const uint8_t seed_k[32],
+                    const uint8_t *ctu, const uint8_t *cti);
+
+//  mmPKE: Decrypt for tenant "id" stored as "seed_k".
+void mm_skc_dec(mm_skc_t *c, uint8_t *m, uint64_t id,
+                const uint8_t seed_k[32],
+                const uint8_t *ctu, const uint8_t *cti);
+
+#endif
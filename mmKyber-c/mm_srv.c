@@ -0,0 +1,785 @@
+//  mm_srv.c
+//  === Batching mmKEM service over a Unix-domain socket.
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                 //  ppoll()
+#endif
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/random.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "mm_srv.h"
+#include "mmkyber.h"
+
+//  a queued request; the response buffer is allocated on arrival. After
+//  its batch it waits in the output queue of its client until sent.
+
+typedef struct srv_req_s {
+    struct srv_req_s *next;
+    int cli;                        //  client slot (-1 if gone)
+    uint8_t op, st;                 //  operation, status
+    uint32_t n;                     //  recipients
+    uint64_t tag, t0;               //  client tag, arrival time
+    uint8_t *in;                    //  request payload
+    uint8_t *out;                   //  response header and payload
+    size_t in_sz, out_sz;           //  allocated sizes
+    size_t len;                     //  response length
+} srv_req_t;
+
+//  request queue
+
+typedef struct {
+    srv_req_t *head, **tail;
+    size_t cnt, rcpt;               //  requests, encap recipients
+    size_t mem;                     //  bytes of queued requests and responses
+} srv_queue_t;
+
+//  a (non-blocking) client connection with its partial input and the
+//  responses not yet sent
+
+typedef struct {
+    int fd;
+    uint8_t *buf;
+    size_t len, cap;
+    srv_req_t *oq, **oq_tail;       //  output queue
+    size_t off;                     //  bytes of oq sent
+    size_t pend;                    //  requests not yet answered
+    int held;                       //  input waits for memory
+} srv_cli_t;
+
+//  one batch, shared by the workers
+
+typedef struct {
+    mm_ses_t ses;
+    const mm_pkd_t *pkd;
+    size_t r;                       //  encapsulation recipients
+    int64_t *key;                   //  key index of recipient j
+    uint8_t **cti, **ki;            //  outputs of recipient j
+    srv_req_t **dec;                //  decapsulation requests
+    size_t nd;
+} srv_batch_t;
+
+//  worker pool: the caller is worker 0, threads 1..nt-1 wait for work
+
+struct srv_pool_s;
+
+typedef struct {
+    struct srv_pool_s *p;
+    int t;
+} srv_targ_t;
+
+typedef struct srv_pool_s {
+    pthread_t th[MM_SRV_THR_MAX];
+    srv_targ_t arg[MM_SRV_THR_MAX];
+    pthread_mutex_t mx;
+    pthread_cond_t go, done;
+    int nt, run, quit;
+    uint64_t gen;
+    srv_batch_t *b;
+} srv_pool_t;
+
+//  fresh randomness for seed_e
+
+static int srv_rand(uint8_t *buf, size_t len)
+{
+    ssize_t r;
+
+    while (len > 0) {
+        r = getrandom(buf, len, 0);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        buf += r;
+        len -= r;
+    }
+    return 0;
+}
+
+//  write a message header
+
+static void srv_hdr(uint8_t *h, uint8_t op, uint8_t st, uint32_t n,
+                    uint32_t sz, uint64_t tag)
+{
+    memcpy(h, MM_SRV_MAGIC, 4);
+    h[4] = op;
+    h[5] = st;
+    h[6] = 0;
+    h[7] = 0;
+    put32u_le(h + 8, n);
+    put32u_le(h + 12, sz);
+    put64u_le(h + 16, tag);
+}
+
+//  copy of session "ses" for indices [i0, i1) of its unused range (an
+//  expired copy otherwise, so that no y_i is ever used twice)
+
+static void srv_ses_sub(mm_ses_t *sub, const mm_ses_t *ses,
+                        uint64_t i0, uint64_t i1)
+{
+    if (i0 < ses->idx || i0 > i1 || i1 > ses->lim) {
+        mm_ses_clear(sub);
+        return;
+    }
+    memcpy(sub, ses, sizeof(mm_ses_t));
+    sub->idx = i0;
+    sub->lim = i1;
+}
+
+//  worker "t" of "nt": a slice of the recipients and every nt'th decap
+
+static void srv_work(srv_batch_t *b, int t, int nt)
+{
+    mm_ses_t ses;
+    size_t j, j0, j1;
+    const uint8_t *p;
+    srv_req_t *q;
+
+    j0 = b->r * t / nt;
+    j1 = b->r * (t + 1) / nt;
+    if (j0 < j1) {
+        srv_ses_sub(&ses, &b->ses, j0, j1);
+        for (j = j0; j < j1; j++) {
+            if (b->pkd->flags & MM_PKD_EXPANDED) {
+                mm_ses_encap_x(&ses, b->cti[j], b->ki[j],
+                                mm_pkd_pkx(b->pkd, b->key[j]));
+            } else {
+                mm_ses_encap(&ses, b->cti[j], b->ki[j],
+                                mm_pkd_pk(b->pkd, b->key[j]));
+            }
+        }
+        mm_ses_clear(&ses);
+    }
+
+    for (j = t; j < b->nd; j += nt) {
+        q = b->dec[j];
+        p = q->in;
+        mm_decap(q->out + MM_SRV_HDR_SZ, p, p + MM_SK_SZ,
+                    p + MM_SK_SZ + MM_CTU_SZ);
+    }
+}
+
+//  pool thread
+
+static void *srv_thread(void *arg)
+{
+    srv_targ_t *a = (srv_targ_t *) arg;
+    srv_pool_t *p = a->p;
+    uint64_t gen = 0;
+
+    pthread_mutex_lock(&p->mx);
+    for (;;) {
+        while (!p->quit && p->gen == gen) {
+            pthread_cond_wait(&p->go, &p->mx);
+        }
+        if (p->quit) {
+            break;
+        }
+        gen = p->gen;
+        pthread_mutex_unlock(&p->mx);
+
+        srv_work(p->b, a->t, p->nt);
+
+        pthread_mutex_lock(&p->mx);
+        if (--p->run == 0) {
+            pthread_cond_signal(&p->done);
+        }
+    }
+    pthread_mutex_unlock(&p->mx);
+
+    return NULL;
+}
+
+//  start "nt" - 1 threads (fewer if creation fails)
+
+static void srv_pool_init(srv_pool_t *p, int nt)
+{
+    int t;
+
+    memset(p, 0, sizeof(srv_pool_t));
+    pthread_mutex_init(&p->mx, NULL);
+    pthread_cond_init(&p->go, NULL);
+    pthread_cond_init(&p->done, NULL);
+    if (nt < 1) {
+        nt = 1;
+    }
+    if (nt > MM_SRV_THR_MAX) {
+        nt = MM_SRV_THR_MAX;
+    }
+    for (t = 1; t < nt; t++) {
+        p->arg[t].p = p;
+        p->arg[t].t = t;
+        if (pthread_create(&p->th[t], NULL, srv_thread, &p->arg[t]) != 0) {
+            break;
+        }
+    }
+    p->nt = t;
+}
+
+//  run batch "b" on all workers
+
+static void srv_pool_run(srv_pool_t *p, srv_batch_t *b)
+{
+    pthread_mutex_lock(&p->mx);
+    p->b = b;
+    p->run = p->nt - 1;
+    p->gen++;
+    pthread_cond_broadcast(&p->go);
+    pthread_mutex_unlock(&p->mx);
+
+    srv_work(b, 0, p->nt);
+
+    pthread_mutex_lock(&p->mx);
+    while (p->run > 0) {
+        pthread_cond_wait(&p->done, &p->mx);
+    }
+    pthread_mutex_unlock(&p->mx);
+}
+
+//  stop and join the threads
+
+static void srv_pool_quit(srv_pool_t *p)
+{
+    int t;
+
+    pthread_mutex_lock(&p->mx);
+    p->quit = 1;
+    pthread_cond_broadcast(&p->go);
+    pthread_mutex_unlock(&p->mx);
+    for (t = 1; t < p->nt; t++) {
+        pthread_join(p->th[t], NULL);
+    }
+    pthread_cond_destroy(&p->go);
+    pthread_cond_destroy(&p->done);
+    pthread_mutex_destroy(&p->mx);
+}
+
+//  free the payload of a request
+
+static void srv_req_free_in(srv_queue_t *qq, srv_req_t *q)
+{
+    if (q->in != NULL) {
+        memset(q->in, 0, q->in_sz);     //  may hold a private key
+        free(q->in);
+        q->in = NULL;
+    }
+    qq->mem -= q->in_sz;
+    q->in_sz = 0;
+}
+
+//  free a request
+
+static void srv_req_free(srv_queue_t *qq, srv_req_t *q)
+{
+    srv_req_free_in(qq, q);
+    if (q->out != NULL) {
+        memset(q->out, 0, q->out_sz);
+        free(q->out);
+    }
+    qq->mem -= q->out_sz;
+    free(q);
+}
+
+//  key index of recipient "id"
+
+static int64_t srv_key(const mm_pkd_t *d, uint64_t id)
+{
+    if (d->idx != NULL) {
+        return mm_pkd_find(d, id);
+    }
+    return id < d->n ? (int64_t) id : -1;
+}
+
+//  run all queued requests as one batch and queue the responses
+
+static void srv_batch(  mm_srv_t *srv, srv_queue_t *qq, srv_pool_t *pool,
+                        srv_cli_t *cli)
+{
+    srv_batch_t *b;
+    srv_req_t *q, *nx;
+    uint8_t seed_e[32], *ctu = NULL;
+    size_t i, j, j0, sz;
+    int64_t k;
+
+    b = (srv_batch_t *) calloc(1, sizeof(srv_batch_t));
+    if (b != NULL) {
+        b->key = (int64_t *) malloc(qq->rcpt * sizeof(int64_t) + 1);
+        b->cti = (uint8_t **) malloc(qq->rcpt * sizeof(uint8_t *) + 1);
+        b->ki  = (uint8_t **) malloc(qq->rcpt * sizeof(uint8_t *) + 1);
+        b->dec = (srv_req_t **) malloc(qq->cnt * sizeof(srv_req_t *) + 1);
+    }
+    if (b == NULL || b->key == NULL || b->cti == NULL ||
+        b->ki == NULL || b->dec == NULL) {
+        for (q = qq->head; q != NULL; q = q->next) {
+            q->st = MM_SRV_EBUSY;
+        }
+        goto send;
+    }
+    b->pkd = srv->pkd;
+
+    //  resolve recipients; each request is all or nothing
+    j = 0;
+    for (q = qq->head; q != NULL; q = q->next) {
+        if (q->st != MM_SRV_OK) {
+            continue;
+        }
+        if (q->op == MM_SRV_DECAP) {
+            b->dec[b->nd++] = q;
+            continue;
+        }
+        j0 = j;
+        for (i = 0; i < q->n; i++) {
+            k = srv_key(srv->pkd, get64u_le(q->in + 8 * i));
+            if (k < 0) {
+                q->st = MM_SRV_ENOKEY;
+                j = j0;
+                break;
+            }
+            b->key[j] = k;
+            b->cti[j] = q->out + MM_SRV_HDR_SZ + MM_CTU_SZ +
+                        i * MMKEM_CTI_SZ;
+            b->ki[j]  = q->out + MM_SRV_HDR_SZ + MM_CTU_SZ +
+                        q->n * MMKEM_CTI_SZ + i * MMKEM_K_SZ;
+            j++;
+        }
+        if (q->st == MM_SRV_OK && ctu == NULL) {
+            ctu = q->out + MM_SRV_HDR_SZ;
+        }
+    }
+    b->r = j;
+
+    //  one ct_u for all recipients of the batch
+    if (b->r > 0) {
+        if (srv_rand(seed_e, 32) != 0) {
+            b->r = 0;
+            for (q = qq->head; q != NULL; q = q->next) {
+                if (q->op == MM_SRV_ENCAP) {
+                    q->st = MM_SRV_EBUSY;
+                }
+            }
+        } else {
+            mm_ses_init(&b->ses, ctu, srv->a_mat, seed_e, b->r);
+            memset(seed_e, 0, sizeof(seed_e));
+        }
+    }
+    if (b->r > 0 || b->nd > 0) {
+        srv_pool_run(pool, b);
+    }
+    mm_ses_clear(&b->ses);
+
+    //  everyone gets the shared ct_u
+    for (q = qq->head; q != NULL; q = q->next) {
+        if (q->st == MM_SRV_OK && q->op == MM_SRV_ENCAP &&
+            q->out + MM_SRV_HDR_SZ != ctu) {
+            memcpy(q->out + MM_SRV_HDR_SZ, ctu, MM_CTU_SZ);
+        }
+    }
+
+    srv->batches++;
+    srv->rcpt += b->r;
+    if (b->r > srv->rcpt_max) {
+        srv->rcpt_max = b->r;
+    }
+
+send:
+    for (q = qq->head; q != NULL; q = nx) {
+        nx = q->next;
+        sz = q->st == MM_SRV_OK ? q->out_sz - MM_SRV_HDR_SZ : 0;
+        srv_hdr(q->out, q->op, q->st, q->n, sz, q->tag);
+        q->len = MM_SRV_HDR_SZ + sz;
+        srv_req_free_in(qq, q);
+        if (q->cli < 0) {
+            srv_req_free(qq, q);
+            continue;
+        }
+        q->next = NULL;
+        *cli[q->cli].oq_tail = q;
+        cli[q->cli].oq_tail = &q->next;
+    }
+    qq->head = NULL;
+    qq->tail = &qq->head;
+    qq->cnt = 0;
+    qq->rcpt = 0;
+
+    if (b != NULL) {
+        free(b->key);
+        free(b->cti);
+        free(b->ki);
+        free(b->dec);
+        free(b);
+    }
+}
+
+//  queue complete requests from the input of client "ci"; -1 on error.
+//  Over the memory limit, a client with requests pending is held (its
+//  input waits); other requests are answered with EBUSY.
+
+static int srv_parse(   mm_srv_t *srv, srv_queue_t *qq, srv_cli_t *cli,
+                        int ci)
+{
+    srv_cli_t *c = &cli[ci];
+    uint8_t *h, *p;
+    uint32_t n, sz;
+    size_t out_sz;
+    srv_req_t *q;
+    int busy;
+
+    c->held = 0;
+    while (c->len >= MM_SRV_HDR_SZ) {
+        h = c->buf;
+        n = get32u_le(h + 8);
+        sz = get32u_le(h + 12);
+        if (memcmp(h, MM_SRV_MAGIC, 4) != 0) {
+            return -1;
+        }
+        if (h[4] == MM_SRV_ENCAP && n > 0 && n <= MM_SRV_N_MAX &&
+            sz == 8 * n) {
+            out_sz = MM_SRV_HDR_SZ + MM_CTU_SZ +
+                        n * (MMKEM_CTI_SZ + MMKEM_K_SZ);
+        } else if (h[4] == MM_SRV_DECAP && n == 1 &&
+            sz == MM_SK_SZ + MM_CTU_SZ + MMKEM_CTI_SZ) {
+            out_sz = MM_SRV_HDR_SZ + MMKEM_K_SZ;
+        } else {
+            return -1;
+        }
+
+        //  wait for the payload
+        if (c->len < MM_SRV_HDR_SZ + sz) {
+            if (c->cap < MM_SRV_HDR_SZ + sz) {
+                p = (uint8_t *) realloc(c->buf, MM_SRV_HDR_SZ + sz);
+                if (p == NULL) {
+                    return -1;
+                }
+                c->buf = p;
+                c->cap = MM_SRV_HDR_SZ + sz;
+            }
+            return 0;
+        }
+
+        //  decide before allocating
+        busy = qq->cnt >= srv->queue_max ||
+                qq->mem + sz + out_sz > srv->mem_max;
+        if (busy && c->pend > 0) {
+            c->held = 1;
+            return 0;
+        }
+
+        q = (srv_req_t *) calloc(1, sizeof(srv_req_t));
+        if (q == NULL) {
+            return -1;
+        }
+        q->cli = ci;
+        q->op = h[4];
+        q->n = n;
+        q->tag = get64u_le(h + 16);
+        q->t0 = plat_get_ns();
+        if (busy) {
+            q->st = MM_SRV_EBUSY;
+            out_sz = MM_SRV_HDR_SZ;
+        }
+        q->in_sz = busy ? 0 : sz;
+        q->out_sz = out_sz;
+        qq->mem += q->in_sz + q->out_sz;
+        q->in = busy ? NULL : (uint8_t *) malloc(sz);
+        q->out = (uint8_t *) malloc(out_sz);
+        if ((!busy && q->in == NULL) || q->out == NULL) {
+            srv_req_free(qq, q);
+            return -1;
+        }
+        if (!busy) {
+            memcpy(q->in, h + MM_SRV_HDR_SZ, sz);
+        }
+
+        *qq->tail = q;
+        qq->tail = &q->next;
+        qq->cnt++;
+        if (q->op == MM_SRV_ENCAP && !busy) {
+            qq->rcpt += n;
+        }
+        c->pend++;
+        srv->reqs++;
+
+        c->len -= MM_SRV_HDR_SZ + sz;
+        memmove(c->buf, c->buf + MM_SRV_HDR_SZ + sz, c->len);
+    }
+
+    return 0;
+}
+
+//  send queued responses of client "c" until its socket is full; -1 on
+//  error
+
+static int srv_flush(srv_queue_t *qq, srv_cli_t *c)
+{
+    srv_req_t *q;
+    ssize_t r;
+
+    while (c->oq != NULL) {
+        q = c->oq;
+        r = send(c->fd, q->out + c->off, q->len - c->off,
+                    MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK ? 0 : -1;
+        }
+        c->off += r;
+        if (c->off < q->len) {
+            continue;
+        }
+        c->off = 0;
+        c->oq = q->next;
+        if (c->oq == NULL) {
+            c->oq_tail = &c->oq;
+        }
+        c->pend--;
+        srv_req_free(qq, q);
+    }
+
+    return 0;
+}
+
+//  reset client slot "c"
+
+static void srv_cli_reset(srv_cli_t *c)
+{
+    memset(c, 0, sizeof(srv_cli_t));
+    c->fd = -1;
+    c->oq_tail = &c->oq;
+}
+
+//  close client "ci"; its queued requests are computed but not sent
+
+static void srv_close(srv_queue_t *qq, srv_cli_t *cli, int ci)
+{
+    srv_cli_t *c = &cli[ci];
+    srv_req_t *q;
+
+    for (q = qq->head; q != NULL; q = q->next) {
+        if (q->cli == ci) {
+            q->cli = -1;
+        }
+    }
+    while (c->oq != NULL) {
+        q = c->oq;
+        c->oq = q->next;
+        srv_req_free(qq, q);
+    }
+    close(c->fd);
+    if (c->buf != NULL) {
+        memset(c->buf, 0, c->cap);
+        free(c->buf);
+    }
+    srv_cli_reset(c);
+}
+
+//  Default configuration for registry "pkd" with matrix "a_mat".
+
+void mm_srv_init(mm_srv_t *srv, const int32_t *a_mat, const mm_pkd_t *pkd)
+{
+    long nc;
+
+    memset(srv, 0, sizeof(mm_srv_t));
+    srv->a_mat = a_mat;
+    srv->pkd = pkd;
+    nc = sysconf(_SC_NPROCESSORS_ONLN);
+    srv->threads = nc > 0 ? (int) nc : 1;
+    srv->batch_max = 1024;
+    srv->wait_us = 200;
+    srv->queue_max = 4096;
+    srv->mem_max = 256 << 20;
+}
+
+//  Create a listening socket at "path". Returns the fd or -1.
+
+int mm_srv_listen(const char *path)
+{
+    struct sockaddr_un sa;
+    int fd;
+
+    if (strlen(path) >= sizeof(sa.sun_path)) {
+        return -1;
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    strcpy(sa.sun_path, path);
+    unlink(path);
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (bind(fd, (struct sockaddr *) &sa, sizeof(sa)) != 0 ||
+        listen(fd, 128) != 0) {
+        close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+//  Serve clients on listening socket "lfd" until srv->stop is set.
+
+int mm_srv_run(mm_srv_t *srv, int lfd)
+{
+    struct pollfd pfd[1 + MM_SRV_CLI_MAX];
+    srv_cli_t cli[MM_SRV_CLI_MAX];
+    srv_pool_t *pool;
+    srv_queue_t qq;
+    struct timespec to;
+    uint64_t now, dl;
+    ssize_t r;
+    int i, k, fd, ev;
+
+    pool = (srv_pool_t *) malloc(sizeof(srv_pool_t));
+    if (pool == NULL) {
+        return -1;
+    }
+    srv_pool_init(pool, srv->threads);
+    for (i = 0; i < MM_SRV_CLI_MAX; i++) {
+        srv_cli_reset(&cli[i]);
+    }
+    qq.head = NULL;
+    qq.tail = &qq.head;
+    qq.cnt = 0;
+    qq.rcpt = 0;
+    qq.mem = 0;
+
+    while (!srv->stop) {
+
+        //  sleep until input or the deadline of the oldest request
+        to.tv_sec = 0;
+        to.tv_nsec = 50000000;
+        if (qq.head != NULL) {
+            now = plat_get_ns();
+            dl = qq.head->t0 + 1000ull * srv->wait_us;
+            to.tv_nsec = dl > now ? (long) (dl - now) : 0;
+            if (to.tv_nsec > 50000000) {
+                to.tv_nsec = 50000000;
+            }
+        }
+        pfd[0].fd = lfd;
+        pfd[0].events = POLLIN;
+        for (i = 0; i < MM_SRV_CLI_MAX; i++) {
+            pfd[1 + i].fd = cli[i].fd;
+            pfd[1 + i].events = (cli[i].held ? 0 : POLLIN) |
+                                (cli[i].oq != NULL ? POLLOUT : 0);
+            pfd[1 + i].revents = 0;
+        }
+        if (ppoll(pfd, 1 + MM_SRV_CLI_MAX, &to, NULL) < 0 && errno != EINTR) {
+            break;
+        }
+
+        //  new connections, non-blocking
+        if (pfd[0].revents & POLLIN) {
+            fd = accept(lfd, NULL, NULL);
+            if (fd >= 0 &&
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) != 0) {
+                close(fd);
+                fd = -1;
+            }
+            for (i = 0; fd >= 0 && i < MM_SRV_CLI_MAX; i++) {
+                if (cli[i].fd < 0) {
+                    cli[i].fd = fd;
+                    fd = -1;
+                }
+            }
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+
+        for (i = 0; i < MM_SRV_CLI_MAX; i++) {
+            ev = pfd[1 + i].revents;
+            if (cli[i].fd < 0) {
+                continue;
+            }
+
+            //  client output; a hang-up shows up as a send error
+            if ((ev & (POLLOUT | POLLERR | POLLHUP)) && cli[i].oq != NULL &&
+                srv_flush(&qq, &cli[i]) != 0) {
+                srv_close(&qq, cli, i);
+                continue;
+            }
+
+            //  client input
+            if (cli[i].held || (ev & (POLLIN | POLLERR | POLLHUP)) == 0) {
+                continue;
+            }
+            if (cli[i].cap - cli[i].len < 4096) {
+                uint8_t *p = (uint8_t *) realloc(cli[i].buf,
+                                                    cli[i].cap + 65536);
+                if (p == NULL) {
+                    srv_close(&qq, cli, i);
+                    continue;
+                }
+                cli[i].buf = p;
+                cli[i].cap += 65536;
+            }
+            r = recv(cli[i].fd, cli[i].buf + cli[i].len,
+                        cli[i].cap - cli[i].len, 0);
+            if (r <= 0) {
+                if (r < 0 && (errno == EINTR || errno == EAGAIN ||
+                                errno == EWOULDBLOCK)) {
+                    continue;
+                }
+                srv_close(&qq, cli, i);
+                continue;
+            }
+            cli[i].len += r;
+            if (srv_parse(srv, &qq, cli, i) != 0) {
+                srv_close(&qq, cli, i);
+            }
+        }
+
+        //  batch when large enough, old enough, or the queue is full;
+        //  send what the sockets take now, the rest on POLLOUT
+        if (qq.head != NULL) {
+            k = qq.rcpt >= srv->batch_max || qq.cnt >= srv->queue_max ||
+                plat_get_ns() >= qq.head->t0 + 1000ull * srv->wait_us;
+            if (k) {
+                srv_batch(srv, &qq, pool, cli);
+                for (i = 0; i < MM_SRV_CLI_MAX; i++) {
+                    if (cli[i].oq != NULL && srv_flush(&qq, &cli[i]) != 0) {
+                        srv_close(&qq, cli, i);
+                    }
+                }
+            }
+        }
+
+        //  input held for memory: retry what is buffered
+        for (i = 0; i < MM_SRV_CLI_MAX; i++) {
+            if (cli[i].held && srv_parse(srv, &qq, cli, i) != 0) {
+                srv_close(&qq, cli, i);
+            }
+        }
+    }
+
+    //  answer what is left, as far as the sockets take it
+    if (qq.head != NULL) {
+        srv_batch(srv, &qq, pool, cli);
+    }
+    for (i = 0; i < MM_SRV_CLI_MAX; i++) {
+        if (cli[i].fd >= 0) {
+            srv_flush(&qq, &cli[i]);
+            srv_close(&qq, cli, i);
+        }
+    }
+    srv_pool_quit(pool);
+    free(pool);
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+//  mm_srv.h
+//  === Header: Batching mmKEM service over a Unix-domain socket.
+
+#ifndef _MM_SRV_H_
+#define _MM_SRV_H_
+
+#include "plat_local.h"
+#include "mm_param.h"
+#include "mm_pkdir.h"
+
+/*
+    Messages (little-endian) are a 24-byte header and a payload:
+
+    offset  size    header field
+    0       4       magic "mmKS"
+    4       1       operation ('E' encap, 'D' decap)
+    5       1       status (responses only, MM_SRV_OK ..)
+    6       2       reserved (zero)
+    8       4       recipient count n
+    12      4       payload size
+    16      8       tag (echoed in the response)
+
+    'E' request:    n * u64 recipient ids (directory ids, or key indexes
+                    if the directory has no index)
+        response:   ct_u || ct_1 .. ct_n || K_1 .. K_n
+    'D' request:    sk || ct_u || ct_i (n = 1)
+        response:   K_i
+
+    Encapsulation requests that arrive within "wait_us" of each other are
+    coalesced: all their recipients are appended to one session (one ct_u)
+    and split across the worker threads. Each caller gets ct_u and only
+    its own ct_i and K_i, in the format of mm_encap().
+
+    Sockets are non-blocking: responses wait in a queue per client and are
+    sent as the client reads them. Requests and responses held by the
+    service are limited to "mem_max" bytes. Over the limit, a request is
+    rejected with EBUSY before any memory is allocated for it. A client
+    that still has responses pending is not read from until memory is
+    freed, so one that stops reading stalls only itself.
+*/
+
+#define MM_SRV_MAGIC    "mmKS"
+#define MM_SRV_HDR_SZ   24
+#define MM_SRV_N_MAX    65536       //  recipients per request
+
+//  operations
+#define MM_SRV_ENCAP    'E'
+#define MM_SRV_DECAP    'D'
+
+//  status
+#define MM_SRV_OK       0
+#define MM_SRV_EREQ     1           //  malformed request
+#define MM_SRV_ENOKEY   2           //  unknown recipient id
+#define MM_SRV_EBUSY    3           //  queue or memory limit reached
+
+#ifndef MM_SRV_THR_MAX
+#define MM_SRV_THR_MAX  64
+#endif
+
+#ifndef MM_SRV_CLI_MAX
+#define MM_SRV_CLI_MAX  256
+#endif
+
+//  service configuration and statistics
+
+typedef struct {
+    const int32_t *a_mat;           //  A of the directory domain
+    const mm_pkd_t *pkd;            //  public key registry
+    int threads;                    //  worker threads (incl. the caller)
+    uint32_t batch_max;             //  run a batch at this many recipients
+    uint32_t wait_us;               //  .. or when a request is this old
+    uint32_t queue_max;             //  pending requests before EBUSY
+    size_t mem_max;                 //  request and response bytes held
+    volatile int stop;              //  set to make mm_srv_run() return
+
+    uint64_t reqs, batches;         //  statistics
+    uint64_t rcpt, rcpt_max;        //  recipients total, largest batch
+} mm_srv_t;
+
+//  Default configuration for registry "pkd" with matrix "a_mat".
+void mm_srv_init(mm_srv_t *srv, const int32_t *a_mat, const mm_pkd_t *pkd);
+
+//  Create a listening socket at "path". Returns the fd or -1.
+int mm_srv_listen(const char *path);
+
+//  Serve clients on listening socket "lfd" until srv->stop is set.
+//  Returns 0, or -1 if resources could not be allocated.
+int mm_srv_run(mm_srv_t *srv, int lfd);
+
+#endif
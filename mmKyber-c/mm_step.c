@@ -0,0 +1,143 @@
+//  mm_step.c
+//  === Resumable, time-sliced mmEncap / mmEnc / batch mmKGen.
+
+#include <string.h>
+
+#include "mm_step.h"
+
+//  common part of the job constructors
+
+static void step_start( mm_step_t *st, int op, const int32_t *a_mat,
+                        size_t n)
+{
+    memset(st, 0, sizeof(mm_step_t));
+    st->op = op;
+    st->a_mat = a_mat;
+    st->prog.total = n;
+}
+
+//  mmKEM: Start mm_encap(ct, kk, a_mat, pk, seed_e, n) as a job.
+
+void mm_step_encap( mm_step_t *st, uint8_t *ct, uint8_t *kk,
+                    const int32_t *a_mat, const uint8_t *pk[],
+                    const uint8_t seed_e[32], size_t n)
+{
+    step_start(st, 'E', a_mat, n);
+    st->ct = ct;
+    st->kk = kk;
+    st->pk = pk;
+    memcpy(st->seed_e, seed_e, 32);
+}
+
+//  mmPKE: Start mm_enc(ct, a_mat, pk, mm, seed_e, n) as a job.
+
+void mm_step_enc(   mm_step_t *st, uint8_t *ct, const int32_t *a_mat,
+                    const uint8_t *pk[], const uint8_t *mm,
+                    const uint8_t seed_e[32], size_t n)
+{
+    step_start(st, 'P', a_mat, n);
+    st->ct = ct;
+    st->pk = pk;
+    st->mm = mm;
+    memcpy(st->seed_e, seed_e, 32);
+}
+
+//  mmKEM & mmPKE: Start "n" mm_kgen(pk[i], sk[i], a_mat, seed_k[i]).
+
+void mm_step_kgen(  mm_step_t *st, uint8_t *pk[], uint8_t *sk[],
+                    const int32_t *a_mat, const uint8_t *seed_k[],
+                    size_t n)
+{
+    step_start(st, 'K', a_mat, n);
+    st->pko = pk;
+    st->sko = sk;
+    st->seed_k = seed_k;
+}
+
+//  one item: recipient or key number "i"
+
+static void step_item(mm_step_t *st, uint64_t i)
+{
+    switch (st->op) {
+
+        case 'E':
+            mm_ses_encap(&st->ses, st->ct + st->prog.out_sz,
+                            st->kk + i * MMKEM_K_SZ, st->pk[i]);
+            st->prog.out_sz += MMKEM_CTI_SZ;
+            break;
+
+        case 'P':
+            mm_ses_enc(&st->ses, st->ct + st->prog.out_sz, st->pk[i],
+                        st->mm + i * MMPKE_M_SZ);
+            st->prog.out_sz += MMPKE_CTI_SZ;
+            break;
+
+        default:
+            st->prog.out_sz += mm_kgen(st->pko[i], st->sko[i],
+                                        st->a_mat, st->seed_k[i]);
+            break;
+    }
+}
+
+//  Run the job within the budget. Returns MM_STEP_MORE or MM_STEP_DONE;
+//  progress is in st->prog.
+
+int mm_step_run(mm_step_t *st, uint64_t max_items, uint64_t max_ns)
+{
+    mm_prog_t *p = &st->prog;
+    uint64_t t0, t, k;
+    int fresh;
+
+    if (st->op == 0) {
+        return MM_STEP_DONE;
+    }
+    t0 = plat_get_ns();
+    t = t0;
+    fresh = 0;
+
+    //  ^ct <- mmEnc^i(pp; r) on the first call
+    if (st->op != 'K' && !st->init) {
+        p->out_sz = mm_ses_init(&st->ses, st->ct, st->a_mat, st->seed_e,
+                                p->total);
+        st->init = 1;
+    }
+
+    for (k = 0; p->done < p->total; ) {
+        step_item(st, p->done);
+        p->done++;
+        k++;
+        fresh = 0;
+        if (max_items != 0 && k >= max_items) {
+            break;
+        }
+        if (max_ns != 0) {
+            t = plat_get_ns();
+            fresh = 1;
+            if (t - t0 >= max_ns) {
+                break;
+            }
+        }
+    }
+    if (!fresh) {                       //  time of the last item too
+        t = plat_get_ns();
+    }
+
+    p->steps++;
+    p->ns += t - t0;
+    p->ns_max = t - t0 > p->ns_max ? t - t0 : p->ns_max;
+
+    if (p->done < p->total) {
+        return MM_STEP_MORE;
+    }
+    mm_step_clear(st);
+    return MM_STEP_DONE;
+}
+
+//  Abort (or finish) the job and clear its secrets.
+
+void mm_step_clear(mm_step_t *st)
+{
+    mm_ses_clear(&st->ses);
+    memset(st->seed_e, 0, 32);
+    st->op = 0;
+}
@@ -0,0 +1,79 @@
+//  mm_step.h
+//  === Header: Resumable, time-sliced mmEncap / mmEnc / batch mmKGen.
+
+#ifndef _MM_STEP_H_
+#define _MM_STEP_H_
+
+#include "plat_local.h"
+#include "mmkyber.h"
+
+/*
+    A job is started with one of mm_step_encap(), mm_step_enc() or
+    mm_step_kgen() (no work is done yet) and driven by mm_step_run() calls
+    from e.g. an event loop. Each call does at least one item (a recipient
+    or a key) and stops at the first budget reached:
+
+    max_items   items per call (0 = no limit)
+    max_ns      CLOCK_MONOTONIC time per call (0 = no limit); checked
+                after each item, so a call may overrun by one item
+
+    The first call of an encapsulation job also computes ^ct, which costs
+    about as much as M recipients. Output buffers are written in place and
+    are identical to those of a single mm_encap() / mm_enc() / mm_kgen()
+    loop. The buffers and arrays passed at the start must stay valid until
+    the job is done. A job holds r (secret) until then; mm_step_clear()
+    aborts it (it then reports MM_STEP_DONE with prog.done < prog.total).
+*/
+
+//  mm_step_run() return values
+#define MM_STEP_DONE    0
+#define MM_STEP_MORE    1
+
+//  progress, updated by mm_step_run()
+
+typedef struct {
+    uint64_t done, total;           //  items
+    uint64_t steps;                 //  mm_step_run() calls
+    uint64_t ns, ns_max;            //  time in them; longest call
+    size_t out_sz;                  //  bytes of ct (or pk) written so far
+} mm_prog_t;
+
+//  job state
+
+typedef struct {
+    int op;                         //  'E' encap, 'P' enc, 'K' kgen; 0 done
+    int init;                       //  ^ct computed
+    mm_ses_t ses;
+    const int32_t *a_mat;
+    const uint8_t **pk;             //  encap / enc: public keys
+    const uint8_t *mm;              //  enc: messages
+    const uint8_t **seed_k;         //  kgen: seeds
+    uint8_t *ct, *kk;               //  encap / enc output
+    uint8_t **pko, **sko;           //  kgen output
+    uint8_t seed_e[32];
+    mm_prog_t prog;
+} mm_step_t;
+
+//  mmKEM: Start mm_encap(ct, kk, a_mat, pk, seed_e, n) as a job.
+void mm_step_encap( mm_step_t *st, uint8_t *ct, uint8_t *kk,
+                    const int32_t *a_mat, const uint8_t *pk[],
+                    const uint8_t seed_e[32], size_t n);
+
+//  mmPKE: Start mm_enc(ct, a_mat, pk, mm, seed_e, n) as a job.
+void mm_step_enc(   mm_step_t *st, uint8_t *ct, const int32_t *a_mat,
+                    const uint8_t *pk[], const uint8_t *mm,
+                    const uint8_t seed_e[32], size_t n);
+
+//  mmKEM & mmPKE: Start "n" mm_kgen(pk[i], sk[i], a_mat, seed_k[i]).
+void mm_step_kgen(  mm_step_t *st, uint8_t *pk[], uint8_t *sk[],
+                    const int32_t *a_mat, const uint8_t *seed_k[],
+                    size_t n);
+
+//  Run the job within the budget. Returns MM_STEP_MORE or MM_STEP_DONE;
+//  progress is in st->prog.
+int mm_step_run(mm_step_t *st, uint64_t max_items, uint64_t max_ns);
+
+//  Abort (or finish) the job and clear its secrets.
+void mm_step_clear(mm_step_t *st);
+
+#endif
@@ -0,0 +1,331 @@
+//  mm_tune.c
+//  === Startup calibration of kernels, decap path and batching.
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mm_tune.h"
+#include "mm_kern.h"
+#include "mm_sched.h"
+
+//  synthetic workload
+#ifndef MM_TUNE_KEYS
+#define MM_TUNE_KEYS    8           //  distinct key pairs
+#endif
+
+#ifndef MM_TUNE_N
+#define MM_TUNE_N       16          //  recipients per mm_encap()
+#endif
+
+#ifndef MM_TUNE_SN
+#define MM_TUNE_SN      256         //  recipients per mm_sched_encap()
+#endif
+
+#ifdef MM_NO_NTT_DEC
+mm_tune_t mm_tune = { MM_PAR, "", MM_DEC_PATH_SB, 1, MM_SCHED_RBLK };
+#else
+mm_tune_t mm_tune = { MM_PAR, "", MM_DEC_PATH_NTT, 1, MM_SCHED_RBLK };
+#endif
+
+//  recipient task sizes tried
+static const size_t tune_rblk[] = { 8, 16, 32, 64, 128 };
+
+#define TUNE_RBLK_N (sizeof(tune_rblk) / sizeof(tune_rblk[0]))
+
+typedef struct {
+    int32_t *a_mat;
+    uint8_t *pk, *sk, *ct, *kk;
+    const uint8_t *pkp[MM_TUNE_SN];
+    uint8_t mm[MM_TUNE_SN * MMPKE_M_SZ];
+    uint8_t seed_e[32];
+    mm_sched_t *s;
+} tune_ctx_t;
+
+//  workloads
+
+static void tune_encap(tune_ctx_t *c)
+{
+#ifdef MM_KEM
+    mm_encap(c->ct, c->kk, c->a_mat, c->pkp, c->seed_e, MM_TUNE_N);
+#else
+    mm_enc(c->ct, c->a_mat, c->pkp, c->mm, c->seed_e, MM_TUNE_N);
+#endif
+}
+
+static void tune_decap(tune_ctx_t *c)
+{
+    int i;
+
+    for (i = 0; i < MM_TUNE_KEYS; i++) {
+#ifdef MM_KEM
+        mm_decap(c->kk, c->sk + i * MM_SK_SZ, c->ct,
+                    c->ct + MM_CTU_SZ + i * MMKEM_CTI_SZ);
+#else
+        mm_dec(c->kk, c->sk + i * MM_SK_SZ, c->ct,
+                    c->ct + MM_CTU_SZ + i * MMPKE_CTI_SZ);
+#endif
+    }
+}
+
+static void tune_sched(tune_ctx_t *c)
+{
+#ifdef MM_KEM
+    mm_sched_encap(c->s, c->ct, c->kk, c->a_mat, c->pkp, c->seed_e,
+                    MM_TUNE_SN);
+#else
+    mm_sched_enc(c->s, c->ct, c->a_mat, c->pkp, c->mm, c->seed_e,
+                    MM_TUNE_SN);
+#endif
+}
+
+//  fastest of (at least 3) calls in about "ms" milliseconds
+
+static uint64_t tune_time(void (*fn)(tune_ctx_t *), tune_ctx_t *c,
+                            unsigned ms)
+{
+    uint64_t t, t_end, best = UINT64_MAX;
+    int i = 0;
+
+    t_end = plat_get_ns() + ms * 1000000ull;
+    do {
+        t = plat_get_ns();
+        fn(c);
+        t = plat_get_ns() - t;
+        if (t < best) {
+            best = t;
+        }
+        i++;
+    } while (i < 3 || plat_get_ns() < t_end);
+
+    return best;
+}
+
+static void tune_free(tune_ctx_t *c)
+{
+    if (c->sk != NULL) {
+        memset(c->sk, 0, MM_TUNE_KEYS * MM_SK_SZ);
+    }
+    free(c->a_mat);
+    free(c->pk);
+    free(c->sk);
+    free(c->ct);
+    free(c->kk);
+    free(c);
+}
+
+int mm_tune_run(mm_tune_t *t, unsigned ms, FILE *log)
+{
+    const char *name[4] = { "generic", "avx2", "avx512", "fma" };
+    const mm_kern_t *kern0;
+    mm_tune_t sav;
+    tune_ctx_t *c;
+    uint8_t seed_a[16] = "mm_tune seed A..", seed_k[32] = { 0 };
+    uint64_t x, best;
+    long nc;
+    int i, dec0, th;
+    size_t j;
+
+    c = (tune_ctx_t *) calloc(1, sizeof(tune_ctx_t));
+    if (c == NULL) {
+        return -1;
+    }
+    c->a_mat = (int32_t *) malloc(MM_M * MM_N * MM_D * sizeof(int32_t));
+    c->pk = (uint8_t *) malloc(MM_TUNE_KEYS * MM_PK_SZ);
+    c->sk = (uint8_t *) malloc(MM_TUNE_KEYS * MM_SK_SZ);
+    c->ct = (uint8_t *) malloc(MM_CTU_SZ + MM_TUNE_SN * MMPKE_CTI_SZ);
+    c->kk = (uint8_t *) malloc(MM_TUNE_SN * MMKEM_K_SZ);
+    if (c->a_mat == NULL || c->pk == NULL || c->sk == NULL ||
+        c->ct == NULL || c->kk == NULL) {
+        tune_free(c);
+        return -1;
+    }
+    mm_setup(c->a_mat, seed_a);
+    for (i = 0; i < MM_TUNE_KEYS; i++) {
+        put64u_le(seed_k, i);
+        mm_kgen(c->pk + i * MM_PK_SZ, c->sk + i * MM_SK_SZ, c->a_mat, seed_k);
+    }
+    for (j = 0; j < MM_TUNE_SN; j++) {
+        c->pkp[j] = c->pk + (j % MM_TUNE_KEYS) * MM_PK_SZ;
+    }
+    memset(c->mm, 0x5A, sizeof(c->mm));
+
+    memset(t, 0, sizeof(mm_tune_t));
+    strncpy(t->par, MM_PAR, sizeof(t->par) - 1);
+    kern0 = mm_kern;
+    dec0 = mm_dec_path;
+    sav = mm_tune;
+
+    //  kernel backend
+    best = UINT64_MAX;
+    for (i = 0; i < 4; i++) {
+        if (mm_kern_set(name[i]) != 0) {
+            continue;
+        }
+        x = tune_time(tune_encap, c, ms);
+        if (log != NULL) {
+            fprintf(log, "%16s  kern %-8s  encap N=%d  %9.1f us\n",
+                    MM_PAR, name[i], MM_TUNE_N, 1E-3 * x);
+        }
+        if (x < best) {
+            best = x;
+            strncpy(t->kern, name[i], sizeof(t->kern) - 1);
+        }
+    }
+    mm_kern_set(t->kern);
+
+    //  decapsulation path (ct is that of the last encapsulation)
+    best = UINT64_MAX;
+    for (i = MM_DEC_PATH_NTT; i <= MM_DEC_PATH_SB; i++) {
+        mm_dec_path = i;
+        x = tune_time(tune_decap, c, ms) / MM_TUNE_KEYS;
+        if (log != NULL) {
+            fprintf(log, "%16s  dec  %-8s  decap      %9.1f us\n",
+                    MM_PAR, i == MM_DEC_PATH_SB ? "sb" : "ntt", 1E-3 * x);
+        }
+        if (x < best) {
+            best = x;
+            t->dec_path = i;
+        }
+    }
+    mm_dec_path = t->dec_path;
+
+    //  workers x task size: 1, 2, 4 .. online CPUs
+    nc = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nc < 1) {
+        nc = 1;
+    }
+    if (nc > MM_SCHED_THR_MAX) {
+        nc = MM_SCHED_THR_MAX;
+    }
+    best = UINT64_MAX;
+    for (th = 1; th <= nc; th = th < nc && 2 * th > nc ? nc : 2 * th) {
+        c->s = mm_sched_start(th);
+        if (c->s == NULL) {
+            break;
+        }
+        for (j = 0; j < TUNE_RBLK_N; j++) {
+            mm_tune.rblk = tune_rblk[j];
+            x = tune_time(tune_sched, c, ms);
+            if (log != NULL) {
+                fprintf(log, "%16s  threads= %2d  rblk= %3zu  encap N=%d  "
+                        "%9.1f us\n", MM_PAR, th, tune_rblk[j],
+                        MM_TUNE_SN, 1E-3 * x);
+            }
+            if (x < best) {
+                best = x;
+                t->threads = th;
+                t->rblk = tune_rblk[j];
+            }
+        }
+        mm_sched_stop(c->s);
+        c->s = NULL;
+    }
+
+    mm_tune = sav;
+    mm_kern_set(kern0->name);
+    mm_dec_path = dec0;
+    tune_free(c);
+
+    return t->threads > 0 ? 0 : -1;
+}
+
+int mm_tune_save(const mm_tune_t *t, const char *path)
+{
+    FILE *f;
+    int r;
+
+    f = fopen(path, "w");
+    if (f == NULL) {
+        return -1;
+    }
+    fprintf(f,  "#   mmKyber tuning profile (mm_tune.h)\n"
+                "par         %s\n"
+                "kern        %s\n"
+                "dec         %s\n"
+                "threads     %d\n"
+                "rblk        %zu\n",
+                t->par, t->kern[0] ? t->kern : "auto",
+                t->dec_path == MM_DEC_PATH_SB ? "sb" : "ntt",
+                t->threads, t->rblk);
+    r = ferror(f);
+    r |= fclose(f);
+
+    return r == 0 ? 0 : -1;
+}
+
+int mm_tune_load(mm_tune_t *t, const char *path)
+{
+    FILE *f;
+    char ln[128], k[32], v[32];
+    mm_tune_t p;
+    long x;
+
+    f = fopen(path, "r");
+    if (f == NULL) {
+        return -1;
+    }
+    p = mm_tune;
+    p.par[0] = 0;
+    while (fgets(ln, sizeof(ln), f) != NULL) {
+        if (ln[0] == '#' || sscanf(ln, "%31s %31s", k, v) != 2) {
+            continue;
+        }
+        x = atol(v);
+        if (strcmp(k, "par") == 0) {
+            snprintf(p.par, sizeof(p.par), "%s", v);
+        } else if (strcmp(k, "kern") == 0) {
+            snprintf(p.kern, sizeof(p.kern), "%.15s",
+                        strcmp(v, "auto") == 0 ? "" : v);
+        } else if (strcmp(k, "dec") == 0) {
+            p.dec_path = strcmp(v, "sb") == 0 ?
+                            MM_DEC_PATH_SB : MM_DEC_PATH_NTT;
+        } else if (strcmp(k, "threads") == 0 && x > 0) {
+            p.threads = (int) x;
+        } else if (strcmp(k, "rblk") == 0 && x > 0) {
+            p.rblk = (size_t) x;
+        }
+    }
+    fclose(f);
+    if (strcmp(p.par, MM_PAR) != 0) {
+        return -1;
+    }
+    *t = p;
+
+    return 0;
+}
+
+int mm_tune_apply(const mm_tune_t *t)
+{
+    int r = 0;
+
+    if (t->kern[0] && mm_kern_set(t->kern) != 0) {
+        r = -1;
+    }
+    mm_dec_path = t->dec_path;
+    mm_tune = *t;
+    if (r != 0) {
+        memset(mm_tune.kern, 0, sizeof(mm_tune.kern));
+    }
+
+    return r;
+}
+
+int mm_tune_init(const char *path, unsigned ms)
+{
+    mm_tune_t t;
+
+    if (path != NULL && mm_tune_load(&t, path) == 0) {
+        mm_tune_apply(&t);
+        return 0;
+    }
+    if (mm_tune_run(&t, ms, NULL) != 0) {
+        return -1;
+    }
+    if (path != NULL && mm_tune_save(&t, path) != 0) {
+        return -1;
+    }
+    mm_tune_apply(&t);
+
+    return 1;
+}
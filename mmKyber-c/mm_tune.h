@@ -0,0 +1,70 @@
+//  mm_tune.h
+//  === Header: Startup calibration of kernels, decap path and batching.
+
+#ifndef _MM_TUNE_H_
+#define _MM_TUNE_H_
+
+#include <stdio.h>
+
+#include "plat_local.h"
+#include "mmkyber.h"
+
+/*
+    mm_tune_run() times the candidates on synthetic keys for about "ms"
+    milliseconds each and returns the fastest choice of
+
+    kern        kernel backend (mm_kern.h), by mm_encap() / mm_enc()
+    dec         mm_decap() / mm_dec() path (mm_dec_path)
+    threads     mm_sched_start(0) workers, by mm_sched_encap() throughput
+    rblk        recipients per mm_sched_encap() / mm_sched_enc() task
+
+    A profile is a text file of "key value" lines ('#' comments), valid
+    for the parameter set (MM_PAR) it was measured with:
+
+    par         mmKyber-KEM-128
+    kern        avx2
+    dec         ntt             (or "sb", schoolbook)
+    threads     4
+    rblk        32
+
+    mm_tune_apply() makes a profile active; mm_encap(), mm_decap() and
+    the mm_sched.h batch calls then follow it. Calibrate and apply before
+    other threads use the library. `xtune` is the offline tool.
+*/
+
+typedef struct {
+    char par[32];                   //  parameter set (MM_PAR)
+    char kern[16];                  //  kernel backend name
+    int dec_path;                   //  MM_DEC_PATH_NTT or MM_DEC_PATH_SB
+    int threads;                    //  scheduler workers
+    size_t rblk;                    //  recipients per encap task
+} mm_tune_t;
+
+//  active profile (mm_sched.h reads threads and rblk); not exported by
+//  libmmkyber.so, set it with mm_tune_apply()
+extern mm_tune_t mm_tune;
+
+//  Calibrate for about "ms" milliseconds per candidate; timings are
+//  written to "log" unless it is NULL. The library state is unchanged.
+//  Returns 0 on success.
+int mm_tune_run(mm_tune_t *t, unsigned ms, FILE *log);
+
+//  Write profile "t" to "path". Returns 0 on success.
+int mm_tune_save(const mm_tune_t *t, const char *path);
+
+//  Read a profile from "path". Returns 0 on success, -1 if it cannot be
+//  read or is for another parameter set.
+int mm_tune_load(mm_tune_t *t, const char *path);
+
+//  Make "t" the active profile. Returns -1 if its kernel backend cannot
+//  run here (the rest is applied), else 0. The decryption path is set
+//  for the build's own level (MM_PAR) only; the mm_ops.h instances of
+//  the other levels keep theirs, as the profile was not measured there.
+int mm_tune_apply(const mm_tune_t *t);
+
+//  Load and apply the profile at "path" or, if there is none, calibrate
+//  for "ms" per candidate, save to "path" (unless NULL) and apply.
+//  Returns 0 if loaded, 1 if calibrated, -1 on failure.
+int mm_tune_init(const char *path, unsigned ms);
+
+#endif
@@ -9,62 +9,127 @@
 #include "mm_sample.h"
 
 #include "sha3_t.h"
+#include "sha3x4_t.h"
 
-//  use NTT-less decryption/decapsulation
-//#define MM_NO_NTT_DEC
+//  mm_decap() / mm_dec() path (mm_tune.h may change it)
+#ifdef MM_NO_NTT_DEC
+int mm_dec_path = MM_DEC_PATH_SB;
+#else
+int mm_dec_path = MM_DEC_PATH_NTT;
+#endif
 
 //  for indexing the A matrix
 #define MM_A_IDX(i,j) (((i) * MM_N + (j)) * MM_D)
 
-//  helper function for setting up SHAKE for output
-
-static void kec_setup(sha3_t *kec, const uint8_t *buf, size_t len)
-{
-    //  use SHAKE128 for security level 128 and below, otherwise SHAKE256
+//  use SHAKE128 for security level 128 and below, otherwise SHAKE256
 #ifdef MM_128
-    sha3_init(kec, SHAKE128_RATE);
+#define MM_KEC_RATE SHAKE128_RATE
 #else
-    sha3_init(kec, SHAKE256_RATE);
+#define MM_KEC_RATE SHAKE256_RATE
 #endif
 
+//  helper function for setting up SHAKE for output
+
+static void kec_setup(sha3_t *kec, const uint8_t *buf, size_t len)
+{
+    sha3_init(kec, MM_KEC_RATE);
     sha3_absorb(kec, buf, len);
     sha3_pad(kec, SHAKE_PAD);
 }
 
-//  mmKEM & mmPKE: mmSetup(1^lambda, N): Generate public parameter A from seed.
+//  set up four SHAKE128 lanes for A[i][j + l] (t = 0) or A[j + l][i] (t = 1)
 
-void mm_setup(int32_t *a, const uint8_t seed_a[16])
+static void mm_a_x4(sha3x4_t *kx, const uint8_t seed_a[16],
+                    int i, int j, int nl, int t)
 {
-    int i, j;
-    uint8_t seed[24];
-    sha3_t kec;
+    int l, jl;
+    uint8_t seed[4][24];
+    const uint8_t *m[4];
+
+    for (l = 0; l < 4; l++) {
+        jl = l < nl ? j + l : j;        //  unused lanes repeat lane 0
+        memcpy(seed[l], seed_a, 16);
+        seed[l][16] = t ? jl : i;
+        seed[l][17] = t ? i : jl;
+        seed[l][18] = 'A';
+        m[l] = seed[l];
+    }
 
-    memcpy(seed, seed_a, 16);
+    //  A matrix generation is always SHAKE128
+    sha3x4_absorb_pad(kx, SHAKE128_RATE, m, 19, SHAKE_PAD);
+}
 
-    for (i = 0; i < MM_M; i++) {
-        for (j = 0; j < MM_N; j++) {
+//  c := sum_j A[i][j] * r[j] (t = 0) or sum_j A[j][i] * r[j] (t = 1).
+//  A is read from "a_mat" or, if NULL, regenerated from "seed_a" on the fly.
+
+static void mm_a_dot(   int32_t c[MM_D], const int32_t *a_mat,
+                        const uint8_t *seed_a, int i, int t,
+                        const int32_t r[][MM_D])
+{
+    int j, l, nl, kn;
+    const int32_t *rl[4];
+    sha3x4_t kx;
+
+    kn = t ? MM_M : MM_N;
+    polyr_zero(c);
 
-            seed[16] = i;
-            seed[17] = j;
-            seed[18] = 'A';
+    if (a_mat != NULL) {
+        for (j = 0; j < kn; j++) {
+            polyr_ntt_mul_add(c,
+                &a_mat[t ? MM_A_IDX(j, i) : MM_A_IDX(i, j)], r[j]);
+        }
+        return;
+    }
 
-            //  A matrix generation is always SHAKE128
-            sha3_init(&kec, SHAKE128_RATE);
-            sha3_absorb(&kec, seed, 19);
-            sha3_pad(&kec, SHAKE_PAD);
-            poly_unif(&a[MM_A_IDX(i,j)], &kec);
+    for (j = 0; j < kn; j += 4) {
+        nl = kn - j < 4 ? kn - j : 4;
+        mm_a_x4(&kx, seed_a, i, j, nl, t);
+        for (l = 0; l < 4; l++) {
+            rl[l] = r[l < nl ? j + l : j];
         }
+        poly_unif_mul_add_x4(c, &kx, rl, nl);
     }
 }
 
-//  mmKEM & mmPKE: mmKGen(pp): Generate individual public key.
+//  mmKEM & mmPKE: mmSetup(1^lambda, N): Generate public parameter A from seed.
 
-size_t mm_kgen( uint8_t *pk, uint8_t *sk,
-                const int32_t *a_mat, const uint8_t seed_k[32])
+void mm_setup(int32_t *a, const uint8_t seed_a[16])
+{
+    int k, l, nl;
+    uint8_t seed[4][24];
+    const uint8_t *m[4];
+    int32_t *al[4];
+    sha3x4_t kx;
+
+    //  four A polynomials at a time, row-major order
+    for (k = 0; k < MM_M * MM_N; k += 4) {
+        nl = MM_M * MM_N - k < 4 ? MM_M * MM_N - k : 4;
+        for (l = 0; l < 4; l++) {
+            memcpy(seed[l], seed_a, 16);
+            seed[l][16] = (k + (l < nl ? l : 0)) / MM_N;
+            seed[l][17] = (k + (l < nl ? l : 0)) % MM_N;
+            seed[l][18] = 'A';
+            m[l] = seed[l];
+            al[l] = &a[(k + (l < nl ? l : 0)) * MM_D];
+        }
+
+        //  A matrix generation is always SHAKE128
+        sha3x4_absorb_pad(&kx, SHAKE128_RATE, m, 19, SHAKE_PAD);
+        poly_unif_x4(al, &kx, nl);
+    }
+}
+
+//  mmKEM & mmPKE private: mmKGen(pp) with A from "a_mat" or "seed_a";
+//  key block "l" > 0 of a multi-block key has seed_k || label || l.
+
+static size_t mm_kgen_a(uint8_t *pk, uint8_t *sk,
+                        const int32_t *a_mat, const uint8_t *seed_a,
+                        const uint8_t seed_k[32], size_t l)
 {
-    int i, j;
+    int i;
+    size_t seed_sz;
     int32_t s[MM_M][MM_D];
-    int32_t e[MM_N][MM_D];
+    int32_t e[MM_D];
     int32_t b[MM_D];
     size_t pk_sz;
     uint8_t seed[40];
@@ -73,8 +138,13 @@ size_t mm_kgen( uint8_t *pk, uint8_t *sk,
 
     //  (s, e) <- U(Snu^m) x U(Snu^n)
     memcpy(seed, seed_k, 32);
+    seed_sz = 33;
+    if (l > 0) {
+        put16u_le(seed + 33, l);
+        seed_sz = 35;
+    }
     seed[32] = 'S';
-    kec_setup(&kec, seed, 33);
+    kec_setup(&kec, seed, seed_sz);
     for (i = 0; i < MM_M; i++) {
         sample_nu(sk, &kec);
         poly_nu(s[i], sk);
@@ -84,23 +154,19 @@ size_t mm_kgen( uint8_t *pk, uint8_t *sk,
 
     //  b := A^T * s + e
     seed[32] = 'E';
-    kec_setup(&kec, seed, 33);
-    for (i = 0; i < MM_N; i++) {
-        sample_nu(buf, &kec);
-        poly_nu(e[i], buf);
-        polyr_fntt(e[i]);
-    }
+    kec_setup(&kec, seed, seed_sz);
 
     pk_sz = 0;
     for (i = 0; i < MM_N; i++) {
 
-        polyr_zero(b);
-        for (j = 0; j < MM_M; j++) {
-            polyr_ntt_mul_add(b, &a_mat[MM_A_IDX(j, i)], s[j]);
-        }
+        sample_nu(buf, &kec);
+        poly_nu(e, buf);
+        polyr_fntt(e);
+
+        mm_a_dot(b, a_mat, seed_a, i, 1, s);
 
         polyr_scale(b, MONT_RR, b);     //  remove the montgomery factor
-        polyr_add(b, b, e[i]);
+        polyr_add(b, b, e);
         polyr_norm(b);
 
         //  t := b
@@ -110,44 +176,149 @@ size_t mm_kgen( uint8_t *pk, uint8_t *sk,
     return pk_sz;
 }
 
+//  mmKEM & mmPKE: mmKGen(pp): Generate individual public key.
+
+size_t mm_kgen( uint8_t *pk, uint8_t *sk,
+                const int32_t *a_mat, const uint8_t seed_k[32])
+{
+    return mm_kgen_a(pk, sk, a_mat, NULL, seed_k, 0);
+}
+
+//  mmKEM & mmPKE: mmKGen() with A generated on the fly from "seed_a".
+
+size_t mm_kgen_s(   uint8_t *pk, uint8_t *sk,
+                    const uint8_t seed_a[16], const uint8_t seed_k[32])
+{
+    return mm_kgen_a(pk, sk, NULL, seed_a, seed_k, 0);
+}
+
+//  mmPKE: Multi-block key of "l" key blocks; block 0 is the mm_kgen() key.
+
+size_t mm_kgen_l(   uint8_t *pk, uint8_t *sk,
+                    const int32_t *a_mat, const uint8_t seed_k[32], size_t l)
+{
+    size_t b, pk_sz;
+
+    pk_sz = 0;
+    for (b = 0; b < l; b++) {
+        pk_sz += mm_kgen_a(pk + pk_sz, sk, a_mat, NULL, seed_k, b);
+        sk += MM_SK_SZ;
+    }
+
+    return pk_sz;
+}
+
+//  mmKEM & mmPKE: Re-derive private key "sk" from "seed_k" (as in mmKGen).
+
+void mm_sk_expand(uint8_t *sk, const uint8_t seed_k[32])
+{
+    int i;
+    uint8_t seed[40];
+    sha3_t kec;
+
+    //  s <- U(Snu^m), same stream as in mm_kgen()
+    memcpy(seed, seed_k, 32);
+    seed[32] = 'S';
+    kec_setup(&kec, seed, 33);
+    for (i = 0; i < MM_M; i++) {
+        sample_nu(sk, &kec);
+        sk += MM_NU_SZ;
+    }
+    sha3_clear(&kec);
+}
+
+//  mmKEM & mmPKE: Expand private key "sk" into NTT domain "s" (M*D words).
+
+void mm_sk_ntt(int32_t *s, const uint8_t *sk)
+{
+    int i;
+
+    for (i = 0; i < MM_M; i++) {
+        poly_nu(s, sk);
+        sk += MM_NU_SZ;
+        polyr_fntt(s);
+        s += MM_D;
+    }
+}
 
 //  mmKEM & mmPKE private: mmEnc^i(pp; r): Shared ciphertext.
 
 static size_t mm_enc_i( uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *seed_a,
                         const int32_t r[][MM_D],        //  ntt domain
                         const int32_t e[][MM_D])        //  normal domain
 {
-    int i, j;
+    int i;
     int32_t c[MM_D];                //  no need to store the whole vector
     size_t ct_sz;
 
     //  c := A * r + e_u
     ct_sz = 0;
     for (i = 0; i < MM_M; i++) {
-        polyr_zero(c);
-        for (j = 0; j < MM_N; j++) {
-            polyr_ntt_mul_add(c, &a_mat[MM_A_IDX(i, j)], r[j]);
-        }
-        polyr_intt(c);
-        polyr_add(c, c, e[i]);
+        mm_a_dot(c, a_mat, seed_a, i, 0, r);
 
-        //  u := [c mod q] (2^du)
-        ct_sz += poly_compress(ct + ct_sz, c, MM_DU);
+        //  u := [c mod q] (2^du), fused with the inverse NTT and + e_u
+        ct_sz += polyr_intt_ct(ct + ct_sz, NULL, c, e[i], NULL, MM_DU);
     }
 
     return ct_sz;
 }
 
-//  mmKEM private: mmEncap^d(pp, pk_i; r, r_i): Individual ciphertext.
+//  mmKEM & mmPKE private: Sample r (ntt domain), e_u and create ^ct.
 
-static size_t mm_encap_d(   uint8_t *ct, uint8_t *k,
-                            const uint8_t *pk,
-                            const int32_t r[][MM_D], // in ntt domain
-                            const int32_t y[MM_D ] )
+static size_t mm_enc_u( uint8_t *ct, int32_t r_u[][MM_D],
+                        const int32_t *a_mat, const uint8_t *seed_a,
+                        const uint8_t seed_e[32])
+{
+    int i;
+    sha3_t kec;
+    int32_t e_u[MM_M][MM_D];
+    uint8_t buf[40];
+
+    //  r := (r, e_u) <= D^n_sigma0 x D^M_sigma0
+    memcpy(buf, seed_e, 32);
+
+    buf[32] = 'R';
+    kec_setup(&kec, buf, 33);
+    for (i = 0; i < MM_N; i++) {
+        poly_gauss(r_u[i], &kec, MM_SIGMA0);
+        polyr_fntt(r_u[i]);
+    }
+
+    buf[32] = 'e';
+    kec_setup(&kec, buf, 33);
+    for (i = 0; i < MM_M; i++) {
+        poly_gauss(e_u[i], &kec, MM_SIGMA0);
+    }
+
+    //  ^ct <- mmEnc^i(pp; r)
+    return mm_enc_i(ct, a_mat, seed_a, r_u, e_u);
+}
+
+//  mmKEM & mmPKE private: r_i := y_i <- D_sigma1 for recipient "i";
+//  message block "l" > 0 of a multi-block message has seed_e || i || 'r' || l.
+
+static void mm_enc_y(   int32_t y[MM_D], const uint8_t seed_e[32],
+                        size_t i, size_t l)
+{
+    sha3_t kec;
+    uint8_t buf[48];
+
+    memcpy(buf, seed_e, 32);
+    put64u_le(buf + 32, i);
+    buf[40] = 'r';
+    put16u_le(buf + 41, l);
+    kec_setup(&kec, buf, l > 0 ? 43 : 41);
+    poly_gauss(y, &kec, MM_SIGMA1);
+}
+
+//  mmKEM & mmPKE private: c := < b', r > from a packed public key.
+
+static void mm_pk_dot(  int32_t c[MM_D], const uint8_t *pk,
+                        const int32_t r[][MM_D])
 {
     int i;
     int32_t b[MM_D];
-    int32_t c[MM_D];
 
     polyr_zero(c);
     for (i = 0; i < MM_N; i++) {
@@ -155,16 +326,219 @@ static size_t mm_encap_d(   uint8_t *ct, uint8_t *k,
         //  b'_i := t_i
         pk += poly_deserial(b, pk, MM_LOGQ);
 
-        //  c_i := < b'_i, r > + y_i
+        //  c_i := < b'_i, r >
         polyr_ntt_mul_add(c, b, r[i]);
     }
-    polyr_intt(c);
-    polyr_add(c, c, y);
+}
+
+//  mmKEM & mmPKE private: c := < b', r > from an expanded public key.
 
-    //  fast generation
-    poly_gen_ct_k(ct, k, c);
+static void mm_pkx_dot( int32_t c[MM_D], const int32_t *pkx,
+                        const int32_t r[][MM_D])
+{
+    int i;
 
-    return MMKEM_CTI_SZ;
+    polyr_zero(c);
+    for (i = 0; i < MM_N; i++) {
+        polyr_ntt_mul_add(c, pkx, r[i]);
+        pkx += MM_D;
+    }
+}
+
+//  mmKEM private: mmEncap^d(pp, pk_i; r, r_i): Individual ciphertext
+//  from c = < b'_i, r > in ntt domain.
+
+static size_t mm_encap_d(   uint8_t *ct, uint8_t *k,
+                            int32_t c[MM_D],
+                            const int32_t y[MM_D])
+{
+    //  c_i := < b'_i, r > + y_i; fast generation, one pass
+    return polyr_intt_ct(ct, k, c, y, NULL, MM_DU);
+}
+
+//  mmPKE private: mmEnc^d(pp, pk_i, m_i; r, r_i) from c = < b'_i, r >
+//  in ntt domain.
+
+static size_t mm_enc_d( uint8_t *ct,
+                        const uint8_t *m,
+                        int32_t c[MM_D],
+                        const int32_t y[MM_D])
+{
+    //  c_i := < b'_i, r > + y_i + [q/2]*m_i, compressed to dv bits in one
+    //  pass (compression is exact without normalization)
+    return polyr_intt_ct(ct, NULL, c, y, m, MMPKE_DV);
+}
+
+//  === Encapsulation sessions: r (ntt domain) and seed_e are kept so that
+//  recipients can be appended one at a time with the next index.
+
+//  mmKEM & mmPKE private: session with A from "a_mat" or "seed_a".
+
+static size_t mm_ses_init_a(mm_ses_t *ses, uint8_t *ctu,
+                            const int32_t *a_mat, const uint8_t *seed_a,
+                            const uint8_t seed_e[32], uint64_t lim)
+{
+    memcpy(ses->seed_e, seed_e, 32);
+    ses->idx = 0;
+    ses->lim = lim;
+
+    //  ^ct <- mmEnc^i(pp; r)
+    return mm_enc_u(ctu, ses->r_u, a_mat, seed_a, seed_e);
+}
+
+//  mmKEM & mmPKE private: ct_i (and K_i or m_i) for the next recipient,
+//  public key either packed "pk" or expanded "pkx". Returns its index.
+
+static int64_t mm_ses_add(  mm_ses_t *ses, uint8_t *cti, uint8_t *ki,
+                            const uint8_t *pk, const int32_t *pkx,
+                            const uint8_t *m)
+{
+    int32_t c[MM_D], y[MM_D];
+    uint64_t i;
+
+    if (ses->idx >= ses->lim) {
+        mm_ses_clear(ses);
+        return -1;
+    }
+    i = ses->idx++;
+
+    //  r_i := y_i <- D_sigma1
+    mm_enc_y(y, ses->seed_e, i, 0);
+
+    //  c := < b'_i, r >
+    if (pkx != NULL) {
+        mm_pkx_dot(c, pkx, ses->r_u);
+    } else {
+        mm_pk_dot(c, pk, ses->r_u);
+    }
+
+    if (m != NULL) {
+        //  ~ct_i <- mmEnc^d(pp. pk_i, m_i; r, r_i)
+        mm_enc_d(cti, m, c, y);
+    } else {
+        //  (~ct_i, K_i) <- mmEncap^d(pp. pk_i; r, r_i)
+        mm_encap_d(cti, ki, c, y);
+    }
+
+    return (int64_t) i;
+}
+
+//  mmKEM & mmPKE: Start a session for at most "lim" recipients; ^ct is
+//  written to "ctu". Returns the length of ^ct.
+
+size_t mm_ses_init( mm_ses_t *ses, uint8_t *ctu, const int32_t *a_mat,
+                    const uint8_t seed_e[32], uint64_t lim)
+{
+    return mm_ses_init_a(ses, ctu, a_mat, NULL, seed_e, lim);
+}
+
+//  mmKEM & mmPKE: mm_ses_init() with A generated on the fly from "seed_a".
+
+size_t mm_ses_init_s(   mm_ses_t *ses, uint8_t *ctu,
+                        const uint8_t seed_a[16],
+                        const uint8_t seed_e[32], uint64_t lim)
+{
+    return mm_ses_init_a(ses, ctu, NULL, seed_a, seed_e, lim);
+}
+
+//  mmKEM: Append recipient "pk"; write ct_i and K_i. Returns its index i,
+//  or -1 if the session has expired (it is then cleared).
+
+int64_t mm_ses_encap(mm_ses_t *ses, uint8_t *cti, uint8_t *ki,
+                        const uint8_t *pk)
+{
+    return mm_ses_add(ses, cti, ki, pk, NULL, NULL);
+}
+
+//  mmPKE: Append recipient "pk" with message "m"; write ct_i. Returns its
+//  index i, or -1 if the session has expired (it is then cleared).
+
+int64_t mm_ses_enc( mm_ses_t *ses, uint8_t *cti,
+                    const uint8_t *pk, const uint8_t *m)
+{
+    return mm_ses_add(ses, cti, NULL, pk, NULL, m);
+}
+
+//  mmPKE: Append recipient with multi-block key "pk" and "l" message
+//  blocks "m"; write l ct_i blocks. Returns its index i, or -1.
+
+int64_t mm_ses_enc_l(   mm_ses_t *ses, uint8_t *cti,
+                        const uint8_t *pk, const uint8_t *m, size_t l)
+{
+    int32_t c[MM_D], y[MM_D];
+    uint64_t i;
+    size_t b;
+
+    if (ses->idx >= ses->lim) {
+        mm_ses_clear(ses);
+        return -1;
+    }
+    i = ses->idx++;
+
+    //  all blocks share r; block b uses its own b'_ib and y_ib
+    for (b = 0; b < l; b++) {
+        mm_enc_y(y, ses->seed_e, i, b);
+        mm_pk_dot(c, pk, ses->r_u);
+        mm_enc_d(cti, m, c, y);
+        pk  += MM_PK_SZ;
+        m   += MMPKE_M_SZ;
+        cti += MMPKE_CTI_SZ;
+    }
+
+    return (int64_t) i;
+}
+
+//  mmKEM: mm_ses_encap() with a public key expanded by
+//  mm_pk_validate_batch().
+
+int64_t mm_ses_encap_x( mm_ses_t *ses, uint8_t *cti, uint8_t *ki,
+                        const int32_t *pkx)
+{
+    return mm_ses_add(ses, cti, ki, NULL, pkx, NULL);
+}
+
+//  mmPKE: mm_ses_enc() with a public key expanded by
+//  mm_pk_validate_batch().
+
+int64_t mm_ses_enc_x(   mm_ses_t *ses, uint8_t *cti,
+                        const int32_t *pkx, const uint8_t *m)
+{
+    return mm_ses_add(ses, cti, NULL, NULL, pkx, m);
+}
+
+//  mmKEM & mmPKE: Clear the session; no more recipients can be appended.
+
+void mm_ses_clear(mm_ses_t *ses)
+{
+    memset(ses, 0, sizeof(mm_ses_t));
+}
+
+//  mmKEM private: mmEncap() with A from "a_mat" or "seed_a", packed "pk"
+//  or expanded "pkx" public keys.
+
+static size_t mm_encap_a(   uint8_t *ct, uint8_t *kk,
+                            const int32_t *a_mat, const uint8_t *seed_a,
+                            const uint8_t *pk[], const int32_t *pkx[],
+                            const uint8_t seed_e[32], size_t n)
+{
+    size_t i;
+    mm_ses_t ses;
+    size_t ct_sz;
+
+    //  ^ct <- mmEnc^i(pp; r)
+    ct_sz = mm_ses_init_a(&ses, ct, a_mat, seed_a, seed_e, n);
+
+    for (i = 0; i < n; i++) {
+
+        //  (~ct_i, K_i) <- mmEncap^d(pp. pk_i; r, r_i)
+        mm_ses_add(&ses, ct + ct_sz, kk, pkx == NULL ? pk[i] : NULL,
+                    pkx == NULL ? NULL : pkx[i], NULL);
+        kk += MMKEM_K_SZ;
+        ct_sz += MMKEM_CTI_SZ;
+    }
+    mm_ses_clear(&ses);
+
+    return ct_sz;
 }
 
 //  mmKEM: mmEncap(pp, (pk_i) for i in [N]): Encapsulate to N recipients.
@@ -173,55 +547,104 @@ size_t mm_encap(uint8_t *ct, uint8_t *kk,
                 const int32_t *a_mat, const uint8_t *pk[],
                 const uint8_t seed_e[32], size_t n)
 {
-    size_t i;
-    sha3_t kec;
-    int32_t r_u[MM_N][MM_D];
-    int32_t e_u[MM_M][MM_D];
+    return mm_encap_a(ct, kk, a_mat, NULL, pk, NULL, seed_e, n);
+}
 
-    uint8_t buf[64];
-    size_t ct_sz;
+//  mmKEM: mmEncap() with A generated on the fly from "seed_a".
 
-    //  r := (r, e_u) <= D^n_sigma0 x D^M_sigma0
-    memcpy(buf, seed_e, 32);
+size_t mm_encap_s(  uint8_t *ct, uint8_t *kk,
+                    const uint8_t seed_a[16], const uint8_t *pk[],
+                    const uint8_t seed_e[32], size_t n)
+{
+    return mm_encap_a(ct, kk, NULL, seed_a, pk, NULL, seed_e, n);
+}
 
-    buf[32] = 'R';
-    kec_setup(&kec, buf, 33);
-    for (i = 0; i < MM_N; i++) {
-        poly_gauss(r_u[i], &kec, MM_SIGMA0);
-        polyr_fntt(r_u[i]);
+//  mmKEM: mmEncap() with public keys expanded by mm_pk_validate_batch().
+
+size_t mm_encap_x(  uint8_t *ct, uint8_t *kk,
+                    const int32_t *a_mat, const int32_t *pkx[],
+                    const uint8_t seed_e[32], size_t n)
+{
+    return mm_encap_a(ct, kk, a_mat, NULL, NULL, pkx, seed_e, n);
+}
+
+//  mmKEM & mmPKE: Validate and expand "n" public keys "pk" into "pkx"
+//  (N * D words per key); ok[i] := 1 iff coefficients of pk[i] are in
+//  [0, q-1]. Returns the number of valid keys.
+
+size_t mm_pk_validate_batch(int32_t *pkx, uint8_t *ok,
+                            const uint8_t *pk[], size_t n)
+{
+    size_t i, v;
+    int j;
+    int32_t f;
+    const uint8_t *p;
+
+    v = 0;
+    for (i = 0; i < n; i++) {
+        p = pk[i];
+        f = 0;
+        for (j = 0; j < MM_N; j++) {
+            f |= poly_deserial_q(pkx, p);
+            p += (MM_LOGQ * MM_D) / 8;
+            pkx += MM_D;
+        }
+        ok[i] = (uint8_t) (f + 1);
+        v += f + 1;
     }
 
-    buf[32] = 'e';
-    kec_setup(&kec, buf, 33);
-    for (i = 0; i < MM_M; i++) {
-        poly_gauss(e_u[i], &kec, MM_SIGMA0);
+    return v;
+}
+
+//  mmKEM private: reconcile K from w = <c',s> (normal domain) and ct_i.
+
+static void mm_decap_w(uint8_t *k, const int32_t *w, const uint8_t *cti)
+{
+    int i;
+    int32_t x;
+    uint16_t b;
+
+    memset(k, 0, MMKEM_K_SZ);
+    for (i = 0; i < MMKEM_K_SZ * 8; i++) {
+
+        //  make <c',s> signed and clip to 3-bit range
+        x   = w[i];
+        x   -=  ~((x - (MM_Q / 2)) >> 31) & MM_Q;
+        x   >>= MM_DU - 3;
+
+        //  rec
+        b = (cti[i >> 3] >> (i & 7)) & 1;
+        x = ((x + 2 * b + 1) >> 2) & 1;
+        k[i >> 3] |= x << (i & 7);
     }
+}
 
-    //  ^ct <- mmEnc^i(pp; r)
-    ct_sz = mm_enc_i(ct, a_mat, r_u, e_u);
+//  mmKEM: Decapsulate with a private key "s" expanded by mm_sk_ntt().
 
-    int32_t y[MM_D];
+void mm_decap_ntt(  uint8_t *k, const int32_t *s,
+                    const uint8_t *ctu, const uint8_t *cti)
+{
+    int i;
+    int32_t c[MM_D], w[MM_D];
 
-    for (i = 0; i < n; i++) {
+    polyr_zero(w);
+    for (i = 0; i < MM_M; i++) {
 
-        put64u_le(buf + 32, i);
-        buf[40] = 'r';
-        kec_setup(&kec, buf, 41);
-        poly_gauss(y, &kec, MM_SIGMA1);
+        //  c' := u mod 2^du
+        ctu += poly_deserial(c, ctu, MM_DU);
+        polyr_fntt(c);
 
-        //  (~ct_i, K_i) <- mmEncap^d(pp. pk_i; r, r_i)
-        mm_encap_d(ct + ct_sz, kk, /* a_mat, */ pk[i], r_u, y /*, &kec */);
-        kk += MMKEM_K_SZ;
-        ct_sz += MMKEM_CTI_SZ;
+        //  w := <c',s> mod 2^u_i
+        polyr_ntt_mul_add(w, c, s);
+        s += MM_D;
     }
+    polyr_intt(w);
 
-    return ct_sz;
+    mm_decap_w(k, w, cti);
 }
 
 //  mmKEM: mmDecap(pp, sk, ct): Decapsulate individual ciphertext (ctu,cti).
 
-#ifdef MM_NO_NTT_DEC
-
 //  No-NTT multiply with a ternary secret.
 
 static void poly_mul1_add16(uint16_t *r, uint16_t *f, int32_t *g)
@@ -237,8 +660,10 @@ static void poly_mul1_add16(uint16_t *r, uint16_t *f, int32_t *g)
     }
 }
 
-void mm_decap(  uint8_t *k, const uint8_t *sk,
-                const uint8_t *ctu, const uint8_t *cti)
+//  NTT-free version
+
+static void mm_decap_sb(uint8_t *k, const uint8_t *sk,
+                        const uint8_t *ctu, const uint8_t *cti)
 {
     int i;
     int32_t s[MM_D];
@@ -268,16 +693,13 @@ void mm_decap(  uint8_t *k, const uint8_t *sk,
     }
 }
 
-#else
-
 //  Uses NTT (the partial sums fit into q)
 
-void mm_decap(  uint8_t *k, const uint8_t *sk,
-                const uint8_t *ctu, const uint8_t *cti)
+static void mm_decap_nt(uint8_t *k, const uint8_t *sk,
+                        const uint8_t *ctu, const uint8_t *cti)
 {
     int i;
-    int32_t x, s[MM_D], c[MM_D], w[MM_D];
-    uint16_t b;
+    int32_t s[MM_D], c[MM_D], w[MM_D];
 
     polyr_zero(w);
     for (i = 0; i < MM_M; i++) {
@@ -296,124 +718,189 @@ void mm_decap(  uint8_t *k, const uint8_t *sk,
     }
     polyr_intt(w);
 
-    memset(k, 0, MMKEM_K_SZ);
-    for (i = 0; i < MMKEM_K_SZ * 8; i++) {
-
-        //  make <c',s> signed and clip to 3-bit range
-        x   = w[i];
-        x   -=  ~((x - (MM_Q / 2)) >> 31) & MM_Q;
-        x   >>= MM_DU - 3;
+    mm_decap_w(k, w, cti);
+}
 
-        //  rec
-        b = (cti[i >> 3] >> (i & 7)) & 1;
-        x = ((x + 2 * b + 1) >> 2) & 1;
-        k[i >> 3] |= x << (i & 7);
+void mm_decap(  uint8_t *k, const uint8_t *sk,
+                const uint8_t *ctu, const uint8_t *cti)
+{
+    if (mm_dec_path == MM_DEC_PATH_SB) {
+        mm_decap_sb(k, sk, ctu, cti);
+    } else {
+        mm_decap_nt(k, sk, ctu, cti);
     }
 }
 
-#endif
-
 
-//  mmPKE private: mmEnc^d(pp, pk_i, m_i; r, r_i)
+//  mmPKE private: mmEnc() with A from "a_mat" or "seed_a", packed "pk"
+//  or expanded "pkx" public keys.
 
-static size_t mm_enc_d( uint8_t *ct,
-                        const uint8_t *pk,
-                        const uint8_t *m,
-                        const int32_t r[][MM_D], // in ntt domain
-                        const int32_t y[MM_D])
+static size_t mm_enc_a( uint8_t *ct,
+                        const int32_t *a_mat, const uint8_t *seed_a,
+                        const uint8_t *pk[], const int32_t *pkx[],
+                        const uint8_t *mm,
+                        const uint8_t seed_e[32], size_t n)
 {
-    int i, j, x;
-    int32_t b[MM_D];
-    int32_t c[MM_D];
-
-    polyr_zero(c);
-    for (i = 0; i < MM_N; i++) {
+    size_t i;
+    mm_ses_t ses;
+    size_t ct_sz;
 
-        //  b'_i := t_i
-        pk += poly_deserial(b, pk, MM_LOGQ);
+    //  ^ct <- mmEnc^i(pp; r)
+    ct_sz = mm_ses_init_a(&ses, ct, a_mat, seed_a, seed_e, n);
 
-        //  c_i := < b'_i, r > + y_i
-        polyr_ntt_mul_add(c, b, r[i]);
-    }
-    polyr_intt(c);
-    polyr_add(c, c, y);
+    for (i = 0; i < n; i++) {
 
-    //  encode message
-    for (i = 0; i < MMPKE_M_SZ; i++) {
-        x = m[i];
-        for (j = 0; j < 8; j++) {
-            //  [q/2]*m_i
-            c[8 * i + j] += (-((x >> j) & 1)) & ((MM_Q + 1) / 2);
-        }
+        //  ~ct_i <- mmEnc^d(pp. pk_i, m_i; r, r_i)
+        mm_ses_add(&ses, ct + ct_sz, NULL, pkx == NULL ? pk[i] : NULL,
+                    pkx == NULL ? NULL : pkx[i], mm);
+        ct_sz += MMPKE_CTI_SZ;
+        mm  += MMPKE_M_SZ;
     }
-    //  normalize
-    polyr_norm(c);
+    mm_ses_clear(&ses);
 
-    //  compress to dv bits, return length
-    return poly_compress(ct, c, MMPKE_DV);
+    return ct_sz;
 }
 
-
 //  mmPKE: mmEnc(pp, (pk_i), (m_i) for i in [N]): Encrypt to N recipients.
 
 size_t mm_enc(  uint8_t *ct, const int32_t *a_mat,
                 const uint8_t *pk[], const uint8_t *mm,
                 const uint8_t seed_e[32], size_t n)
 {
-    size_t i;
-    sha3_t kec;
-    int32_t r_u[MM_N][MM_D];
-    int32_t e_u[MM_M][MM_D];
+    return mm_enc_a(ct, a_mat, NULL, pk, NULL, mm, seed_e, n);
+}
+
+//  mmPKE: mmEnc() with A generated on the fly from "seed_a".
+
+size_t mm_enc_s(uint8_t *ct, const uint8_t seed_a[16],
+                const uint8_t *pk[], const uint8_t *mm,
+                const uint8_t seed_e[32], size_t n)
+{
+    return mm_enc_a(ct, NULL, seed_a, pk, NULL, mm, seed_e, n);
+}
+
+//  mmPKE: mmEnc() with public keys expanded by mm_pk_validate_batch().
+
+size_t mm_enc_x(uint8_t *ct, const int32_t *a_mat,
+                const int32_t *pkx[], const uint8_t *mm,
+                const uint8_t seed_e[32], size_t n)
+{
+    return mm_enc_a(ct, a_mat, NULL, NULL, pkx, mm, seed_e, n);
+}
 
-    uint8_t buf[64];
+//  mmPKE: Encrypt "l" message blocks to each of "n" recipients with
+//  multi-block keys from mm_kgen_l(). "l" = 1 is mm_enc().
+
+size_t mm_enc_l(uint8_t *ct, const int32_t *a_mat,
+                const uint8_t *pk[], const uint8_t *mm,
+                const uint8_t seed_e[32], size_t n, size_t l)
+{
+    size_t i;
+    mm_ses_t ses;
     size_t ct_sz;
 
-    //  r := (r, e_u) <= D^n_sigma0 x D^M_sigma0
-    memcpy(buf, seed_e, 32);
+    //  ^ct <- mmEnc^i(pp; r), once for all blocks
+    ct_sz = mm_ses_init_a(&ses, ct, a_mat, NULL, seed_e, n);
 
-    buf[32] = 'R';
-    kec_setup(&kec, buf, 33);
-    for (i = 0; i < MM_N; i++) {
-        poly_gauss(r_u[i], &kec, MM_SIGMA0);
-        polyr_fntt(r_u[i]);
+    for (i = 0; i < n; i++) {
+        mm_ses_enc_l(&ses, ct + ct_sz, pk[i], mm, l);
+        ct_sz += l * MMPKE_CTI_SZ;
+        mm  += l * MMPKE_M_SZ;
     }
+    mm_ses_clear(&ses);
 
-    buf[32] = 'e';
-    kec_setup(&kec, buf, 33);
-    for (i = 0; i < MM_M; i++) {
-        poly_gauss(e_u[i], &kec, MM_SIGMA0);
+    return ct_sz;
+}
+
+//  mmPKE private: decode m from w = <u,s> (normal domain) and ct_i.
+
+static void mm_dec_w(uint8_t *m, const int32_t *w, const uint8_t *cti)
+{
+    int i, x;
+    uint16_t v[MM_D];
+
+    //  u' := [u mod 2^dv](2^du)
+    poly_deserial16(v, cti, MMPKE_DV, MMPKE_M_SZ * 8);
+
+    memset(m, 0, MMPKE_M_SZ);
+    for (i = 0; i < MMPKE_M_SZ * 8; i++) {
+
+        x   = w[i];
+        //  make <u,s> signed and clip to 2**du range
+        x   -=  ~((x - (MM_Q / 2)) >> 31) & MM_Q;
+        x   &= (1 << MM_DU) - 1;
+
+        //  m := [ u' - <u,s> mod 2^d_u ]_2
+        x = (v[i] << (MM_DU - MMPKE_DV)) - x;
+        x = ((x + (1 << (MM_DU - 2))) >> (MM_DU - 1)) & 1;
+        m[i >> 3] |= (x & 1) << (i & 7);
     }
+}
 
-    //  ^ct <- mmEnc^i(pp; r)
-    ct_sz = mm_enc_i(ct, a_mat, r_u, e_u);
+//  mmPKE: Decrypt with a private key "s" expanded by mm_sk_ntt().
+
+void mm_dec_ntt(uint8_t *m, const int32_t *s,
+                const uint8_t *ctu, const uint8_t *cti)
+{
+    int i;
+    int32_t u[MM_D], w[MM_D];
 
-    int32_t y[MM_D];
+    polyr_zero(w);
+    for (i = 0; i < MM_M; i++) {
 
-    for (i = 0; i < n; i++) {
+        //  u' := [u mod 2^du](q)
+        ctu += poly_deserial(u, ctu, MM_DU);
+        polyr_fntt(u);
 
-        //  r_i := y_i <- D_sigma1
-        put64u_le(buf + 32, i);
-        buf[40] = 'r';
-        kec_setup(&kec, buf, 41);
-        poly_gauss(y, &kec, MM_SIGMA1);
+        //  w := <u,s> mod 2^u_i
+        polyr_ntt_mul_add(w, u, s);
+        s += MM_D;
+    }
+    polyr_intt(w);
 
-        //  (~ct_i, K_i) <- mmEncap^d(pp. pk_i; r, r_i)
-        mm_enc_d(ct + ct_sz, pk[i], mm, r_u, y);
-        ct_sz += MMPKE_CTI_SZ;
-        mm  += MMPKE_M_SZ;
+    mm_dec_w(m, w, cti);
+}
+
+//  mmPKE: Decrypt "l" message blocks with a multi-block private key;
+//  u is transformed once and shared by all blocks.
+
+void mm_dec_l(  uint8_t *m, const uint8_t *sk,
+                const uint8_t *ctu, const uint8_t *cti, size_t l)
+{
+    int i;
+    size_t b;
+    int32_t u[MM_M][MM_D], s[MM_D], w[MM_D];
+
+    //  u' := [u mod 2^du](q)
+    for (i = 0; i < MM_M; i++) {
+        ctu += poly_deserial(u[i], ctu, MM_DU);
+        polyr_fntt(u[i]);
     }
 
-    return ct_sz;
+    for (b = 0; b < l; b++) {
+
+        //  w := <u,s_b>
+        polyr_zero(w);
+        for (i = 0; i < MM_M; i++) {
+            poly_nu(s, sk);
+            sk += MM_NU_SZ;
+            polyr_fntt(s);
+            polyr_ntt_mul_add(w, u[i], s);
+        }
+        polyr_intt(w);
+
+        mm_dec_w(m, w, cti);
+        m   += MMPKE_M_SZ;
+        cti += MMPKE_CTI_SZ;
+    }
 }
 
 //  mmPKE: mmDec(pp, sk, ct): Decrypt a message
 
-#ifdef MM_NO_NTT_DEC
-
 //  NTT-free version
 
-void mm_dec(uint8_t *m, const uint8_t *sk,
-            const uint8_t *ctu, const uint8_t *cti)
+static void mm_dec_sb(  uint8_t *m, const uint8_t *sk,
+                        const uint8_t *ctu, const uint8_t *cti)
 {
     int i, x;
     int32_t s[MM_D];
@@ -445,19 +932,13 @@ void mm_dec(uint8_t *m, const uint8_t *sk,
     }
 }
 
-#else
-
 //  This version uses NTT
 
-void mm_dec(uint8_t *m, const uint8_t *sk,
-            const uint8_t *ctu, const uint8_t *cti)
+static void mm_dec_nt(  uint8_t *m, const uint8_t *sk,
+                        const uint8_t *ctu, const uint8_t *cti)
 {
-    int i, x;
+    int i;
     int32_t s[MM_D], u[MM_D], w[MM_D];
-    uint16_t v[MM_D];
-
-    //  u' := [u mod 2^dv](2^du)
-    poly_deserial16(v, cti, MMPKE_DV, MMPKE_M_SZ * 8);
 
     polyr_zero(w);
     for (i = 0; i < MM_M; i++) {
@@ -476,19 +957,270 @@ void mm_dec(uint8_t *m, const uint8_t *sk,
     }
     polyr_intt(w);
 
-    memset(m, 0, MMPKE_M_SZ);
-    for (i = 0; i < MMPKE_M_SZ * 8; i++) {
+    mm_dec_w(m, w, cti);
+}
 
-        x   = w[i];
-        //  make <u,s> signed and clip to 2**du range
-        x   -=  ~((x - (MM_Q / 2)) >> 31) & MM_Q;
-        x   &= (1 << MM_DU) - 1;
+void mm_dec(uint8_t *m, const uint8_t *sk,
+            const uint8_t *ctu, const uint8_t *cti)
+{
+    if (mm_dec_path == MM_DEC_PATH_SB) {
+        mm_dec_sb(m, sk, ctu, cti);
+    } else {
+        mm_dec_nt(m, sk, ctu, cti);
+    }
+}
 
-        //  m := [ u' - <u,s> mod 2^d_u ]_2
-        x = (v[i] << (MM_DU - MMPKE_DV)) - x;
-        x = ((x + (1 << (MM_DU - 2))) >> (MM_DU - 1)) & 1;
-        m[i >> 3] |= (x & 1) << (i & 7);
+//  === Batches of independent encapsulations sharing A: jobs are taken
+//  MM_MANY_BLK at a time; their Gaussian streams are squeezed in four-lane
+//  SHAKE and each polynomial of A is loaded once per block.
+
+#ifndef MM_MANY_BLK
+#define MM_MANY_BLK 4
+#endif
+
+//  set up four lanes of kec_setup(seed_e[l] || "t") (nl used lanes)
+
+static void mm_many_x4( sha3x4_t *kx, const uint8_t *seed_e[4], int nl,
+                        uint8_t t)
+{
+    uint8_t buf[4][40];
+    const uint8_t *m[4];
+    int l;
+
+    for (l = 0; l < 4; l++) {
+        memcpy(buf[l], seed_e[l < nl ? l : 0], 32);
+        buf[l][32] = t;
+        m[l] = buf[l];
+    }
+    sha3x4_absorb_pad(kx, MM_KEC_RATE, m, 33, SHAKE_PAD);
+}
+
+//  mmKEM & mmPKE private: r_u (ntt domain), e_u and ^ct of "nb" jobs
+
+static void mm_many_u(  const mm_job_t *job, int nb, const int32_t *a_mat,
+                        int32_t r_u[][MM_N][MM_D], int32_t e_u[][MM_M][MM_D])
+{
+    int32_t c[MM_MANY_BLK][MM_D], *rl[4];
+    const uint8_t *sl[4];
+    sha3x4_t kx;
+    int b, i, j, l, nl;
+
+    //  r := (r, e_u) <= D^n_sigma0 x D^M_sigma0, four jobs per call
+    for (b = 0; b < nb; b += 4) {
+        nl = nb - b < 4 ? nb - b : 4;
+        for (l = 0; l < nl; l++) {
+            sl[l] = job[b + l].seed_e;
+        }
+        mm_many_x4(&kx, sl, nl, 'R');
+        for (l = 0; l < nl; l++) {
+            rl[l] = r_u[b + l][0];
+        }
+        poly_gauss_x4(rl, &kx, nl, MM_N, MM_SIGMA0);
+
+        mm_many_x4(&kx, sl, nl, 'e');
+        for (l = 0; l < nl; l++) {
+            rl[l] = e_u[b + l][0];
+        }
+        poly_gauss_x4(rl, &kx, nl, MM_M, MM_SIGMA0);
+    }
+    sha3x4_clear(&kx);
+
+    for (b = 0; b < nb; b++) {
+        for (j = 0; j < MM_N; j++) {
+            polyr_fntt(r_u[b][j]);
+        }
+    }
+
+    //  c := A * r + e_u for all jobs, row by row
+    for (i = 0; i < MM_M; i++) {
+        for (b = 0; b < nb; b++) {
+            polyr_zero(c[b]);
+        }
+        for (j = 0; j < MM_N; j++) {
+            for (b = 0; b < nb; b++) {
+                polyr_ntt_mul_add(c[b], &a_mat[MM_A_IDX(i, j)], r_u[b][j]);
+            }
+        }
+        for (b = 0; b < nb; b++) {
+            polyr_intt_ct(job[b].ct + i * (MM_CTU_SZ / MM_M), NULL,
+                            c[b], e_u[b][i], NULL, MM_DU);
+        }
+    }
+    memset(c, 0, sizeof(c));
+}
+
+//  mmKEM & mmPKE private: mm_encap() / mm_enc() ("pke") of each job
+
+static size_t mm_many(  const int32_t *a_mat, const mm_job_t *job,
+                        size_t count, int pke)
+{
+    static const size_t cti_sz[2] = { MMKEM_CTI_SZ, MMPKE_CTI_SZ };
+    int32_t r_u[MM_MANY_BLK][MM_N][MM_D], e_u[MM_MANY_BLK][MM_M][MM_D];
+    int32_t y[4][MM_D], c[MM_D], *yl[4];
+    uint8_t buf[4][48], *cti;
+    const uint8_t *m[4];
+    const mm_job_t *jl;
+    size_t jb[4], il[4], ct_sz, i, k;
+    sha3x4_t kx;
+    int b, l, nb, nl;
+
+    ct_sz = 0;
+    for (k = 0; k < count; k += nb) {
+        nb = count - k < MM_MANY_BLK ? count - k : MM_MANY_BLK;
+
+        //  ^ct <- mmEnc^i(pp; r) of each job
+        mm_many_u(job + k, nb, a_mat, r_u, e_u);
+
+        //  recipients of all jobs of the block, four y_i at a time
+        b = 0;
+        i = 0;
+        while (b < nb) {
+            for (nl = 0; nl < 4 && b < nb; ) {
+                if (i < job[k + b].n) {
+                    jb[nl] = b;
+                    il[nl] = i++;
+                    nl++;
+                } else {
+                    ct_sz += MM_CTU_SZ + job[k + b].n * cti_sz[pke];
+                    b++;
+                    i = 0;
+                }
+            }
+            if (nl == 0) {
+                break;
+            }
+
+            //  r_i := y_i <- D_sigma1, as mm_enc_y()
+            for (l = 0; l < 4; l++) {
+                memcpy(buf[l], job[k + jb[l < nl ? l : 0]].seed_e, 32);
+                put64u_le(buf[l] + 32, il[l < nl ? l : 0]);
+                buf[l][40] = 'r';
+                m[l] = buf[l];
+                yl[l] = y[l];
+            }
+            sha3x4_absorb_pad(&kx, MM_KEC_RATE, m, 41, SHAKE_PAD);
+            poly_gauss_x4(yl, &kx, nl, 1, MM_SIGMA1);
+
+            for (l = 0; l < nl; l++) {
+                jl = &job[k + jb[l]];
+                cti = jl->ct + MM_CTU_SZ + il[l] * cti_sz[pke];
+
+                //  c := < b'_i, r >
+                mm_pk_dot(c, jl->pk[il[l]], r_u[jb[l]]);
+                if (pke) {
+                    mm_enc_d(cti, jl->mm + il[l] * MMPKE_M_SZ, c, y[l]);
+                } else {
+                    mm_encap_d(cti, jl->kk + il[l] * MMKEM_K_SZ, c, y[l]);
+                }
+            }
+        }
     }
+    sha3x4_clear(&kx);
+    memset(r_u, 0, sizeof(r_u));
+    memset(e_u, 0, sizeof(e_u));
+    memset(y, 0, sizeof(y));
+
+    return ct_sz;
+}
+
+//  mmKEM: mm_encap() of each of "count" jobs; returns the total length of
+//  the ciphertexts.
+
+size_t mm_encap_many(   const int32_t *a_mat, const mm_job_t jobs[],
+                        size_t count)
+{
+    return mm_many(a_mat, jobs, count, 0);
+}
+
+//  mmPKE: mm_enc() of each of "count" jobs; returns the total length of
+//  the ciphertexts.
+
+size_t mm_enc_many( const int32_t *a_mat, const mm_job_t jobs[],
+                    size_t count)
+{
+    return mm_many(a_mat, jobs, count, 1);
 }
 
+//  === Streaming interface: recipients are pulled from a source in chunks
+//  and each (ct_i, K_i) is pushed to a sink; memory use is independent of n.
+
+#ifndef MM_STREAM_CHUNK
+#define MM_STREAM_CHUNK 16
+#endif
+
+//  prefetch a public key (overlaps with work on the current recipient)
+
+static inline void mm_prefetch_pk(const uint8_t *pk)
+{
+#ifdef __GNUC__
+    size_t i;
+
+    for (i = 0; i < MM_PK_SZ; i += 64) {
+        __builtin_prefetch(pk + i, 0, 0);
+    }
+#else
+    (void) pk;
 #endif
+}
+
+//  mmKEM & mmPKE private: common streaming loop; "pke" selects mmPKE.
+//  A chunk is finished before the next one is pulled, so the source may
+//  reuse its buffers from call to call.
+
+static size_t mm_stream(uint8_t *ctu, const int32_t *a_mat,
+                        const uint8_t seed_e[32],
+                        mm_src_t src, mm_sink_t sink, void *arg, int pke)
+{
+    size_t i, j, n;
+    mm_ses_t ses;
+    const uint8_t *pk[MM_STREAM_CHUNK], *m[MM_STREAM_CHUNK];
+    uint8_t cti[MMPKE_CTI_SZ > MMKEM_CTI_SZ ? MMPKE_CTI_SZ : MMKEM_CTI_SZ];
+    uint8_t ki[MMKEM_K_SZ];
+    int stop;
+
+    //  ^ct <- mmEnc^i(pp; r)
+    mm_ses_init(&ses, ctu, a_mat, seed_e, UINT64_MAX);
+
+    i = 0;
+    stop = 0;
+    while (!stop && (n = src(arg, pk, m, i, MM_STREAM_CHUNK)) > 0) {
+        for (j = 0; j < n && !stop; j++) {
+            if (j + 1 < n) {
+                mm_prefetch_pk(pk[j + 1]);
+            }
+            if (pke) {
+                mm_ses_enc(&ses, cti, pk[j], m[j]);
+                stop = sink(arg, i, cti, NULL);
+            } else {
+                mm_ses_encap(&ses, cti, ki, pk[j]);
+                stop = sink(arg, i, cti, ki);
+            }
+            i++;
+        }
+    }
+    mm_ses_clear(&ses);
+    memset(ki, 0, sizeof(ki));
+
+    return i;
+}
+
+//  mmKEM: mmEncap() with recipients pulled from "src" and (ct_i, K_i)
+//  pushed to "sink". Writes ^ct to "ctu" and returns the number of
+//  recipients processed.
+
+size_t mm_encap_stream( uint8_t *ctu, const int32_t *a_mat,
+                        const uint8_t seed_e[32],
+                        mm_src_t src, mm_sink_t sink, void *arg)
+{
+    return mm_stream(ctu, a_mat, seed_e, src, sink, arg, 0);
+}
+
+//  mmPKE: mmEnc() with recipients and messages pulled from "src" and ct_i
+//  pushed to "sink" (with a NULL key).
+
+size_t mm_enc_stream(   uint8_t *ctu, const int32_t *a_mat,
+                        const uint8_t seed_e[32],
+                        mm_src_t src, mm_sink_t sink, void *arg)
+{
+    return mm_stream(ctu, a_mat, seed_e, src, sink, arg, 1);
+}
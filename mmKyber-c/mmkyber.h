@@ -7,6 +7,8 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "mm_param.h"
+
 //  mmKEM & mmPKE: mmSetup(1^lambda, N): Generate public parameter A from seed.
 void mm_setup(  int32_t *a, const uint8_t seed_a[16]);
 
@@ -23,6 +25,18 @@ size_t mm_encap(uint8_t *ct, uint8_t *kk,
 void mm_decap(  uint8_t *k, const uint8_t *sk,
                 const uint8_t *ctu, const uint8_t *cti);
 
+//  use NTT-less decryption/decapsulation by default (here, so that mm_tune.c
+//  sees it too)
+//#define MM_NO_NTT_DEC
+
+//  mmKEM & mmPKE: mm_decap() / mm_dec() arithmetic, MM_DEC_PATH_NTT or
+//  MM_DEC_PATH_SB (schoolbook, 16-bit words); same output. Set once before
+//  use (mm_tune.h); the default follows MM_NO_NTT_DEC. Not exported by
+//  libmmkyber.so; set it there with mm_tune_apply().
+#define MM_DEC_PATH_NTT 0
+#define MM_DEC_PATH_SB  1
+extern int mm_dec_path;
+
 //  mmPKE: mmEnc(pp, (pk_i), (m_i) for i in [N]): Encrypt to N recipients.
 size_t mm_enc(  uint8_t *ct, const int32_t *a_mat,
                 const uint8_t *pk[], const uint8_t *mm,
@@ -32,4 +46,174 @@ size_t mm_enc(  uint8_t *ct, const int32_t *a_mat,
 void mm_dec(uint8_t *m, const uint8_t *sk,
             const uint8_t *ctu, const uint8_t *cti);
 
+//  === A generated on the fly from seed_a (no a_mat storage)
+
+//  mmKEM & mmPKE: mmKGen() with A generated on the fly from "seed_a".
+size_t mm_kgen_s(   uint8_t *pk, uint8_t *sk,
+                    const uint8_t seed_a[16], const uint8_t seed_k[32]);
+
+//  mmKEM: mmEncap() with A generated on the fly from "seed_a".
+size_t mm_encap_s(  uint8_t *ct, uint8_t *kk,
+                    const uint8_t seed_a[16], const uint8_t *pk[],
+                    const uint8_t seed_e[32], size_t n);
+
+//  mmPKE: mmEnc() with A generated on the fly from "seed_a".
+size_t mm_enc_s(uint8_t *ct, const uint8_t seed_a[16],
+                const uint8_t *pk[], const uint8_t *mm,
+                const uint8_t seed_e[32], size_t n);
+
+//  === Encapsulation sessions: keep r (ntt domain) and seed_e so that
+//  recipients can be appended with the next index at the cost of one
+//  mmEncap^d (or mmEnc^d). The session holds secrets; clear it after use.
+
+typedef struct {
+    int32_t r_u[MM_N][MM_D];        //  r in ntt domain
+    uint8_t seed_e[32];             //  for y_i
+    uint64_t idx, lim;              //  next index, recipient limit
+} mm_ses_t;
+
+//  mmKEM & mmPKE: Start a session for at most "lim" recipients; ^ct is
+//  written to "ctu". Returns the length of ^ct.
+size_t mm_ses_init( mm_ses_t *ses, uint8_t *ctu, const int32_t *a_mat,
+                    const uint8_t seed_e[32], uint64_t lim);
+
+//  mmKEM & mmPKE: mm_ses_init() with A generated on the fly from "seed_a".
+size_t mm_ses_init_s(   mm_ses_t *ses, uint8_t *ctu,
+                        const uint8_t seed_a[16],
+                        const uint8_t seed_e[32], uint64_t lim);
+
+//  mmKEM: Append recipient "pk"; write ct_i and K_i. Returns its index i,
+//  or -1 if the session has expired (it is then cleared).
+int64_t mm_ses_encap(mm_ses_t *ses, uint8_t *cti, uint8_t *ki,
+                        const uint8_t *pk);
+
+//  mmPKE: Append recipient "pk" with message "m"; write ct_i. Returns its
+//  index i, or -1 if the session has expired (it is then cleared).
+int64_t mm_ses_enc( mm_ses_t *ses, uint8_t *cti,
+                    const uint8_t *pk, const uint8_t *m);
+
+//  mmKEM: mm_ses_encap() with a public key expanded by
+//  mm_pk_validate_batch().
+int64_t mm_ses_encap_x( mm_ses_t *ses, uint8_t *cti, uint8_t *ki,
+                        const int32_t *pkx);
+
+//  mmPKE: mm_ses_enc() with a public key expanded by
+//  mm_pk_validate_batch().
+int64_t mm_ses_enc_x(   mm_ses_t *ses, uint8_t *cti,
+                        const int32_t *pkx, const uint8_t *m);
+
+//  mmKEM & mmPKE: Clear the session; no more recipients can be appended.
+void mm_ses_clear(mm_ses_t *ses);
+
+//  === Streaming interface (bounded memory for any number of recipients)
+
+//  Recipient source: set pk[j] (and m[j] for mmPKE) for recipients
+//  i, i+1, .. and return their count (at most "max"); 0 ends the stream.
+//  The pointers must stay valid until the next call; the source may then
+//  reuse the memory they point to.
+typedef size_t (*mm_src_t)( void *arg, const uint8_t *pk[],
+                            const uint8_t *m[], size_t i, size_t max);
+
+//  Ciphertext sink: receives ct_i and K_i (NULL for mmPKE) of recipient
+//  "i" in index order. A nonzero return value stops the stream.
+typedef int (*mm_sink_t)(   void *arg, size_t i,
+                            const uint8_t *cti, const uint8_t *ki);
+
+//  mmKEM: mmEncap() with recipients pulled from "src" and (ct_i, K_i)
+//  pushed to "sink". Writes ^ct to "ctu" and returns the number of
+//  recipients processed.
+size_t mm_encap_stream( uint8_t *ctu, const int32_t *a_mat,
+                        const uint8_t seed_e[32],
+                        mm_src_t src, mm_sink_t sink, void *arg);
+
+//  mmPKE: mmEnc() with recipients and messages pulled from "src" and ct_i
+//  pushed to "sink" (with a NULL key).
+size_t mm_enc_stream(   uint8_t *ctu, const int32_t *a_mat,
+                        const uint8_t seed_e[32],
+                        mm_src_t src, mm_sink_t sink, void *arg);
+
+//  === Batches of independent encapsulations sharing A
+
+//  One mm_encap() / mm_enc() call: "n" recipients pk[0..n-1] (messages
+//  "mm" for mmPKE, keys to "kk" for mmKEM), ciphertext ^ct || ct_1 || ..
+//  to "ct" as with mm_encap(ct, kk, a_mat, pk, seed_e, n).
+
+typedef struct {
+    uint8_t *ct;
+    uint8_t *kk;                    //  mmKEM only
+    const uint8_t **pk;
+    const uint8_t *mm;              //  mmPKE only
+    const uint8_t *seed_e;          //  32 bytes
+    size_t n;
+} mm_job_t;
+
+//  mmKEM: Encapsulate each of "count" independent jobs; same output as
+//  one mm_encap() per job. Returns the total length of the ciphertexts.
+size_t mm_encap_many(   const int32_t *a_mat, const mm_job_t jobs[],
+                        size_t count);
+
+//  mmPKE: Encrypt each of "count" independent jobs; same output as one
+//  mm_enc() per job. Returns the total length of the ciphertexts.
+size_t mm_enc_many( const int32_t *a_mat, const mm_job_t jobs[],
+                    size_t count);
+
+//  === Expanded public keys
+
+//  mmKEM & mmPKE: Validate and expand "n" public keys "pk" into "pkx"
+//  (N * D words per key); ok[i] := 1 iff coefficients of pk[i] are in
+//  [0, q-1]. Returns the number of valid keys.
+size_t mm_pk_validate_batch(int32_t *pkx, uint8_t *ok,
+                            const uint8_t *pk[], size_t n);
+
+//  mmKEM: mmEncap() with public keys expanded by mm_pk_validate_batch().
+size_t mm_encap_x(  uint8_t *ct, uint8_t *kk,
+                    const int32_t *a_mat, const int32_t *pkx[],
+                    const uint8_t seed_e[32], size_t n);
+
+//  mmPKE: mmEnc() with public keys expanded by mm_pk_validate_batch().
+size_t mm_enc_x(uint8_t *ct, const int32_t *a_mat,
+                const int32_t *pkx[], const uint8_t *mm,
+                const uint8_t seed_e[32], size_t n);
+
+//  === Expanded private keys (seed-only storage)
+
+//  mmKEM & mmPKE: Re-derive private key "sk" from "seed_k" (as in mmKGen).
+void mm_sk_expand(uint8_t *sk, const uint8_t seed_k[32]);
+
+//  mmKEM & mmPKE: Expand private key "sk" into NTT domain "s" (M*D words).
+void mm_sk_ntt(int32_t *s, const uint8_t *sk);
+
+//  mmKEM: Decapsulate with a private key "s" expanded by mm_sk_ntt().
+void mm_decap_ntt(  uint8_t *k, const int32_t *s,
+                    const uint8_t *ctu, const uint8_t *cti);
+
+//  mmPKE: Decrypt with a private key "s" expanded by mm_sk_ntt().
+void mm_dec_ntt(uint8_t *m, const int32_t *s,
+                const uint8_t *ctu, const uint8_t *cti);
+
+//  === Multi-block mmPKE: "l" (at most 65536) message blocks of MMPKE_M_SZ
+//  bytes per recipient share ^ct and r; block b uses key block b and y_ib.
+
+//  mmPKE: Multi-block key of "l" key blocks (pk is l * MM_PK_SZ bytes,
+//  sk is l * MM_SK_SZ bytes); block 0 is the mm_kgen() key.
+size_t mm_kgen_l(   uint8_t *pk, uint8_t *sk,
+                    const int32_t *a_mat, const uint8_t seed_k[32], size_t l);
+
+//  mmPKE: Encrypt "l" message blocks (l * MMPKE_M_SZ bytes) to each of
+//  "n" recipients; ct is ^ct || ct_1 || .. || ct_N with l * MMPKE_CTI_SZ
+//  bytes per ct_i. "l" = 1 is mm_enc().
+size_t mm_enc_l(uint8_t *ct, const int32_t *a_mat,
+                const uint8_t *pk[], const uint8_t *mm,
+                const uint8_t seed_e[32], size_t n, size_t l);
+
+//  mmPKE: Append recipient with multi-block key "pk" and "l" message
+//  blocks "m"; write l ct_i blocks. Returns its index i, or -1 if the
+//  session has expired (it is then cleared).
+int64_t mm_ses_enc_l(   mm_ses_t *ses, uint8_t *cti,
+                        const uint8_t *pk, const uint8_t *m, size_t l);
+
+//  mmPKE: Decrypt "l" message blocks with a multi-block private key.
+void mm_dec_l(  uint8_t *m, const uint8_t *sk,
+                const uint8_t *ctu, const uint8_t *cti, size_t l);
+
 #endif
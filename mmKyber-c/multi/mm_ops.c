@@ -0,0 +1,90 @@
+//  mm_ops.c
+//  === All parameter sets in one library, selected at run time.
+
+#include <stdlib.h>
+
+#include "mm_ops.h"
+
+//  per-level instances (mm_ops_par.c)
+extern const mm_ops_t mm_ops_128, mm_ops_192, mm_ops_256;
+
+//  Function table of security level "level" (128, 192, 256), or NULL.
+
+const mm_ops_t *mm_ops_get(int level)
+{
+    switch (level) {
+        case 128:   return &mm_ops_128;
+        case 192:   return &mm_ops_192;
+        case 256:   return &mm_ops_256;
+        default:    return NULL;
+    }
+}
+
+//  Create a context for "level" with A from "seed_a".
+
+int mm_ctx_init(mm_ctx_t *ctx, int level, const uint8_t seed_a[16])
+{
+    ctx->ops = mm_ops_get(level);
+    ctx->a_mat = NULL;
+    if (ctx->ops == NULL) {
+        return -1;
+    }
+    ctx->a_mat = (int32_t *) malloc(ctx->ops->a_sz);
+    if (ctx->a_mat == NULL) {
+        return -1;
+    }
+    ctx->ops->setup(ctx->a_mat, seed_a);
+
+    return 0;
+}
+
+//  Free A of the context.
+
+void mm_ctx_clear(mm_ctx_t *ctx)
+{
+    free(ctx->a_mat);
+    ctx->a_mat = NULL;
+    ctx->ops = NULL;
+}
+
+//  mmKEM & mmPKE: mm_kgen() of the context's parameter set.
+
+size_t mm_ctx_kgen( const mm_ctx_t *ctx, uint8_t *pk, uint8_t *sk,
+                    const uint8_t seed_k[32])
+{
+    return ctx->ops->kgen(pk, sk, ctx->a_mat, seed_k);
+}
+
+//  mmKEM: mm_encap() of the context's parameter set.
+
+size_t mm_ctx_encap(const mm_ctx_t *ctx, uint8_t *ct, uint8_t *kk,
+                    const uint8_t *pk[], const uint8_t seed_e[32],
+                    size_t n)
+{
+    return ctx->ops->encap(ct, kk, ctx->a_mat, pk, seed_e, n);
+}
+
+//  mmKEM: mm_decap() of the context's parameter set.
+
+void mm_ctx_decap(  const mm_ctx_t *ctx, uint8_t *k, const uint8_t *sk,
+                    const uint8_t *ctu, const uint8_t *cti)
+{
+    ctx->ops->decap(k, sk, ctu, cti);
+}
+
+//  mmPKE: mm_enc() of the context's parameter set.
+
+size_t mm_ctx_enc(  const mm_ctx_t *ctx, uint8_t *ct,
+                    const uint8_t *pk[], const uint8_t *mm,
+                    const uint8_t seed_e[32], size_t n)
+{
+    return ctx->ops->enc(ct, ctx->a_mat, pk, mm, seed_e, n);
+}
+
+//  mmPKE: mm_dec() of the context's parameter set.
+
+void mm_ctx_dec(const mm_ctx_t *ctx, uint8_t *m, const uint8_t *sk,
+                const uint8_t *ctu, const uint8_t *cti)
+{
+    ctx->ops->dec(m, sk, ctu, cti);
+}
@@ -0,0 +1,20 @@
+//  mm_ops_par.c
+//  === Function table of one parameter set (compiled once per level).
+
+#include "mm_ops.h"
+#include "mmkyber.h"
+
+#define OPS_STR(x)  #x
+#define OPS_XSTR(x) OPS_STR(x)
+
+const mm_ops_t mm_ops_par = {
+    "mmKyber-" OPS_XSTR(MM_LEVEL),
+    MM_LEVEL, MM_M, MM_N, MM_DU, MMPKE_DV,
+
+    4 * MM_M * MM_N * MM_D,
+    MM_PK_SZ, MM_SK_SZ, MM_CTU_SZ,
+    MMKEM_CTI_SZ, MMPKE_CTI_SZ,
+    MMKEM_K_SZ, MMPKE_M_SZ,
+
+    mm_setup, mm_kgen, mm_encap, mm_decap, mm_enc, mm_dec
+};
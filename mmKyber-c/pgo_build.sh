@@ -0,0 +1,60 @@
+#!/bin/bash
+
+#	Profile-guided, link-time optimized build of xtest and libmmkyber:
+#	instrument, train on the BENCH workload (N = 1 .. 1024), rebuild with
+#	-fprofile-use -flto. Writes pgo-report.txt: cycles per call of each
+#	benchmarked function and N, plain -O3 build vs. PGO + LTO build.
+#
+#	usage: ./pgo_build.sh [MODE] [LEVEL]
+#	(env REP: MM_REP_TOT per run, at least 1024)
+
+MODE=${1:-KEM}
+LEVEL=${2:-128}
+REP=${REP:-2048}
+if [ $REP -lt 1024 ]; then
+	REP=1024
+fi
+PROF=$PWD/pgo-prof
+MK="make MODE=$MODE LEVEL=$LEVEL TEST=BENCH AR=gcc-ar"
+
+set -e
+
+#	plain -O3 build
+make obj-clean > /dev/null
+CFLAGS="-DMM_REP_TOT=$REP" $MK xtest > /dev/null
+./xtest > pgo-base.tmp
+
+#	instrumented build, training run
+rm -rf $PROF
+make obj-clean > /dev/null
+CFLAGS="-DMM_REP_TOT=$REP -fprofile-generate=$PROF -fprofile-update=atomic" \
+	$MK xtest > /dev/null
+./xtest > /dev/null
+
+#	optimized build (kernels of other backends, tools have no profile)
+make obj-clean > /dev/null
+CFLAGS="-DMM_REP_TOT=$REP -fprofile-use=$PROF -fprofile-partial-training \
+	-Wno-missing-profile -flto=auto -ffat-lto-objects" \
+	$MK xtest lib > /dev/null
+./xtest > pgo-opt.tmp
+
+#	report: "function N cycles" from both runs
+(
+	echo -n "# "
+	uname -a
+	echo -n "# "
+	date
+	echo "# $MODE-$LEVEL  kernels: $(grep kernels pgo-opt.tmp | awk '{print $3}')"
+	printf "%-12s %5s %12s %12s %8s\n" function N O3 PGO+LTO delta
+	awk '/cyc=/ {
+			f = $2; n = $4; c = $6;
+			if (FILENAME == ARGV[1]) {
+				base[f " " n] = c;
+			} else if ((f " " n) in base) {
+				b = base[f " " n];
+				printf "%-12s %5d %12d %12d %+7.1f%%\n",
+						f, n, b, c, 100.0 * (c - b) / b;
+			}
+		}' pgo-base.tmp pgo-opt.tmp
+) | tee pgo-report.txt
+rm -f pgo-base.tmp pgo-opt.tmp
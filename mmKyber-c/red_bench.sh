@@ -0,0 +1,40 @@
+#!/bin/bash
+
+#	Montgomery (RED=mont) vs. special-prime shift-and-subtract (RED=spq)
+#	reduction of mm_ring.h: builds xredbench both ways and writes
+#	red-report.txt with cycles per call of scalar code and of each kernel
+#	backend this CPU runs.
+#
+#	usage: ./red_bench.sh [MODE] [LEVEL]
+
+MODE=${1:-KEM}
+LEVEL=${2:-128}
+MK="make MODE=$MODE LEVEL=$LEVEL TEST=BENCH"
+
+set -e
+
+for red in mont spq; do
+	make obj-clean > /dev/null
+	$MK RED=$red xredbench > /dev/null
+	./xredbench > red-$red.tmp
+done
+make obj-clean > /dev/null
+
+(
+	echo -n "# "
+	uname -a
+	echo -n "# "
+	date
+	printf "%-12s %-8s %10s %10s %8s\n" function kernel mont spq delta
+	awk '/cyc=/ {
+			k = $2 " " $3; c = $5;
+			if (FILENAME == ARGV[1]) {
+				base[k] = c;
+			} else if (k in base) {
+				b = base[k];
+				printf "%-12s %-8s %10d %10d %+7.1f%%\n",
+						$2, $3, b, c, 100.0 * (c - b) / b;
+			}
+		}' red-mont.tmp red-spq.tmp
+) | tee red-report.txt
+rm -f red-mont.tmp red-spq.tmp
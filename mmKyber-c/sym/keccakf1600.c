@@ -3,6 +3,7 @@
 
 #include "keccakf1600.h"
 #include "plat_local.h"
+#include "mm_kern.h"
 
 //  FIPS 202 Keccak f1600 permutation, 24 rounds -- Keccak-p[1600,24](S)
 //  The function is copied from "fips202.c" in Kyber reference code.
@@ -45,7 +46,7 @@ static const uint64_t KeccakF_RoundConstants[NROUNDS] = {
 *
 * Arguments:   - uint64_t *state: pointer to input/output Keccak state
 **************************************************/
-void keccak_f1600(uint64_t state[25])
+void MM_KN(keccak_f1600)(uint64_t state[25])
 {
     int round;
 
@@ -309,3 +310,70 @@ void keccak_f1600(uint64_t state[25])
     state[24] = Asu;
 }
 
+
+//  Four parallel Keccak f1600 permutations; state[i][l] is word i of lane l.
+//  Written as loops over the lanes so that the compiler can vectorize them.
+
+#define ROLX(a, r) (((a) << (r)) | ((a) >> ((64 - (r)) & 63)))
+
+//  rho rotation offsets for word i = x + 5*y
+static const uint8_t keccak_rho[25] = {
+     0,  1, 62, 28, 27, 36, 44,  6, 55, 20,  3, 10, 43,
+    25, 39, 41, 45, 15, 21,  8, 18,  2, 61, 56, 14
+};
+
+//  pi destination of word i: (x, y) -> (y, 2x + 3y)
+static const uint8_t keccak_pi[25] = {
+     0, 10, 20,  5, 15, 16,  1, 11, 21,  6,  7, 17,  2,
+    12, 22, 23,  8, 18,  3, 13, 14, 24,  9, 19,  4
+};
+
+void MM_KN(keccak_f1600_x4)(uint64_t state[25][4])
+{
+    int round, i, x, y, l;
+    uint64_t c[5][4], d[4], b[25][4];
+
+    for (round = 0; round < NROUNDS; round++) {
+
+        //  theta
+        for (x = 0; x < 5; x++) {
+            for (l = 0; l < 4; l++) {
+                c[x][l] =   state[x][l] ^ state[x + 5][l] ^
+                            state[x + 10][l] ^ state[x + 15][l] ^
+                            state[x + 20][l];
+            }
+        }
+        for (x = 0; x < 5; x++) {
+            for (l = 0; l < 4; l++) {
+                d[l] = c[(x + 4) % 5][l] ^ ROLX(c[(x + 1) % 5][l], 1);
+            }
+            for (y = 0; y < 25; y += 5) {
+                for (l = 0; l < 4; l++) {
+                    state[x + y][l] ^= d[l];
+                }
+            }
+        }
+
+        //  rho and pi
+        for (i = 0; i < 25; i++) {
+            for (l = 0; l < 4; l++) {
+                b[keccak_pi[i]][l] = ROLX(state[i][l], keccak_rho[i]);
+            }
+        }
+
+        //  chi
+        for (y = 0; y < 25; y += 5) {
+            for (x = 0; x < 5; x++) {
+                for (l = 0; l < 4; l++) {
+                    state[x + y][l] = b[x + y][l] ^
+                        ((~b[(x + 1) % 5 + y][l]) & b[(x + 2) % 5 + y][l]);
+                }
+            }
+        }
+
+        //  iota
+        for (l = 0; l < 4; l++) {
+            state[0][l] ^= KeccakF_RoundConstants[round];
+        }
+    }
+}
@@ -9,11 +9,21 @@ extern "C" {
 #endif
 
 #include "plat_local.h"
+#include "mm_kern.h"
 
-//  == low-level interface, keccakf1600.c or native
+//  == low-level interface, keccakf1600.c via the backend table (mm_kern.h)
 
 //  FIPS 202 Keccak f1600 permutation, 24 rounds
-void keccak_f1600(uint64_t state[25]);
+static inline void keccak_f1600(uint64_t state[25])
+{
+    mm_kern->keccak_f1600(state);
+}
+
+//  Four parallel permutations, state[i][l] is word i of lane l
+static inline void keccak_f1600_x4(uint64_t state[25][4])
+{
+    mm_kern->keccak_f1600_x4(state);
+}
 
 //  clear the state
 static inline void keccak_clear(uint64_t state[25])
@@ -11,6 +11,7 @@ extern "C" {
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <time.h>
 
 #ifndef PLAT_VERS_STR
 #define PLAT_VERS_STR "dev version"
@@ -79,6 +80,14 @@ extern "C" {
 #define XALIGN(x)
 #endif
 
+//  Forced inlining macro XINLINE (e.g. to fold constant function pointers)
+
+#if defined(__GNUC__)
+#define XINLINE inline __attribute__((always_inline))
+#else
+#define XINLINE inline
+#endif
+
 //  === Assume-Assert checks
 
 //  No-op for production
@@ -200,6 +209,20 @@ static inline uint64_t plat_get_cycle()
 #endif
 }
 
+//  CLOCK_MONOTONIC time in nanoseconds (comparable across processes)
+
+static inline uint64_t plat_get_ns()
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
 //  revert if not big endian
 
 #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
@@ -0,0 +1,78 @@
+//  sha3x4_t.c
+//  === Four-lane SHAKE for parallel generation of independent streams.
+
+#include <string.h>
+
+#include "sha3x4_t.h"
+#include "keccakf1600.h"
+
+//  Absorb four "m_sz"-byte messages m[0..3] at rate "r" and pad with "p".
+
+void sha3x4_absorb_pad( sha3x4_t* kx, size_t r,
+                        const uint8_t* m[4], size_t m_sz, uint8_t p)
+{
+    size_t i, j;
+    int l;
+    uint8_t b[200];
+
+    memset(kx->s, 0, sizeof(kx->s));
+    kx->r = r;
+
+    //  full blocks
+    for (j = 0; m_sz - j >= r; j += r) {
+        for (l = 0; l < 4; l++) {
+            for (i = 0; i < r / 8; i++) {
+                kx->s[i][l] ^= get64u_le(m[l] + j + 8 * i);
+            }
+        }
+        keccak_f1600_x4(kx->s);
+    }
+
+    //  last partial block and padding
+    for (l = 0; l < 4; l++) {
+        memset(b, 0, r);
+        memcpy(b, m[l] + j, m_sz - j);
+        b[m_sz - j] = p;
+        b[r - 1] |= 0x80;
+        for (i = 0; i < r / 8; i++) {
+            kx->s[i][l] ^= get64u_le(b + 8 * i);
+        }
+    }
+}
+
+//  Squeeze "nb" full blocks (nb * r bytes) into each of h[0..3].
+
+void sha3x4_squeeze_blocks(sha3x4_t* kx, uint8_t* h[4], size_t nb)
+{
+    size_t i, j;
+    int l;
+
+    for (j = 0; j < nb; j++) {
+        keccak_f1600_x4(kx->s);
+        for (l = 0; l < 4; l++) {
+            for (i = 0; i < kx->r / 8; i++) {
+                put64u_le(h[l] + j * kx->r + 8 * i, kx->s[i][l]);
+            }
+        }
+    }
+}
+
+//  Continue lane "l" as a single-lane context "kec" (at a block boundary).
+
+void sha3x4_lane(sha3_t* kec, const sha3x4_t* kx, int l)
+{
+    int i;
+
+    for (i = 0; i < 25; i++) {
+        kec->s[i] = kx->s[i][l];
+    }
+    kec->r = kx->r;
+    kec->i = kx->r;             //  next squeeze permutes
+}
+
+//  Clear sensitive information from the context "kx."
+
+void sha3x4_clear(sha3x4_t* kx)
+{
+    memset(kx, 0, sizeof(sha3x4_t));
+}
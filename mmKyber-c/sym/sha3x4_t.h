@@ -0,0 +1,41 @@
+//  sha3x4_t.h
+//  === Four-lane SHAKE for parallel generation of independent streams.
+
+#ifndef _SHA3X4_T_H_
+#define _SHA3X4_T_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "sha3_t.h"
+
+//  four independent Keccak states, s[i][l] is word i of lane l
+
+typedef struct {
+    uint64_t s[25][4];
+    size_t r;
+} sha3x4_t;
+
+//  Absorb four "m_sz"-byte messages m[0..3] at rate "r" and pad with "p".
+
+void sha3x4_absorb_pad( sha3x4_t* kx, size_t r,
+                        const uint8_t* m[4], size_t m_sz, uint8_t p);
+
+//  Squeeze "nb" full blocks (nb * r bytes) into each of h[0..3].
+
+void sha3x4_squeeze_blocks(sha3x4_t* kx, uint8_t* h[4], size_t nb);
+
+//  Continue lane "l" as a single-lane context "kec" (at a block boundary).
+
+void sha3x4_lane(sha3_t* kec, const sha3x4_t* kx, int l);
+
+//  Clear sensitive information from the context "kx."
+
+void sha3x4_clear(sha3x4_t* kx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
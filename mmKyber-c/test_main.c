@@ -8,11 +8,30 @@
 #include <stdlib.h>
 #include <time.h>
 #include <sys/time.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include "plat_local.h"
 #include "sha3_t.h"
 #include "mmkyber.h"
 #include "mm_param.h"
+#include "mm_ring.h"
+#include "mm_serial.h"
+#include "mm_skcache.h"
+#include "mm_bcast.h"
+#include "mm_pkdir.h"
+#include "mm_fanout.h"
+#include "mm_dem.h"
+#include "mm_srv.h"
+#include "mm_cli.h"
+#include "mm_shq.h"
+#include "mm_step.h"
+#include "mm_sched.h"
+#include "mm_shard.h"
+#include "mm_ops.h"
+#include "mm_kern.h"
+#include "mm_tune.h"
 
 #ifndef MM_N_MAX
 #define MM_N_MAX 1024
@@ -58,6 +77,1509 @@ uint32_t dbg_sum(const void *b, size_t b_sz, const char *lab)
     return x;
 }
 
+#ifdef TESTVEC
+
+//  compare the LRU list of "c", most recent first, both ways with "id"
+
+static int test_skc_lru(const mm_skc_t *c, const uint64_t *id, int n)
+{
+    uint32_t x;
+    int i, fail = c->used != (uint32_t) n;
+
+    for (i = 0, x = c->head; i < n && x < c->used; x = c->ent[x].nxt) {
+        fail += c->ent[x].id != id[i++];
+    }
+    fail += i != n || x != 0xFFFFFFFFu;
+    for (i = n, x = c->tail; i > 0 && x < c->used; x = c->ent[x].prv) {
+        fail += c->ent[x].id != id[--i];
+    }
+    fail += i != 0 || x != 0xFFFFFFFFu;
+
+    return fail;
+}
+
+//  seed-only keys via a small (evicting) expanded-key cache
+
+static void test_skcache(   const uint8_t *ct, const uint8_t *ref,
+                            const uint8_t seed_k[32], int nn)
+{
+    static uint8_t mem[3 * sizeof(mm_skc_ent_t) + 64],
+        mem4[4 * sizeof(mm_skc_ent_t) + 128];
+    static const uint64_t get4[] = { 0, 1, 2, 3, 0 }, new4[] = { 4, 5 },
+        lru1[] = { 0, 3, 1 }, lru2[] = { 5, 4, 0, 3 };
+    mm_skc_t skc;
+    uint8_t seed[32], x[32];
+    int i, j, fail;
+
+    memcpy(seed, seed_k, 32);
+    mm_skc_init(&skc, mem, sizeof(mem));
+
+    for (j = 0; j < 2 * nn; j++) {
+        for (i = j / 2; i >= 0 && i > j / 2 - 2; i--) {
+            put64u_le(seed, i);
+#ifdef MM_KEM
+            mm_skc_decap(&skc, x, i, seed, ct,
+                            ct + MM_CTU_SZ + (i * MMKEM_CTI_SZ));
+            if (memcmp(x, ref + (i * MMKEM_K_SZ), MMKEM_K_SZ) != 0) {
+                printf("[FAIL] skc_decap #%d\n", i);
+            }
+#else
+            mm_skc_dec(&skc, x, i, seed, ct,
+                            ct + MM_CTU_SZ + (i * MMPKE_CTI_SZ));
+            if (memcmp(x, ref + (i * MMPKE_M_SZ), MMPKE_M_SZ) != 0) {
+                printf("[FAIL] skc_dec #%d\n", i);
+            }
+#endif
+        }
+    }
+    printf("skcache: cap= %u  hits= %lu  miss= %lu\n",
+            skc.cap, skc.hits, skc.miss);
+    mm_skc_clear(&skc);
+
+    //  a drop keeps the LRU order of the entry moved into the hole
+    fail = mm_skc_init(&skc, mem4, sizeof(mem4)) != 4;
+
+    for (i = 0; i < 5; i++) {
+        put64u_le(seed, get4[i]);
+        mm_skc_get(&skc, get4[i], seed);
+    }
+    mm_skc_drop(&skc, 2);               //  slot of 3 moves into the hole
+    fail += test_skc_lru(&skc, lru1, 3);
+    for (i = 0; i < 2; i++) {           //  free slot, then evicts 1
+        put64u_le(seed, new4[i]);
+        mm_skc_get(&skc, new4[i], seed);
+    }
+    fail += test_skc_lru(&skc, lru2, 4);
+    mm_skc_clear(&skc);
+
+    //  no capacity
+    fail += mm_skc_init(&skc, mem4, 16) != 0;
+    mm_skc_drop(&skc, 0);
+    mm_skc_clear(&skc);
+    if (fail) {
+        printf("[FAIL] skc_drop (LRU order)\n");
+    }
+}
+
+//  public key validation and encapsulation with expanded keys
+
+static void test_pkx(   const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t seed_e[32],
+                        const uint8_t *mm, int nn)
+{
+    static int32_t pkx[MM_N_MAX * MM_N * MM_D];
+    static uint8_t ok[MM_N_MAX], bad[MM_PK_SZ];
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)];
+    const int32_t *px[MM_N_MAX];
+    const uint8_t *pb[1] = { bad };
+    size_t ct_sz;
+    int i;
+
+    if (mm_pk_validate_batch(pkx, ok, pk, nn) != (size_t) nn) {
+        printf("[FAIL] pk_validate\n");
+    }
+    for (i = 0; i < nn; i++) {
+        px[i] = pkx + i * (MM_N * MM_D);
+    }
+
+#ifdef MM_KEM
+    uint8_t kk2[MM_N_MAX * MMKEM_K_SZ];
+    (void) mm;
+    ct_sz = mm_encap_x(ct2, kk2, a_mat, px, seed_e, nn);
+#else
+    ct_sz = mm_enc_x(ct2, a_mat, px, mm, seed_e, nn);
+#endif
+    if (memcmp(ct, ct2, ct_sz) != 0) {
+        printf("[FAIL] encap_x\n");
+    }
+
+    //  a coefficient == q is not canonical
+    memcpy(bad, pk[0], MM_PK_SZ);
+    put32u_le(bad + MM_PK_SZ - 4,
+        (get32u_le(bad + MM_PK_SZ - 4) & 0x7F) | (MM_Q << 7));
+    if (mm_pk_validate_batch(pkx, ok, pb, 1) != 0 || ok[0] != 0) {
+        printf("[FAIL] pk_validate (reject)\n");
+    }
+}
+
+//  A generated on the fly from seed_a
+
+static void test_seed_a(const uint8_t *ct, const uint8_t seed_a[16],
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_k[32], const uint8_t seed_e[32],
+                        const uint8_t *mm, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)];
+    uint8_t pk2[MM_PK_SZ], sk2[MM_SK_SZ], seed[32];
+    size_t ct_sz;
+    int i;
+
+    memcpy(seed, seed_k, 32);
+    for (i = 0; i < nn; i++) {
+        put64u_le(seed, i);
+        mm_kgen_s(pk2, sk2, seed_a, seed);
+        if (memcmp(pk2, pk[i], MM_PK_SZ) != 0 ||
+            memcmp(sk2, sk[i], MM_SK_SZ) != 0) {
+            printf("[FAIL] kgen_s #%d\n", i);
+        }
+    }
+
+#ifdef MM_KEM
+    uint8_t kk2[MM_N_MAX * MMKEM_K_SZ];
+    (void) mm;
+    ct_sz = mm_encap_s(ct2, kk2, seed_a, pk, seed_e, nn);
+#else
+    ct_sz = mm_enc_s(ct2, seed_a, pk, mm, seed_e, nn);
+#endif
+    if (memcmp(ct, ct2, ct_sz) != 0) {
+        printf("[FAIL] encap_s\n");
+    }
+}
+
+//  streaming interface; the source hands out two recipients at a time,
+//  copied into one buffer that every call overwrites
+
+typedef struct {
+    const uint8_t **pk, *mm, *ct, *kk;
+    size_t nn, fail;
+    uint8_t pk_buf[2][MM_PK_SZ], m_buf[2][MMPKE_M_SZ];
+} test_stream_t;
+
+static size_t test_src(void *arg, const uint8_t *pk[], const uint8_t *m[],
+                        size_t i, size_t max)
+{
+    test_stream_t *ts = (test_stream_t *) arg;
+    size_t j;
+
+    memset(ts->pk_buf, 0, sizeof(ts->pk_buf));
+    memset(ts->m_buf, 0, sizeof(ts->m_buf));
+    for (j = 0; j < max && j < 2 && i + j < ts->nn; j++) {
+        memcpy(ts->pk_buf[j], ts->pk[i + j], MM_PK_SZ);
+        pk[j] = ts->pk_buf[j];
+        if (ts->mm != NULL) {
+            memcpy(ts->m_buf[j], ts->mm + (i + j) * MMPKE_M_SZ, MMPKE_M_SZ);
+            m[j] = ts->m_buf[j];
+        }
+    }
+    return j;
+}
+
+static int test_sink(void *arg, size_t i, const uint8_t *cti,
+                        const uint8_t *ki)
+{
+    test_stream_t *ts = (test_stream_t *) arg;
+
+#ifdef MM_KEM
+    if (memcmp(cti, ts->ct + MM_CTU_SZ + i * MMKEM_CTI_SZ,
+                MMKEM_CTI_SZ) != 0 ||
+        memcmp(ki, ts->kk + i * MMKEM_K_SZ, MMKEM_K_SZ) != 0) {
+        ts->fail++;
+    }
+#else
+    (void) ki;
+    if (memcmp(cti, ts->ct + MM_CTU_SZ + i * MMPKE_CTI_SZ,
+                MMPKE_CTI_SZ) != 0) {
+        ts->fail++;
+    }
+#endif
+    return 0;
+}
+
+static void test_stream(const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t seed_e[32],
+                        const uint8_t *mm, const uint8_t *kk, int nn)
+{
+    static test_stream_t ts;
+    uint8_t ctu[MM_CTU_SZ];
+    size_t n;
+
+    ts.pk = pk;
+    ts.mm = mm;
+    ts.ct = ct;
+    ts.kk = kk;
+    ts.nn = nn;
+    ts.fail = 0;
+#ifdef MM_KEM
+    n = mm_encap_stream(ctu, a_mat, seed_e, test_src, test_sink, &ts);
+#else
+    n = mm_enc_stream(ctu, a_mat, seed_e, test_src, test_sink, &ts);
+#endif
+    if (n != (size_t) nn || ts.fail != 0 ||
+        memcmp(ctu, ct, MM_CTU_SZ) != 0) {
+        printf("[FAIL] stream\n");
+    }
+}
+
+//  session with recipients appended one at a time
+
+static void test_session(   const uint8_t *ct, const int32_t *a_mat,
+                            const uint8_t *pk[], const uint8_t seed_e[32],
+                            const uint8_t *mm, const uint8_t *kk, int nn)
+{
+    static mm_ses_t ses;
+    uint8_t ctu[MM_CTU_SZ], cti[MMPKE_CTI_SZ], ki[MMKEM_K_SZ];
+    int i, fail;
+
+    fail = mm_ses_init(&ses, ctu, a_mat, seed_e, nn) != MM_CTU_SZ ||
+            memcmp(ctu, ct, MM_CTU_SZ) != 0;
+    for (i = 0; i <= nn; i++) {
+#ifdef MM_KEM
+        (void) mm;
+        if (mm_ses_encap(&ses, cti, ki, pk[i < nn ? i : 0]) !=
+            (i < nn ? i : -1)) {
+            fail++;
+        } else if (i < nn && (
+            memcmp(cti, ct + MM_CTU_SZ + i * MMKEM_CTI_SZ,
+                    MMKEM_CTI_SZ) != 0 ||
+            memcmp(ki, kk + i * MMKEM_K_SZ, MMKEM_K_SZ) != 0)) {
+            fail++;
+        }
+#else
+        (void) kk;
+        (void) ki;
+        if (mm_ses_enc(&ses, cti, pk[i < nn ? i : 0], mm + i * MMPKE_M_SZ) !=
+            (i < nn ? i : -1)) {
+            fail++;
+        } else if (i < nn &&
+            memcmp(cti, ct + MM_CTU_SZ + i * MMPKE_CTI_SZ,
+                    MMPKE_CTI_SZ) != 0) {
+            fail++;
+        }
+#endif
+    }
+    if (fail) {
+        printf("[FAIL] session\n");
+    }
+}
+
+//  broadcast container: write, map, and look up recipients by id
+
+static void test_bcast(const uint8_t *ct, const uint8_t seed_a[16], int nn)
+{
+    static uint8_t buf[MM_BC_HDR_SZ + MM_CTU_SZ + MM_N_MAX * (MM_BC_CTI_SZ + 32)
+                        + 2 * MM_BC_ALIGN];
+    uint64_t ids[MM_N_MAX];
+    char fn[] = "/tmp/mm_bcast.XXXXXX";
+    size_t sz;
+    mm_bc_t bc;
+    FILE *fp;
+    int i, fd, fail;
+
+    for (i = 0; i < nn; i++) {
+        ids[i] = 1000 + 7 * i;
+    }
+    sz = mm_bc_write(buf, seed_a, ids, ct, nn);
+    fail = sz != mm_bc_size(nn, 1);
+
+    fd = mkstemp(fn);
+    fp = fd < 0 ? NULL : fdopen(fd, "wb");
+    if (fp == NULL || fwrite(buf, 1, sz, fp) != sz) {
+        fail++;
+    }
+    if (fp != NULL) {
+        fclose(fp);
+    } else if (fd >= 0) {
+        close(fd);
+    }
+    if (fd < 0 || mm_bc_map(&bc, fn) != 0) {
+        printf("[FAIL] bcast map\n");
+        if (fd >= 0) {
+            unlink(fn);
+        }
+        return;
+    }
+    fail += bc.n != (uint64_t) nn || memcmp(bc.dom, seed_a, 16) != 0 ||
+            memcmp(bc.ctu, ct, MM_CTU_SZ) != 0 ||
+            mm_bc_find(&bc, 999) != -1;
+    for (i = 0; i < nn; i++) {
+        fail += mm_bc_find(&bc, ids[i]) != i ||
+                memcmp(mm_bc_cti(&bc, i), ct + MM_CTU_SZ + i * MM_BC_CTI_SZ,
+                        MM_BC_CTI_SZ) != 0;
+    }
+    mm_bc_unmap(&bc);
+    unlink(fn);
+
+    //  truncated container is rejected
+    fail += mm_bc_open(&bc, buf, sz - 1) == 0;
+    if (fail) {
+        printf("[FAIL] bcast\n");
+    }
+}
+
+//  public key directory: build packed and expanded, map, encapsulate
+
+static void test_pkdir( const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t seed_a[16],
+                        const uint8_t seed_e[32], const uint8_t *mm, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)];
+    uint64_t ids[MM_N_MAX];
+    const char *fn = "/tmp/mm_pkdir.tmp";
+    mm_pkd_t d, d2;
+    uint8_t *p;
+    size_t ct_sz;
+    int i, x, fail;
+
+    for (i = 0; i < nn; i++) {
+        ids[i] = 5000 + 3 * i;
+    }
+    fail = 0;
+    for (x = 0; x < 2; x++) {
+        if (mm_pkd_build(fn, seed_a, ids, pk, nn, x) != 0 ||
+            mm_pkd_map(&d, fn, MM_PKD_POPULATE | MM_PKD_HUGE) != 0) {
+            printf("[FAIL] pkdir build/map\n");
+            return;
+        }
+        for (i = 0; i < nn; i++) {
+            fail += mm_pkd_find(&d, ids[i]) != i;
+        }
+        fail += mm_pkd_find(&d, 1) != -1;
+#ifdef MM_KEM
+        uint8_t kk2[MM_N_MAX * MMKEM_K_SZ];
+        (void) mm;
+        ct_sz = mm_pkd_encap(ct2, kk2, a_mat, &d, 0, nn, seed_e);
+#else
+        ct_sz = mm_pkd_enc(ct2, a_mat, &d, 0, nn, mm, seed_e);
+#endif
+        fail += ct_sz == 0 || memcmp(ct, ct2, ct_sz) != 0;
+
+        //  expanded keys of the other byte order (or packed ones marked
+        //  as such) are rejected
+        if ((p = (uint8_t *) malloc(d.sz)) != NULL) {
+            memcpy(p, d.buf, d.sz);
+            p[8] ^= MM_PKD_BIG;
+            fail += mm_pkd_open(&d2, p, d.sz) == 0;
+            free(p);
+        }
+        mm_pkd_unmap(&d);
+    }
+    remove(fn);
+    if (fail) {
+        printf("[FAIL] pkdir\n");
+    }
+}
+
+//  per-recipient packets written to pipes without copying ct_u
+
+static void test_fanout(const uint8_t *ct, int nn)
+{
+    static uint8_t pkt[8 + MM_CTU_SZ + MM_CTI_SZ + 1];
+    static struct iovec iov[MM_N_MAX * MM_PKT_IOV];
+    uint8_t hdr[MM_N_MAX * 8];
+    int fd[MM_N_MAX], pp[MM_N_MAX][2];
+    int i, fail;
+
+    for (i = 0; i < nn; i++) {
+        put64u_le(hdr + 8 * i, 0x1000 + i);
+        if (pipe(pp[i]) != 0) {
+            printf("[FAIL] fanout pipe\n");
+            return;
+        }
+        fd[i] = pp[i][1];
+    }
+    fail = mm_pkt_fanout(fd, hdr, 8, ct, nn) != (size_t) nn;
+
+    for (i = 0; i < nn; i++) {
+        close(pp[i][1]);
+        fail += read(pp[i][0], pkt, sizeof(pkt)) !=
+                    8 + MM_CTU_SZ + MM_CTI_SZ ||
+                get64u_le(pkt) != (uint64_t) (0x1000 + i) ||
+                memcmp(pkt + 8, ct, MM_CTU_SZ) != 0 ||
+                memcmp(pkt + 8 + MM_CTU_SZ,
+                        ct + MM_CTU_SZ + i * MM_CTI_SZ, MM_CTI_SZ) != 0;
+        close(pp[i][0]);
+    }
+
+    //  without headers the descriptors are packed two per recipient
+    fail += mm_pkt_iov_all(iov, NULL, 0, ct, nn) != (size_t) (2 * nn);
+    for (i = 0; i < nn; i++) {
+        fail += iov[2 * i].iov_base != ct ||
+                iov[2 * i + 1].iov_base != ct + MM_CTU_SZ + i * MM_CTI_SZ;
+    }
+    if (fail) {
+        printf("[FAIL] fanout\n");
+    }
+}
+
+#ifdef MM_KEM
+
+//  hybrid broadcast: one payload, a key-wrap slot per recipient
+
+#define TEST_DEM_SZ (2 * MM_DEM_CHUNK + 1000)
+
+static void test_dem(   const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_e[32], const uint8_t *kk, int nn)
+{
+    static uint8_t msg[TEST_DEM_SZ], out[TEST_DEM_SZ],
+        enc[TEST_DEM_SZ + 3 * MM_DEM_TAG_SZ];
+    uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMKEM_CTI_SZ)];
+    uint8_t slots[MM_N_MAX * MM_DEM_SLOT_SZ], slot[MM_DEM_SLOT_SZ];
+    uint8_t pkey[MM_DEM_KEY_SZ], key2[MM_DEM_KEY_SZ];
+    uint8_t nonce[MM_DEM_NONCE_SZ] = "broadcast nonce";
+    mm_dem_t st;
+    size_t i, j, l, c, ct_sz, enc_sz = 0;
+    int64_t r;
+    int fail = 0;
+
+    shake256(msg, sizeof(msg), (const uint8_t *) "payload", 7);
+    shake256(pkey, sizeof(pkey), seed_e, 32);
+
+    //  header: same ciphertext as mm_encap(), slots wrap under K_i
+    ct_sz = mm_dem_encap(ct2, slots, a_mat, pk, nn, seed_e, pkey, nonce);
+    fail += ct_sz != (size_t) (MM_CTU_SZ + nn * MMKEM_CTI_SZ) ||
+            memcmp(ct2, ct, ct_sz) != 0;
+    for (i = 0; i < (size_t) nn; i++) {
+        mm_dem_wrap(slot, kk + i * MMKEM_K_SZ, i, pkey, nonce);
+        fail += memcmp(slot, slots + i * MM_DEM_SLOT_SZ, sizeof(slot)) != 0;
+    }
+
+    //  payload: encrypted once, chunk by chunk
+    mm_dem_init(&st, pkey, nonce);
+    for (i = 0; i < sizeof(msg); i += l) {
+        l = sizeof(msg) - i < MM_DEM_CHUNK ? sizeof(msg) - i : MM_DEM_CHUNK;
+        enc_sz += mm_dem_enc_chunk(&st, enc + enc_sz, msg + i, l,
+                                    i + l == sizeof(msg));
+    }
+    fail += enc_sz != sizeof(enc);
+
+    //  each recipient unwraps and decrypts as a stream
+    for (i = 0; i < (size_t) nn; i++) {
+        if (mm_dem_decap(key2, sk[i], ct, ct + MM_CTU_SZ + i * MMKEM_CTI_SZ,
+                    slots + i * MM_DEM_SLOT_SZ, i, nonce) != 0) {
+            fail++;
+            continue;
+        }
+        mm_dem_init(&st, key2, nonce);
+        for (l = 0, j = 0; l < sizeof(enc); l += c, j += r) {
+            c = sizeof(enc) - l;
+            c = c < MM_DEM_CHUNK + MM_DEM_TAG_SZ ?
+                    c : MM_DEM_CHUNK + MM_DEM_TAG_SZ;
+            r = mm_dem_dec_chunk(&st, out + j, enc + l, c,
+                                    l + c == sizeof(enc));
+            if (r < 0) {
+                fail++;
+                break;
+            }
+        }
+        fail += memcmp(out, msg, sizeof(msg)) != 0;
+    }
+
+    //  wrong slot, tampered chunk, and truncation are rejected
+    fail += mm_dem_decap(key2, sk[0], ct, ct + MM_CTU_SZ,
+                            slots + MM_DEM_SLOT_SZ, 0, nonce) == 0;
+    enc[MM_DEM_CHUNK + MM_DEM_TAG_SZ + 5] ^= 1;
+    mm_dem_init(&st, pkey, nonce);
+    fail += mm_dem_dec_chunk(&st, out, enc,
+                                MM_DEM_CHUNK + MM_DEM_TAG_SZ, 0) < 0;
+    fail += mm_dem_dec_chunk(&st, out, enc + MM_DEM_CHUNK + MM_DEM_TAG_SZ,
+                                MM_DEM_CHUNK + MM_DEM_TAG_SZ, 0) >= 0;
+    enc[MM_DEM_CHUNK + MM_DEM_TAG_SZ + 5] ^= 1;
+    mm_dem_init(&st, pkey, nonce);
+    fail += mm_dem_dec_chunk(&st, out, enc,
+                                MM_DEM_CHUNK + MM_DEM_TAG_SZ, 1) >= 0;
+    mm_dem_clear(&st);
+
+    if (fail) {
+        printf("[FAIL] dem\n");
+    }
+}
+
+//  batching service: two clients on a local socket, keys checked locally;
+//  a third floods requests without reading
+
+#define TEST_SRV_FLOOD  1024
+
+static void *test_srv_run(void *arg)
+{
+    mm_srv_t *srv = (mm_srv_t *) arg;
+    int lfd;
+
+    lfd = mm_srv_listen("/tmp/mm_srv.sock");
+    if (lfd >= 0) {
+        mm_srv_run(srv, lfd);
+        close(lfd);
+    }
+    return NULL;
+}
+
+static void test_srv(   const int32_t *a_mat, const uint8_t *pk[],
+                        const uint8_t *sk[], const uint8_t seed_a[16],
+                        int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMKEM_CTI_SZ)],
+        flood[TEST_SRV_FLOOD * (MM_SRV_HDR_SZ + 8)],
+        rsp[MM_CTU_SZ + MMKEM_CTI_SZ + MMKEM_K_SZ];
+    uint8_t kk2[MM_N_MAX * MMKEM_K_SZ], k[MMKEM_K_SZ], h[MM_SRV_HDR_SZ], *p;
+    uint64_t ids[MM_N_MAX];
+    const char *fn = "/tmp/mm_srv_pkd.tmp";
+    struct timeval tv = { 5, 0 };
+    mm_srv_t srv;
+    mm_pkd_t d;
+    pthread_t th;
+    int i, j, fd[3], fail = 0;
+
+    for (i = 0; i < nn; i++) {
+        ids[i] = 7000 + 11 * i;
+    }
+    if (mm_pkd_build(fn, seed_a, ids, pk, nn, 0) != 0 ||
+        mm_pkd_map(&d, fn, 0) != 0) {
+        printf("[FAIL] srv pkdir\n");
+        return;
+    }
+    mm_srv_init(&srv, a_mat, &d);
+    srv.threads = 3;
+    srv.mem_max = 65536;
+    unlink("/tmp/mm_srv.sock");
+    pthread_create(&th, NULL, test_srv_run, &srv);
+    for (i = 0; i < 100 && access("/tmp/mm_srv.sock", F_OK) != 0; i++) {
+        usleep(1000);
+    }
+
+    for (j = 0; j < 3; j++) {
+        fd[j] = mm_cli_connect("/tmp/mm_srv.sock");
+        fail += fd[j] < 0 ||
+            setsockopt(fd[j], SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) != 0;
+    }
+    for (j = 0; j < 2 && fail == 0; j++) {
+
+        //  all recipients, then the last one alone
+        fail += mm_cli_encap(fd[j], ct2, kk2, ids + j * (nn - 1),
+                                j == 0 ? nn : 1) != MM_SRV_OK;
+        for (i = 0; i < (j == 0 ? nn : 1); i++) {
+            mm_decap(k, sk[i + j * (nn - 1)], ct2,
+                        ct2 + MM_CTU_SZ + i * MMKEM_CTI_SZ);
+            fail += memcmp(k, kk2 + i * MMKEM_K_SZ, MMKEM_K_SZ) != 0;
+        }
+        fail += mm_cli_decap(fd[j], k, sk[j * (nn - 1)], ct2,
+                                ct2 + MM_CTU_SZ) != MM_SRV_OK ||
+                memcmp(k, kk2, MMKEM_K_SZ) != 0;
+    }
+
+    //  the flood fills the socket and the memory limit; the service
+    //  answers others (EBUSY) and keeps the flood's input for later
+    for (i = 0, p = flood; i < TEST_SRV_FLOOD; i++) {
+        memcpy(p, MM_SRV_MAGIC, 4);
+        p[4] = MM_SRV_ENCAP;
+        memset(p + 5, 0, 3);
+        put32u_le(p + 8, 1);
+        put32u_le(p + 12, 8);
+        put64u_le(p + 16, i);
+        put64u_le(p + MM_SRV_HDR_SZ, ids[0]);
+        p += MM_SRV_HDR_SZ + 8;
+    }
+    if (fail == 0) {
+        fail += send(fd[2], flood, sizeof(flood), MSG_NOSIGNAL) !=
+                    (ssize_t) sizeof(flood);
+        usleep(100000);
+        fail += mm_cli_encap(fd[1], ct2, kk2, ids, nn) != MM_SRV_EBUSY;
+    }
+    for (i = 0; i < TEST_SRV_FLOOD && fail == 0; i++) {
+        fail += recv(fd[2], h, sizeof(h), MSG_WAITALL) != sizeof(h) ||
+                memcmp(h, MM_SRV_MAGIC, 4) != 0 || h[5] != MM_SRV_OK ||
+                get64u_le(h + 16) != (uint64_t) i ||
+                get32u_le(h + 12) != sizeof(rsp) ||
+                recv(fd[2], rsp, sizeof(rsp), MSG_WAITALL) != sizeof(rsp);
+    }
+    fail += mm_cli_encap(fd[1], ct2, kk2, ids, nn) != MM_SRV_OK;
+
+    ids[0] = 1;
+    fail += mm_cli_encap(fd[0], ct2, kk2, ids, 1) != MM_SRV_ENOKEY;
+
+    mm_cli_close(fd[0]);
+    mm_cli_close(fd[1]);
+    mm_cli_close(fd[2]);
+    srv.stop = 1;
+    pthread_join(th, NULL);
+    unlink("/tmp/mm_srv.sock");
+    mm_pkd_unmap(&d);
+    remove(fn);
+
+    if (fail || srv.reqs != 7 + TEST_SRV_FLOOD) {
+        printf("[FAIL] srv\n");
+    }
+}
+
+//  shared-memory queues: same ciphertext as mm_encap(), decap checked
+
+static void test_shq(   const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_e[32], const uint8_t *kk, int nn)
+{
+    const char *fn = "/tmp/mm_shq.tmp";
+    uint64_t o_ct, o_kk, o_sk, o_k;
+    mm_shq_pool_t *pool;
+    mm_shq_t q;
+    mm_shq_req_t r;
+    mm_shq_cpl_t c;
+    int i, fail = 0;
+
+    o_ct = nn * MM_PK_SZ;
+    o_kk = o_ct + MM_CTU_SZ + nn * MMKEM_CTI_SZ;
+    o_sk = o_kk + nn * MMKEM_K_SZ;
+    o_k  = o_sk + MM_SK_SZ;
+    if (mm_shq_create(&q, fn, 4, o_k + MMKEM_K_SZ) != 0) {
+        printf("[FAIL] shq create\n");
+        return;
+    }
+    for (i = 0; i < nn; i++) {
+        memcpy(q.data + i * MM_PK_SZ, pk[i], MM_PK_SZ);
+    }
+    memcpy(q.data + o_sk, sk[nn - 1], MM_SK_SZ);
+    pool = mm_shq_pool_start(a_mat, 2, 0, 10);
+    mm_shq_pool_add(pool, &q);
+
+    memset(&r, 0, sizeof(r));
+    r.tag = 1;
+    r.op = MM_SHQ_ENCAP;
+    r.n = nn;
+    r.in = 0;
+    r.out = o_ct;
+    r.key = o_kk;
+    memcpy(r.seed_e, seed_e, 32);
+    r.t_sub = plat_get_ns();
+    fail += mm_shq_submit(&q, &r) != 0;
+
+    r.tag = 2;
+    r.op = MM_SHQ_DECAP;
+    r.n = 1;
+    r.in = o_sk;
+    r.out = o_ct;
+    r.aux = o_ct + MM_CTU_SZ + (nn - 1) * MMKEM_CTI_SZ;
+    r.key = o_k;
+    fail += mm_shq_submit(&q, &r) != 0;
+
+    r.tag = 3;
+    r.key = q.data_sz;                  //  out of range
+    fail += mm_shq_submit(&q, &r) != 0;
+
+    for (i = 1; i <= 3; i++) {
+        mm_shq_wait(&q, &c, 0);
+        fail += c.tag != (uint64_t) i || c.st != (i == 3 ? MM_SHQ_EREQ :
+                MM_SHQ_OK) || c.t_done < c.t_start || c.t_start < c.t_sub;
+    }
+    fail += memcmp(q.data + o_ct, ct, MM_CTU_SZ + nn * MMKEM_CTI_SZ) != 0 ||
+            memcmp(q.data + o_kk, kk, nn * MMKEM_K_SZ) != 0 ||
+            memcmp(q.data + o_k, kk + (nn - 1) * MMKEM_K_SZ,
+                    MMKEM_K_SZ) != 0;
+
+    mm_shq_pool_stop(pool);
+    mm_shq_close(&q);
+    remove(fn);
+    if (fail) {
+        printf("[FAIL] shq\n");
+    }
+}
+#endif
+
+//  resumable jobs: item and time budgets give the one-call output
+
+static void test_step(  const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_k[32], const uint8_t seed_e[32],
+                        const uint8_t *mm, const uint8_t *kk, int nn)
+{
+    static mm_step_t st;
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)],
+        pkb[MM_N_MAX][MM_PK_SZ], skb[MM_N_MAX][MM_SK_SZ], seed[MM_N_MAX][32];
+#ifdef MM_KEM
+    static uint8_t kk2[MM_N_MAX * MMKEM_K_SZ];
+#endif
+    uint8_t *pko[MM_N_MAX], *sko[MM_N_MAX];
+    const uint8_t *sdp[MM_N_MAX];
+    size_t ct_sz;
+    int i, r, fail = 0;
+
+    for (r = 0; r < 3; r++) {
+        memset(ct2, 0, sizeof(ct2));
+#ifdef MM_KEM
+        (void) mm;
+        ct_sz = MM_CTU_SZ + nn * MMKEM_CTI_SZ;
+        mm_step_encap(&st, ct2, kk2, a_mat, pk, seed_e, nn);
+#else
+        (void) kk;
+        ct_sz = MM_CTU_SZ + nn * MMPKE_CTI_SZ;
+        mm_step_enc(&st, ct2, a_mat, pk, mm, seed_e, nn);
+#endif
+        //  2 recipients per call, 1 ns per call (one each), abort
+        while (mm_step_run(&st, r == 0 ? 2 : 0, r == 0 ? 0 : 1) ==
+                MM_STEP_MORE) {
+            if (r == 2 && st.prog.done == 1) {
+                mm_step_clear(&st);
+            }
+        }
+        if (r == 2) {
+            fail += st.prog.done != 1 || st.op != 0;
+            continue;
+        }
+        fail += st.prog.done != (uint64_t) nn ||
+                st.prog.steps != (uint64_t) (r == 0 ? (nn + 1) / 2 : nn) ||
+                st.prog.out_sz != ct_sz || memcmp(ct2, ct, ct_sz) != 0;
+#ifdef MM_KEM
+        fail += memcmp(kk2, kk, nn * MMKEM_K_SZ) != 0;
+#endif
+    }
+
+    //  key batch, one key per call; the item limit ends each call before
+    //  the time limit, and the key is still timed
+    for (i = 0; i < nn; i++) {
+        memcpy(seed[i], seed_k, 32);
+        put64u_le(seed[i], i);
+        sdp[i] = seed[i];
+        pko[i] = pkb[i];
+        sko[i] = skb[i];
+    }
+    mm_step_kgen(&st, pko, sko, a_mat, sdp, nn);
+    fail += mm_step_run(&st, 1, 1000000000) != MM_STEP_MORE ||
+            st.prog.ns == 0;
+    while (mm_step_run(&st, 1, 1000000000) == MM_STEP_MORE)
+        ;
+    fail += st.prog.steps != (uint64_t) nn ||
+            st.prog.out_sz != (size_t) nn * MM_PK_SZ;
+    for (i = 0; i < nn; i++) {
+        fail += memcmp(pkb[i], pk[i], MM_PK_SZ) != 0 ||
+                memcmp(skb[i], sk[i], MM_SK_SZ) != 0;
+    }
+
+    if (fail) {
+        printf("[FAIL] step\n");
+    }
+}
+
+//  work-stealing scheduler: same output as the plain calls
+
+static void test_sched( const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_k[32], const uint8_t seed_e[32],
+                        const uint8_t *mm, const uint8_t *kk, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)],
+        pkb[MM_N_MAX][MM_PK_SZ], skb[MM_N_MAX][MM_SK_SZ],
+        seed[MM_N_MAX][32], out[MM_N_MAX * MMPKE_M_SZ];
+#ifdef MM_KEM
+    static uint8_t kk2[MM_N_MAX * MMKEM_K_SZ];
+#endif
+    uint8_t *pko[MM_N_MAX], *sko[MM_N_MAX];
+    const uint8_t *sdp[MM_N_MAX], *cti[MM_N_MAX];
+    mm_sched_t *s;
+    mm_sched_stat_t st;
+    uint64_t tasks[2] = { 0, 0 };
+    size_t ct_sz;
+    int i, fail = 0;
+
+    s = mm_sched_start(3);
+    if (s == NULL) {
+        printf("[FAIL] sched start\n");
+        return;
+    }
+
+    for (i = 0; i < nn; i++) {
+        memcpy(seed[i], seed_k, 32);
+        put64u_le(seed[i], i);
+        sdp[i] = seed[i];
+        pko[i] = pkb[i];
+        sko[i] = skb[i];
+    }
+    mm_sched_kgen(s, pko, sko, a_mat, sdp, nn);
+    for (i = 0; i < nn; i++) {
+        fail += memcmp(pkb[i], pk[i], MM_PK_SZ) != 0 ||
+                memcmp(skb[i], sk[i], MM_SK_SZ) != 0;
+    }
+
+#ifdef MM_KEM
+    (void) mm;
+    ct_sz = mm_sched_encap(s, ct2, kk2, a_mat, pk, seed_e, nn);
+    fail += ct_sz != MM_CTU_SZ + (size_t) nn * MMKEM_CTI_SZ ||
+            memcmp(ct2, ct, ct_sz) != 0 ||
+            memcmp(kk2, kk, nn * MMKEM_K_SZ) != 0;
+    for (i = 0; i < nn; i++) {
+        cti[i] = ct + MM_CTU_SZ + i * MMKEM_CTI_SZ;
+    }
+    mm_sched_decap(s, out, sk, ct, cti, nn);
+    fail += memcmp(out, kk, nn * MMKEM_K_SZ) != 0;
+#else
+    (void) kk;
+    ct_sz = mm_sched_enc(s, ct2, a_mat, pk, mm, seed_e, nn);
+    fail += ct_sz != MM_CTU_SZ + (size_t) nn * MMPKE_CTI_SZ ||
+            memcmp(ct2, ct, ct_sz) != 0;
+    for (i = 0; i < nn; i++) {
+        cti[i] = ct + MM_CTU_SZ + i * MMPKE_CTI_SZ;
+    }
+    mm_sched_dec(s, out, sk, ct, cti, nn);
+    fail += memcmp(out, mm, nn * MMPKE_M_SZ) != 0;
+#endif
+
+    //  every task ran once: kgen and encap blocks, one per decap
+    for (i = 0; i < mm_sched_threads(s); i++) {
+        mm_sched_stat(s, i, &st);
+        tasks[MM_SCHED_HI] += st.tasks[MM_SCHED_HI];
+        tasks[MM_SCHED_LO] += st.tasks[MM_SCHED_LO];
+        fail += st.depth != 0;
+    }
+    fail += tasks[MM_SCHED_HI] != (uint64_t) nn ||
+            tasks[MM_SCHED_LO] != (uint64_t)
+                ((nn + MM_SCHED_KBLK - 1) / MM_SCHED_KBLK +
+                (nn + MM_SCHED_RBLK - 1) / MM_SCHED_RBLK);
+    mm_sched_stop(s);
+
+    if (fail) {
+        printf("[FAIL] sched\n");
+    }
+}
+
+//  sharded encapsulation over forked workers
+
+static void test_shard( const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t seed_a[16],
+                        const uint8_t seed_e[32], const uint8_t *mm,
+                        const uint8_t *kk, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)];
+#ifdef MM_KEM
+    static uint8_t kk2[MM_N_MAX * MMKEM_K_SZ];
+#endif
+    uint8_t key[MM_SHARD_KEY_SZ];
+    uint64_t ids[MM_N_MAX];
+    const char *fn = "/tmp/mm_shard.tmp";
+    mm_shard_t sh;
+    mm_pkd_t d;
+    uint64_t sid;
+    size_t ct_sz;
+    int i, r, fail = 0;
+
+    for (i = 0; i < nn; i++) {
+        ids[i] = 7000 + 5 * i;
+    }
+    if (mm_pkd_build(fn, seed_a, ids, pk, nn, 0) != 0 ||
+        mm_pkd_map(&d, fn, MM_PKD_POPULATE) != 0) {
+        printf("[FAIL] shard build/map\n");
+        return;
+    }
+    memset(key, 0x5A, sizeof(key));
+    if (mm_shard_spawn(&sh, 3, key, &d) != 0) {
+        printf("[FAIL] shard spawn\n");
+        mm_pkd_unmap(&d);
+        return;
+    }
+
+    //  ok, unknown id (links stay usable), ok, wrong session key, then
+    //  ok over respawned links: a new session, though seq restarts
+    sid = 0;
+    for (r = 0; r < 5; r++) {
+        ids[nn - 1] = r == 1 ? 1 : 7000 + 5 * (nn - 1);
+        if (r == 3) {
+            sid = sh.sid;
+            sh.sk[0] ^= 1;
+        }
+        if (r == 4) {
+            mm_shard_close(&sh);
+            if (mm_shard_spawn(&sh, 3, key, &d) != 0) {
+                fail++;
+                break;
+            }
+        }
+        memset(ct2, 0, sizeof(ct2));
+#ifdef MM_KEM
+        (void) mm;
+        ct_sz = mm_shard_encap(&sh, ct2, kk2, a_mat, ids, nn, seed_e);
+        if (r != 1 && r != 3) {
+            fail += ct_sz != MM_CTU_SZ + (size_t) nn * MMKEM_CTI_SZ ||
+                    memcmp(kk2, kk, nn * MMKEM_K_SZ) != 0;
+        }
+#else
+        (void) kk;
+        ct_sz = mm_shard_enc(&sh, ct2, a_mat, ids, mm, nn, seed_e);
+        if (r != 1 && r != 3) {
+            fail += ct_sz != MM_CTU_SZ + (size_t) nn * MMPKE_CTI_SZ;
+        }
+#endif
+        if (r != 1 && r != 3) {
+            fail += memcmp(ct2, ct, ct_sz) != 0;
+        } else {
+            fail += ct_sz != 0;
+        }
+    }
+    fail += sid == 0 || sh.sid == 0 || sh.sid == sid || sh.seq > 3;
+    mm_shard_close(&sh);
+    mm_pkd_unmap(&d);
+    remove(fn);
+
+    if (fail) {
+        printf("[FAIL] shard\n");
+    }
+}
+
+//  digests of the two-recipient mmKEM (ct || K) and mmPKE (ct) outputs of
+//  test_multi() per level, from the single-level builds of that level
+
+static const uint64_t test_multi_ref[3][2] = {
+    { 0x30184f96c7a90f26ull, 0xb5e59ccd5b08350eull },      //  128
+    { 0xce8e6c99351fd120ull, 0x507f197c3150f697ull },      //  192
+    { 0xd0c10c6569e00d52ull, 0xf2df27a88e0f7b39ull }       //  256
+};
+
+static uint64_t test_multi_dg(  const uint8_t *ct, size_t ct_sz,
+                                const uint8_t *k, size_t k_sz)
+{
+    sha3_t kec;
+    uint8_t h[8];
+
+    sha3_init(&kec, SHAKE128_RATE);
+    sha3_absorb(&kec, ct, ct_sz);
+    if (k_sz > 0) {
+        sha3_absorb(&kec, k, k_sz);
+    }
+    sha3_pad(&kec, SHAKE_PAD);
+    sha3_squeeze(&kec, h, 8);
+
+    return get64u_le(h);
+}
+
+//  multi-parameter library: this level's instance matches the build,
+//  every level round-trips and gives its single-level build's output
+
+static void test_multi( const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_a[16], const uint8_t seed_k[32],
+                        const uint8_t seed_e[32], const uint8_t *mm,
+                        const uint8_t *kk, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)],
+        kk2[MM_N_MAX * MMKEM_K_SZ], pk2[MM_PK_SZ], sk2[MM_SK_SZ];
+    uint8_t seed[32], *pkb, *skb, k[MMKEM_K_SZ], m[MMPKE_M_SZ];
+    const uint8_t *pkp[2];
+    const mm_ops_t *ops;
+    mm_ctx_t ctx;
+    uint64_t dg[2];
+    size_t ct_sz;
+    int i, l, fail = 0;
+
+    ops = mm_ops_get(MM_LEVEL);
+    if (ops == NULL || mm_ctx_init(&ctx, MM_LEVEL, seed_a) != 0) {
+        printf("[FAIL] multi init\n");
+        return;
+    }
+    fail += ops->m != MM_M || ops->n != MM_N || ops->du != MM_DU ||
+            ops->pk_sz != MM_PK_SZ || ops->sk_sz != MM_SK_SZ ||
+            ops->ctu_sz != MM_CTU_SZ ||
+            ops->a_sz != MM_M * MM_N * MM_D * sizeof(int32_t) ||
+            memcmp(ctx.a_mat, a_mat, ops->a_sz) != 0;
+
+    memcpy(seed, seed_k, 32);
+    for (i = 0; i < nn; i++) {
+        put64u_le(seed, i);
+        mm_ctx_kgen(&ctx, pk2, sk2, seed);
+        fail += memcmp(pk2, pk[i], MM_PK_SZ) != 0 ||
+                memcmp(sk2, sk[i], MM_SK_SZ) != 0;
+    }
+#ifdef MM_KEM
+    (void) mm;
+    ct_sz = mm_ctx_encap(&ctx, ct2, kk2, pk, seed_e, nn);
+    fail += memcmp(kk2, kk, nn * MMKEM_K_SZ) != 0;
+#else
+    (void) kk;
+    ct_sz = mm_ctx_enc(&ctx, ct2, pk, mm, seed_e, nn);
+#endif
+    fail += memcmp(ct2, ct, ct_sz) != 0;
+    mm_ctx_clear(&ctx);
+
+    //  this level's reference digests from the single-level functions
+    pkb = (uint8_t *) malloc(2 * MM_PK_SZ);
+    skb = (uint8_t *) malloc(2 * MM_SK_SZ);
+    for (i = 0; i < 2; i++) {
+        put64u_le(seed, i);
+        mm_kgen(pkb + i * MM_PK_SZ, skb + i * MM_SK_SZ, a_mat, seed);
+        pkp[i] = pkb + i * MM_PK_SZ;
+    }
+    ct_sz = mm_encap(ct2, kk2, a_mat, pkp, seed_e, 2);
+    dg[0] = test_multi_dg(ct2, ct_sz, kk2, 2 * MMKEM_K_SZ);
+    memset(kk2, 0x3C, 2 * MMPKE_M_SZ);
+    ct_sz = mm_enc(ct2, a_mat, pkp, kk2, seed_e, 2);
+    dg[1] = test_multi_dg(ct2, ct_sz, NULL, 0);
+    fail += dg[0] != test_multi_ref[(MM_LEVEL - 128) / 64][0] ||
+            dg[1] != test_multi_ref[(MM_LEVEL - 128) / 64][1];
+    free(pkb);
+    free(skb);
+
+    //  all levels: two recipients, both mmKEM and mmPKE; the outputs of
+    //  every instance are those of its single-level build
+    for (l = 128; l <= 256; l += 64) {
+        if (mm_ctx_init(&ctx, l, seed_a) != 0) {
+            fail++;
+            continue;
+        }
+        ops = ctx.ops;
+        pkb = (uint8_t *) malloc(2 * ops->pk_sz);
+        skb = (uint8_t *) malloc(2 * ops->sk_sz);
+        for (i = 0; i < 2; i++) {
+            put64u_le(seed, i);
+            mm_ctx_kgen(&ctx, pkb + i * ops->pk_sz, skb + i * ops->sk_sz,
+                        seed);
+            pkp[i] = pkb + i * ops->pk_sz;
+        }
+        ct_sz = mm_ctx_encap(&ctx, ct2, kk2, pkp, seed_e, 2);
+        fail += ct_sz != ops->ctu_sz + 2 * ops->kem_cti_sz;
+        fail += test_multi_dg(ct2, ct_sz, kk2, 2 * ops->k_sz) !=
+                test_multi_ref[(l - 128) / 64][0];
+        mm_ctx_decap(&ctx, k, skb + ops->sk_sz, ct2,
+                        ct2 + ops->ctu_sz + ops->kem_cti_sz);
+        fail += memcmp(k, kk2 + ops->k_sz, ops->k_sz) != 0;
+
+        memset(kk2, 0x3C, 2 * ops->m_sz);
+        ct_sz = mm_ctx_enc(&ctx, ct2, pkp, kk2, seed_e, 2);
+        fail += ct_sz != ops->ctu_sz + 2 * ops->pke_cti_sz;
+        fail += test_multi_dg(ct2, ct_sz, NULL, 0) !=
+                test_multi_ref[(l - 128) / 64][1];
+        mm_ctx_dec(&ctx, m, skb, ct2, ct2 + ops->ctu_sz);
+        fail += memcmp(m, kk2, ops->m_sz) != 0;
+
+        free(pkb);
+        free(skb);
+        mm_ctx_clear(&ctx);
+    }
+    fail += mm_ops_get(100) != NULL;
+
+    if (fail) {
+        printf("[FAIL] multi\n");
+    }
+}
+
+//  every kernel backend this CPU runs against "generic": the kernels on
+//  pseudorandom input, then a whole encapsulation
+
+static void test_kern(  const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t seed_e[32],
+                        const uint8_t *mm, const uint8_t *kk, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)];
+#ifdef MM_KEM
+    static uint8_t kk2[MM_N_MAX * MMKEM_K_SZ];
+#endif
+    const char *name[3] = { "generic", "avx2", "avx512" };
+    const int dx[3] = { MM_DU, MMPKE_DV, MM_LOGQ };
+    const mm_kern_t *kj[2], *sel;
+    uint64_t x, s1[2][25], s4[2][25][4];
+    int32_t u[MM_D], f[2][MM_D], h[2][MM_D], e[MM_D];
+    uint8_t b[2][MM_D * 4], kb[2][MMKEM_K_SZ], m[MMPKE_M_SZ];
+    size_t l[2], ct_sz;
+    int64_t z;
+    int32_t r[2];
+    int i, j, d, t, fail = 0;
+
+    sel = mm_kern;
+    kj[0] = mm_kern_get("generic");
+    if (kj[0] == NULL || sel == NULL) {
+        printf("[FAIL] kern generic\n");
+        return;
+    }
+
+    x = 1;
+    for (t = 0; t < 3; t++) {
+        kj[1] = mm_kern_get(name[t]);
+        if (kj[1] == NULL) {
+            continue;
+        }
+        for (i = 0; i < MM_D; i++) {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            u[i] = (int32_t) ((x >> 32) % MM_Q);
+        }
+        for (j = 0; j < 2; j++) {
+            for (i = 0; i < 25; i++) {
+                s1[j][i] = 0x0123456789abcdefull * (i + 1);
+                s4[j][i][0] = s1[j][i];
+                s4[j][i][1] = s1[j][i] ^ i;
+                s4[j][i][2] = s1[j][i] + t;
+                s4[j][i][3] = ~s1[j][i];
+            }
+            kj[j]->keccak_f1600(s1[j]);
+            kj[j]->keccak_f1600_x4(s4[j]);
+
+            memcpy(f[j], u, sizeof(u));
+            kj[j]->polyr_fntt(f[j]);
+            memcpy(h[j], u, sizeof(u));
+            kj[j]->polyr_ntt_mul_add(h[j], f[j], u);
+            kj[j]->polyr_intt(f[j]);
+        }
+        fail += memcmp(s1[0], s1[1], sizeof(s1[0])) != 0 ||
+                memcmp(s4[0], s4[1], sizeof(s4[0])) != 0 ||
+                memcmp(f[0], f[1], sizeof(f[0])) != 0 ||
+                memcmp(h[0], h[1], sizeof(h[0])) != 0;
+
+        for (d = 0; d < 3; d++) {
+            for (j = 0; j < 2; j++) {
+                l[j] = kj[j]->poly_compress(b[j], u, dx[d]);
+                kj[j]->poly_decompress(h[j], b[j], dx[d]);
+            }
+            fail += l[0] != l[1] || memcmp(b[0], b[1], l[0]) != 0 ||
+                    memcmp(h[0], h[1], sizeof(h[0])) != 0;
+            for (j = 0; j < 2; j++) {
+                l[j] = kj[j]->poly_serial(b[j], u, dx[d]);
+                kj[j]->poly_deserial(h[j], b[j], dx[d]);
+            }
+            fail += l[0] != l[1] || memcmp(b[0], b[1], l[0]) != 0 ||
+                    memcmp(h[0], h[1], sizeof(h[0])) != 0;
+        }
+
+        //  public key unpacking: in range, then q in the last coefficient,
+        //  then 2^MM_LOGQ - 1 in a pseudorandom one
+        for (d = 0; d < 3; d++) {
+            memcpy(h[0], u, sizeof(u));
+            if (d == 1) {
+                h[0][MM_D - 1] = MM_Q;
+            } else if (d == 2) {
+                h[0][(x >> 40) % MM_D] = (1 << MM_LOGQ) - 1;
+            }
+            kj[0]->poly_serial(b[0], h[0], MM_LOGQ);
+            for (j = 0; j < 2; j++) {
+                r[j] = kj[j]->poly_deserial_q(f[j], b[0]);
+            }
+            fail += r[0] != (d == 0 ? 0 : -1) || r[1] != r[0] ||
+                    memcmp(f[0], h[0], sizeof(f[0])) != 0 ||
+                    memcmp(f[1], h[0], sizeof(f[1])) != 0;
+        }
+
+        //  fused inverse NTT + output against the separate steps (generic):
+        //  u + e, u + e + message, key bits; |e| < q/2, sums up to +-4q
+        for (i = 0; i < MM_D; i++) {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            e[i] = (int32_t) ((x >> 32) % MM_Q) - MM_Q / 2;
+            u[i] = (int32_t) ((x >> 8) % (8 * MM_Q)) - 4 * MM_Q;
+            m[(i >> 3) % MMPKE_M_SZ] = x >> 56;
+        }
+        for (d = 0; d < 3; d++) {
+            memcpy(f[0], u, sizeof(u));
+            kj[0]->polyr_intt(f[0]);
+
+            //  first 8 sums: c * 2^dx + q/2 a multiple of q (ties)
+            z = (MM_Q + 1) / 2;
+            for (i = 0; i < (d == 2 ? MM_DU : dx[d]); i++) {
+                z = (z * ((MM_Q + 1) / 2)) % MM_Q;
+            }
+            for (i = 0; i < 8; i++) {
+                e[i] = (z - f[0][i] - (d == 1 && (m[0] >> i) & 1 ?
+                        (MM_Q + 1) / 2 : 0) + 2 * MM_Q) % MM_Q;
+                e[i] -= e[i] >= MM_Q / 2 ? MM_Q : 0;
+            }
+
+            polyr_add(f[0], f[0], e);
+            for (i = 0; d == 1 && i < MM_D; i++) {
+                f[0][i] += (-((m[i >> 3] >> (i & 7)) & 1)) & ((MM_Q + 1) / 2);
+            }
+            polyr_norm(f[0]);
+            if (d == 2) {
+                poly_gen_ct_k(b[0], kb[0], f[0]);
+                l[0] = MMKEM_CTI_SZ;
+            } else {
+                l[0] = kj[0]->poly_compress(b[0], f[0], dx[d]);
+            }
+            memcpy(f[1], u, sizeof(u));
+            l[1] = kj[1]->polyr_intt_ct(b[1], d == 2 ? kb[1] : NULL, f[1], e,
+                                        d == 1 ? m : NULL,
+                                        d == 2 ? MM_DU : dx[d]);
+            fail += l[0] != l[1] || memcmp(b[0], b[1], l[0]) != 0 ||
+                    (d == 2 && memcmp(kb[0], kb[1], MMKEM_K_SZ) != 0);
+        }
+
+        fail += mm_kern_set(name[t]) != 0 || mm_kern != kj[1];
+#ifdef MM_KEM
+        (void) mm;
+        ct_sz = mm_encap(ct2, kk2, a_mat, pk, seed_e, nn);
+        fail += memcmp(kk2, kk, nn * MMKEM_K_SZ) != 0;
+#else
+        (void) kk;
+        ct_sz = mm_enc(ct2, a_mat, pk, mm, seed_e, nn);
+#endif
+        fail += memcmp(ct2, ct, ct_sz) != 0;
+    }
+    fail += mm_kern_set(sel->name) != 0 || mm_kern_get("none") != NULL;
+
+    if (fail) {
+        printf("[FAIL] kern\n");
+    }
+}
+
+//  "fma" backend against "generic": the NTT-domain kernels agree mod q
+//  (the inverse NTT bit for bit), encap and decap give the reference
+
+static void test_fma(   const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_e[32], const uint8_t *mm,
+                        const uint8_t *kk, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)],
+        kk2[MM_N_MAX * MMKEM_K_SZ];
+    const mm_kern_t *kg, *kf, *sel = mm_kern;
+    int32_t u[MM_D], v[MM_D], f[2][MM_D], h[2][MM_D];
+    uint64_t x = 3;
+    size_t ct_sz;
+    int i, t, fail = 0;
+
+    kf = mm_kern_get("fma");
+    kg = mm_kern_get("generic");
+    if (kf == NULL || kg == NULL) {
+        return;
+    }
+
+    //  canonical, small, and +-8q inputs
+    for (t = 0; t < 3; t++) {
+        for (i = 0; i < MM_D; i++) {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            u[i] = t == 0 ? (int32_t) ((x >> 32) % MM_Q) :
+                   t == 1 ? (int32_t) ((x >> 32) % 17) - 8 :
+                            (int32_t) ((x >> 32) % (16 * MM_Q)) - 8 * MM_Q;
+            v[i] = (int32_t) ((x >> 8) % MM_Q);
+        }
+        memcpy(f[0], u, sizeof(u));
+        memcpy(f[1], u, sizeof(u));
+        kg->polyr_fntt(f[0]);
+        kf->polyr_fntt(f[1]);
+        for (i = 0; i < MM_D; i++) {
+            fail += (f[0][i] - f[1][i]) % MM_Q != 0 ||
+                    f[1][i] <= -5 * MM_Q || f[1][i] >= 5 * MM_Q;
+        }
+        memcpy(h[0], v, sizeof(v));
+        memcpy(h[1], v, sizeof(v));
+        kg->polyr_ntt_mul_add(h[0], f[0], v);
+        kf->polyr_ntt_mul_add(h[1], f[0], v);
+        for (i = 0; i < MM_D; i++) {
+            fail += ((int64_t) h[0][i] - h[1][i]) % MM_Q != 0;
+        }
+        memcpy(f[0], u, sizeof(u));
+        memcpy(f[1], u, sizeof(u));
+        kg->polyr_intt(f[0]);
+        kf->polyr_intt(f[1]);
+        fail += memcmp(f[0], f[1], sizeof(f[0])) != 0;
+    }
+
+    fail += mm_kern_set("fma") != 0;
+#ifdef MM_KEM
+    (void) mm;
+    ct_sz = mm_encap(ct2, kk2, a_mat, pk, seed_e, nn);
+    fail += memcmp(kk2, kk, nn * MMKEM_K_SZ) != 0;
+    for (i = 0; i < nn; i++) {
+        mm_decap(kk2, sk[i], ct, ct + MM_CTU_SZ + i * MMKEM_CTI_SZ);
+        fail += memcmp(kk2, kk + i * MMKEM_K_SZ, MMKEM_K_SZ) != 0;
+    }
+#else
+    (void) kk;
+    ct_sz = mm_enc(ct2, a_mat, pk, mm, seed_e, nn);
+    for (i = 0; i < nn; i++) {
+        mm_dec(kk2, sk[i], ct, ct + MM_CTU_SZ + i * MMPKE_CTI_SZ);
+        fail += memcmp(kk2, mm + i * MMPKE_M_SZ, MMPKE_M_SZ) != 0;
+    }
+#endif
+    fail += memcmp(ct2, ct, ct_sz) != 0;
+    mm_kern_set(sel->name);
+
+    if (fail) {
+        printf("[FAIL] fma\n");
+    }
+}
+
+//  calibrate into a profile file, reload it; both decapsulation paths
+//  and a tuned scheduler give the reference output
+
+static void test_tune(  const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_e[32], const uint8_t *mm,
+                        const uint8_t *kk, int nn)
+{
+    static uint8_t ct2[MM_CTU_SZ + (MM_N_MAX * MMPKE_CTI_SZ)],
+        kk2[MM_N_MAX * MMKEM_K_SZ];
+    const char *fn = "/tmp/mm_tune.tmp";
+    const char *kern0 = mm_kern->name;
+    mm_tune_t sav = mm_tune, t;
+    mm_sched_t *s;
+    FILE *f;
+    size_t ct_sz;
+    int i, p, dec0 = mm_dec_path, fail = 0;
+
+    unlink(fn);
+    fail += mm_tune_init(fn, 1) != 1 || mm_tune_init(fn, 1) != 0 ||
+            mm_tune_load(&t, fn) != 0 || memcmp(&t, &mm_tune, sizeof(t)) ||
+            strcmp(t.par, MM_PAR) != 0 || t.threads < 1 || t.rblk < 1 ||
+            mm_kern_get(t.kern) != mm_kern || mm_dec_path != t.dec_path;
+
+    //  wrong parameter set, unknown backend
+    f = fopen(fn, "w");
+    if (f != NULL) {
+        fprintf(f, "par mmKyber-XXX-000\nthreads 2\n");
+        fclose(f);
+    }
+    fail += mm_tune_load(&t, fn) == 0;
+    strcpy(t.kern, "none");
+    fail += mm_tune_apply(&t) != -1 || mm_kern_get(kern0) == NULL;
+    unlink(fn);
+
+    for (p = MM_DEC_PATH_NTT; p <= MM_DEC_PATH_SB; p++) {
+        t.dec_path = p;
+        t.threads = 2;
+        t.rblk = 2 + p;
+        mm_tune_apply(&t);
+        s = mm_sched_start(0);
+        if (s == NULL) {
+            fail++;
+            continue;
+        }
+        fail += mm_sched_threads(s) != 2;
+#ifdef MM_KEM
+        (void) mm;
+        ct_sz = mm_sched_encap(s, ct2, kk2, a_mat, pk, seed_e, nn);
+        fail += memcmp(kk2, kk, nn * MMKEM_K_SZ) != 0;
+        for (i = 0; i < nn; i++) {
+            mm_decap(kk2, sk[i], ct, ct + MM_CTU_SZ + i * MMKEM_CTI_SZ);
+            fail += memcmp(kk2, kk + i * MMKEM_K_SZ, MMKEM_K_SZ) != 0;
+        }
+#else
+        (void) kk;
+        ct_sz = mm_sched_enc(s, ct2, a_mat, pk, mm, seed_e, nn);
+        for (i = 0; i < nn; i++) {
+            mm_dec(kk2, sk[i], ct, ct + MM_CTU_SZ + i * MMPKE_CTI_SZ);
+            fail += memcmp(kk2, mm + i * MMPKE_M_SZ, MMPKE_M_SZ) != 0;
+        }
+#endif
+        fail += memcmp(ct2, ct, ct_sz) != 0;
+        mm_sched_stop(s);
+    }
+
+    mm_kern_set(kern0);
+    mm_tune = sav;
+    mm_dec_path = dec0;
+
+    if (fail) {
+        printf("[FAIL] tune\n");
+    }
+}
+
+//  batch of independent jobs (one short of two blocks, with 0 .. nn
+//  recipients): same output as one mm_encap() / mm_enc() per job
+
+#define TEST_MANY_J 7
+#define TEST_MANY_R 8
+
+static void test_many(  const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t seed_e[32],
+                        const uint8_t *mm, const uint8_t *kk, int nn)
+{
+    static uint8_t ct2[TEST_MANY_J][MM_CTU_SZ + TEST_MANY_R * MMPKE_CTI_SZ],
+        ct3[MM_CTU_SZ + TEST_MANY_R * MMPKE_CTI_SZ],
+        kk2[TEST_MANY_J][TEST_MANY_R * MMKEM_K_SZ], seed[TEST_MANY_J][32];
+#ifdef MM_KEM
+    static uint8_t kk3[TEST_MANY_R * MMKEM_K_SZ];
+#endif
+    mm_job_t job[TEST_MANY_J];
+    size_t ct_sz, sz;
+    int j, fail = 0;
+
+    if (nn > TEST_MANY_R) {
+        nn = TEST_MANY_R;
+    }
+    for (j = 0; j < TEST_MANY_J; j++) {
+        memcpy(seed[j], seed_e, 32);
+        seed[j][0] ^= j;
+        job[j].ct = ct2[j];
+        job[j].kk = kk2[j];
+        job[j].pk = pk;
+        job[j].mm = mm;
+        job[j].seed_e = seed[j];
+        job[j].n = (j + nn) % (nn + 1);
+    }
+
+#ifdef MM_KEM
+    ct_sz = mm_encap_many(a_mat, job, TEST_MANY_J);
+#else
+    ct_sz = mm_enc_many(a_mat, job, TEST_MANY_J);
+#endif
+
+    for (j = 0; j < TEST_MANY_J; j++) {
+#ifdef MM_KEM
+        sz = mm_encap(ct3, kk3, a_mat, pk, seed[j], job[j].n);
+        fail += memcmp(kk2[j], kk3, job[j].n * MMKEM_K_SZ) != 0;
+        fail += j == 0 && memcmp(kk3, kk, nn * MMKEM_K_SZ) != 0;
+#else
+        (void) kk;
+        sz = mm_enc(ct3, a_mat, pk, mm, seed[j], job[j].n);
+#endif
+        fail += memcmp(ct2[j], ct3, sz) != 0;
+        fail += j == 0 && memcmp(ct3, ct, sz) != 0;    //  reference run
+        ct_sz -= sz;
+    }
+    fail += ct_sz != 0;
+
+    if (fail) {
+        printf("[FAIL] many\n");
+    }
+}
+
+#ifdef MM_PKE
+
+//  multi-block messages: block 0 matches mm_kgen() / mm_enc()
+
+#define TEST_BLK_L 3
+#define TEST_BLK_N 8
+
+static void test_blocks(const uint8_t *ct, const int32_t *a_mat,
+                        const uint8_t *pk[], const uint8_t *sk[],
+                        const uint8_t seed_k[32], const uint8_t seed_e[32],
+                        const uint8_t *mm, int nn)
+{
+    static uint8_t pkl[TEST_BLK_N][TEST_BLK_L * MM_PK_SZ],
+        skl[TEST_BLK_N][TEST_BLK_L * MM_SK_SZ],
+        ct2[MM_CTU_SZ + TEST_BLK_N * TEST_BLK_L * MMPKE_CTI_SZ];
+    uint8_t ml[TEST_BLK_N * TEST_BLK_L * MMPKE_M_SZ];
+    uint8_t m2[TEST_BLK_L * MMPKE_M_SZ], seed[32];
+    const uint8_t *pkp[TEST_BLK_N];
+    size_t ct_sz;
+    int i, fail = 0;
+
+    if (nn > TEST_BLK_N) {
+        nn = TEST_BLK_N;
+    }
+    memcpy(seed, seed_k, 32);
+    for (i = 0; i < nn; i++) {
+        put64u_le(seed, i);
+        mm_kgen_l(pkl[i], skl[i], a_mat, seed, TEST_BLK_L);
+        fail += memcmp(pkl[i], pk[i], MM_PK_SZ) != 0 ||
+                memcmp(skl[i], sk[i], MM_SK_SZ) != 0;
+        pkp[i] = pkl[i];
+    }
+
+    //  one block is mm_enc()
+    ct_sz = mm_enc_l(ct2, a_mat, pkp, mm, seed_e, nn, 1);
+    fail += memcmp(ct2, ct, ct_sz) != 0;
+
+    //  L blocks: block 0 carries m_i, others distinct messages
+    for (i = 0; i < nn * TEST_BLK_L; i++) {
+        if (i % TEST_BLK_L == 0) {
+            memcpy(ml + i * MMPKE_M_SZ, mm + (i / TEST_BLK_L) * MMPKE_M_SZ,
+                    MMPKE_M_SZ);
+        } else {
+            memset(ml + i * MMPKE_M_SZ, i, MMPKE_M_SZ);
+        }
+    }
+    ct_sz = mm_enc_l(ct2, a_mat, pkp, ml, seed_e, nn, TEST_BLK_L);
+    fail += ct_sz != MM_CTU_SZ + (size_t) nn * TEST_BLK_L * MMPKE_CTI_SZ ||
+            memcmp(ct2, ct, MM_CTU_SZ) != 0;
+
+    for (i = 0; i < nn; i++) {
+        mm_dec_l(m2, skl[i], ct2,
+                    ct2 + MM_CTU_SZ + i * TEST_BLK_L * MMPKE_CTI_SZ,
+                    TEST_BLK_L);
+        fail += memcmp(m2, ml + i * TEST_BLK_L * MMPKE_M_SZ,
+                        sizeof(m2)) != 0 ||
+                memcmp(ct2 + MM_CTU_SZ + i * TEST_BLK_L * MMPKE_CTI_SZ,
+                        ct + MM_CTU_SZ + i * MMPKE_CTI_SZ,
+                        MMPKE_CTI_SZ) != 0;
+    }
+
+    if (fail) {
+        printf("[FAIL] blocks\n");
+    }
+}
+#endif
+
+#endif
+
 static double get_sec()
 {
     struct timeval tv;
@@ -66,6 +1588,59 @@ static double get_sec()
     return ((double) tv.tv_sec) + 1E-6*((double) tv.tv_usec);
 }
 
+#ifndef TESTVEC
+
+//  mm_encap_many() / mm_enc_many() of BENCH_MANY_J jobs of nn (small)
+//  recipients; cycles per job, to compare with the mmEncap() line
+
+#define BENCH_MANY_J 16
+#define BENCH_MANY_R 8
+
+static void bench_many( const int32_t *a_mat, const uint8_t *pk[],
+                        const uint8_t seed_e[32], const uint8_t *mm,
+                        int nn, int rep)
+{
+    static uint8_t ct[BENCH_MANY_J][MM_CTU_SZ + BENCH_MANY_R * MMPKE_CTI_SZ],
+        kk[BENCH_MANY_J][BENCH_MANY_R * MMKEM_K_SZ];
+    mm_job_t job[BENCH_MANY_J];
+    uint64_t cc;
+    double dd;
+    int j, iter;
+
+    if (nn > BENCH_MANY_R) {
+        return;
+    }
+    for (j = 0; j < BENCH_MANY_J; j++) {
+        job[j].ct = ct[j];
+        job[j].kk = kk[j];
+        job[j].pk = pk;
+        job[j].mm = mm;
+        job[j].seed_e = seed_e;
+        job[j].n = nn;
+    }
+    rep = (rep + BENCH_MANY_J - 1) / BENCH_MANY_J;
+
+    dd  = get_sec();
+    cc  = plat_get_cycle();
+    for (iter = 0; iter < rep; iter++) {
+#ifdef MM_KEM
+        mm_encap_many(a_mat, job, BENCH_MANY_J);
+#else
+        mm_enc_many(a_mat, job, BENCH_MANY_J);
+#endif
+    }
+    cc  = (plat_get_cycle() - cc) / (rep * BENCH_MANY_J);
+    dd  = (get_sec() - dd) / (rep * BENCH_MANY_J);
+
+    printf( "%16s  %16s  N= %4d  cyc= %9lu  sec= %8.6f\n",
+#ifdef MM_KEM
+            MM_PAR, "mmEncapMany()", nn, cc, dd);
+#else
+            MM_PAR, "mmEncMany()", nn, cc, dd);
+#endif
+}
+#endif
+
 int main()
 {
     //  for our "test vectors"
@@ -97,6 +1672,8 @@ int main()
     printf( "%16s  %16s  m= %d  n= %d  du= %d  dv= %d  sig0= %f  sig1= %f\n",
             MM_PAR, "parameters",
             MM_M, MM_N, MM_DU, MMPKE_DV, MM_SIGMA0, MM_SIGMA1);
+    printf( "%16s  %16s  %s\n", MM_PAR, "kernels", mm_kern->name);
+    printf( "%16s  %16s  %s\n", MM_PAR, "reduction", MM_RED_NAME);
 
 #ifdef  TESTVEC
     nn      =   5;
@@ -214,6 +1791,12 @@ int main()
 #ifdef TESTVEC
     dbg_sum(ct, MM_CTU_SZ, "ct_u");
     dbg_sum(ct, nn_ct_sz, "ct");
+#else
+#ifdef MM_KEM
+    bench_many(a_mat, (const uint8_t **) pk, seed_e, NULL, nn, rep);
+#else
+    bench_many(a_mat, (const uint8_t **) pk, seed_e, mm, nn, rep);
+#endif
 #endif
 
     dd  = get_sec();
@@ -265,6 +1848,63 @@ int main()
             MM_PAR, "mmDec()", nn, cc, dd);
 #endif
 
+#ifdef TESTVEC
+#ifdef MM_KEM
+    test_skcache(ct, kk, seed_k, nn);
+    test_pkx(ct, a_mat, (const uint8_t **) pk, seed_e, NULL, nn);
+    test_seed_a(ct, seed_a, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_k, seed_e, NULL, nn);
+    test_stream(ct, a_mat, (const uint8_t **) pk, seed_e, NULL, kk, nn);
+    test_session(ct, a_mat, (const uint8_t **) pk, seed_e, NULL, kk, nn);
+    test_bcast(ct, seed_a, nn);
+    test_pkdir(ct, a_mat, (const uint8_t **) pk, seed_a, seed_e, NULL, nn);
+    test_fanout(ct, nn);
+    test_dem(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_e, kk, nn);
+    test_srv(a_mat, (const uint8_t **) pk, (const uint8_t **) sk, seed_a, nn);
+    test_shq(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_e, kk, nn);
+    test_step(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_k, seed_e, NULL, kk, nn);
+    test_sched(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_k, seed_e, NULL, kk, nn);
+    test_shard(ct, a_mat, (const uint8_t **) pk, seed_a, seed_e, NULL, kk, nn);
+    test_multi(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_a, seed_k, seed_e, NULL, kk, nn);
+    test_kern(ct, a_mat, (const uint8_t **) pk, seed_e, NULL, kk, nn);
+    test_fma(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_e, NULL, kk, nn);
+    test_tune(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_e, NULL, kk, nn);
+    test_many(ct, a_mat, (const uint8_t **) pk, seed_e, NULL, kk, nn);
+#else
+    test_skcache(ct, mm, seed_k, nn);
+    test_pkx(ct, a_mat, (const uint8_t **) pk, seed_e, mm, nn);
+    test_seed_a(ct, seed_a, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_k, seed_e, mm, nn);
+    test_stream(ct, a_mat, (const uint8_t **) pk, seed_e, mm, NULL, nn);
+    test_session(ct, a_mat, (const uint8_t **) pk, seed_e, mm, NULL, nn);
+    test_bcast(ct, seed_a, nn);
+    test_pkdir(ct, a_mat, (const uint8_t **) pk, seed_a, seed_e, mm, nn);
+    test_fanout(ct, nn);
+    test_blocks(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_k, seed_e, mm, nn);
+    test_step(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_k, seed_e, mm, NULL, nn);
+    test_sched(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_k, seed_e, mm, NULL, nn);
+    test_shard(ct, a_mat, (const uint8_t **) pk, seed_a, seed_e, mm, NULL, nn);
+    test_multi(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_a, seed_k, seed_e, mm, NULL, nn);
+    test_kern(ct, a_mat, (const uint8_t **) pk, seed_e, mm, NULL, nn);
+    test_fma(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_e, mm, NULL, nn);
+    test_tune(ct, a_mat, (const uint8_t **) pk, (const uint8_t **) sk,
+                seed_e, mm, NULL, nn);
+    test_many(ct, a_mat, (const uint8_t **) pk, seed_e, mm, NULL, nn);
+#endif
+#endif
+
 #ifndef TESTVEC
     }   //  nn recipients loop
 #endif
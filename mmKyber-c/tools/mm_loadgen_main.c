@@ -0,0 +1,273 @@
+//  mm_loadgen_main.c
+//  === Localhost load generator for the batching mmKEM service.
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mm_srv.h"
+#include "mm_cli.h"
+#include "mmkyber.h"
+
+//  test setup
+
+typedef struct {
+    const char *path;               //  service socket
+    int reqs;                       //  requests per client
+    uint32_t n;                     //  recipients per request
+    uint64_t keys;                  //  recipient ids are 0 .. keys-1
+    const uint8_t *sk;              //  private keys (NULL: no checks)
+} lg_cfg_t;
+
+//  per client results
+
+typedef struct {
+    const lg_cfg_t *cfg;
+    int id;
+    uint64_t *lat;                  //  request latencies (ns)
+    int done, fail;
+} lg_cli_t;
+
+//  one client: "reqs" encapsulations, every recipient checked if sk known
+
+static void *lg_client(void *arg)
+{
+    lg_cli_t *c = (lg_cli_t *) arg;
+    const lg_cfg_t *cfg = c->cfg;
+    uint64_t *ids, x, t;
+    uint8_t *ct, *kk, k[MMKEM_K_SZ];
+    uint32_t i;
+    int fd, j;
+
+    ids = (uint64_t *) malloc(cfg->n * sizeof(uint64_t));
+    ct = (uint8_t *) malloc(MM_CTU_SZ + cfg->n * MMKEM_CTI_SZ);
+    kk = (uint8_t *) malloc(cfg->n * MMKEM_K_SZ);
+    fd = mm_cli_connect(cfg->path);
+    if (ids == NULL || ct == NULL || kk == NULL || fd < 0) {
+        c->fail++;
+        goto end;
+    }
+
+    x = 0x9E3779B97F4A7C15ull * (c->id + 1);
+    for (j = 0; j < cfg->reqs; j++) {
+        for (i = 0; i < cfg->n; i++) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            ids[i] = x % cfg->keys;
+        }
+        t = plat_get_ns();
+        if (mm_cli_encap(fd, ct, kk, ids, cfg->n) != MM_SRV_OK) {
+            c->fail++;
+            continue;
+        }
+        c->lat[c->done++] = plat_get_ns() - t;
+
+        if (cfg->sk == NULL) {
+            continue;
+        }
+        for (i = 0; i < cfg->n; i++) {
+            mm_decap(k, cfg->sk + ids[i] * MM_SK_SZ, ct,
+                        ct + MM_CTU_SZ + i * MMKEM_CTI_SZ);
+            c->fail += memcmp(k, kk + i * MMKEM_K_SZ, MMKEM_K_SZ) != 0;
+        }
+
+        //  now and then, the same on the service
+        if ((j & 15) == 0) {
+            c->fail += mm_cli_decap(fd, k, cfg->sk + ids[0] * MM_SK_SZ,
+                                    ct, ct + MM_CTU_SZ) != MM_SRV_OK ||
+                        memcmp(k, kk, MMKEM_K_SZ) != 0;
+        }
+    }
+
+end:
+    mm_cli_close(fd);
+    free(ids);
+    free(ct);
+    free(kk);
+
+    return NULL;
+}
+
+static void *lg_server(void *arg)
+{
+    mm_srv_t *srv = (mm_srv_t *) arg;
+    int lfd;
+
+    lfd = mm_srv_listen("/tmp/xloadgen.sock");
+    if (lfd >= 0) {
+        mm_srv_run(srv, lfd);
+        close(lfd);
+    }
+    return NULL;
+}
+
+static int lg_cmp(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+
+    return (x > y) - (x < y);
+}
+
+static int usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [-c clients] [-r requests] [-n recipients] [-k keys]\n"
+        "          [-t threads] [-b batch] [-w wait_us] [-s socket]\n"
+        "  Without -s, generates \"keys\" key pairs, starts the service in\n"
+        "  process on /tmp/xloadgen.sock and checks every K_i. With -s,\n"
+        "  drives a running xsrvd with ids 0 .. keys-1 (no checks).\n",
+        prog);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    static int32_t a_mat[MM_M * MM_N * MM_D];
+    const char *fn = "/tmp/xloadgen.pkd";
+    uint8_t seed_a[16] = "xloadgen seed_a", seed_k[32] = { 0 };
+    int i, nc = 8, threads = 0;
+    long v;
+    uint8_t *pkb = NULL, *skb = NULL;
+    const uint8_t **pk = NULL;
+    uint64_t j, *lat, nl, t;
+    lg_cfg_t cfg;
+    lg_cli_t *cli;
+    pthread_t *th, sth;
+    mm_srv_t srv;
+    mm_pkd_t d;
+    uint32_t batch = 0, wait = 0;
+    int fail = 0, local;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.path = NULL;
+    cfg.reqs = 1000;
+    cfg.n = 1;
+    cfg.keys = 256;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (i + 1 >= argc || strlen(argv[i]) != 2) {
+            return usage(argv[0]);
+        }
+        if (argv[i][1] == 's') {
+            cfg.path = argv[++i];
+            continue;
+        }
+        v = atol(argv[++i]);
+        if (v <= 0) {
+            return usage(argv[0]);
+        }
+        switch (argv[i - 1][1]) {
+            case 'c':   nc = (int) v;                   break;
+            case 'r':   cfg.reqs = (int) v;             break;
+            case 'n':   cfg.n = (uint32_t) v;           break;
+            case 'k':   cfg.keys = (uint64_t) v;        break;
+            case 't':   threads = (int) v;              break;
+            case 'b':   batch = (uint32_t) v;           break;
+            case 'w':   wait = (uint32_t) v;            break;
+            default:    return usage(argv[0]);
+        }
+    }
+    if (i != argc || cfg.n > MM_SRV_N_MAX) {
+        return usage(argv[0]);
+    }
+    local = cfg.path == NULL;
+
+    //  keys and in-process service
+    if (local) {
+        pkb = (uint8_t *) malloc(cfg.keys * MM_PK_SZ);
+        skb = (uint8_t *) malloc(cfg.keys * MM_SK_SZ);
+        pk = (const uint8_t **) malloc(cfg.keys * sizeof(uint8_t *));
+        if (pkb == NULL || skb == NULL || pk == NULL) {
+            return 1;
+        }
+        mm_setup(a_mat, seed_a);
+        for (j = 0; j < cfg.keys; j++) {
+            put64u_le(seed_k, j);
+            mm_kgen(pkb + j * MM_PK_SZ, skb + j * MM_SK_SZ, a_mat, seed_k);
+            pk[j] = pkb + j * MM_PK_SZ;
+        }
+        if (mm_pkd_build(fn, seed_a, NULL, pk, cfg.keys, 1) != 0 ||
+            mm_pkd_map(&d, fn, MM_PKD_POPULATE) != 0) {
+            fprintf(stderr, "%s: cannot build %s\n", argv[0], fn);
+            return 1;
+        }
+        cfg.sk = skb;
+        cfg.path = "/tmp/xloadgen.sock";
+
+        mm_srv_init(&srv, a_mat, &d);
+        if (threads > 0) {
+            srv.threads = threads;
+        }
+        if (batch > 0) {
+            srv.batch_max = batch;
+        }
+        if (wait > 0) {
+            srv.wait_us = wait;
+        }
+        pthread_create(&sth, NULL, lg_server, &srv);
+        for (i = 0; i < 100 && access(cfg.path, F_OK) != 0; i++) {
+            usleep(10000);
+        }
+    }
+
+    cli = (lg_cli_t *) calloc(nc, sizeof(lg_cli_t));
+    th = (pthread_t *) calloc(nc, sizeof(pthread_t));
+    lat = (uint64_t *) calloc((size_t) nc * cfg.reqs, sizeof(uint64_t));
+    if (cli == NULL || th == NULL || lat == NULL) {
+        return 1;
+    }
+
+    t = plat_get_ns();
+    for (i = 0; i < nc; i++) {
+        cli[i].cfg = &cfg;
+        cli[i].id = i;
+        cli[i].lat = lat + (size_t) i * cfg.reqs;
+        pthread_create(&th[i], NULL, lg_client, &cli[i]);
+    }
+    nl = 0;
+    for (i = 0; i < nc; i++) {
+        pthread_join(th[i], NULL);
+        fail += cli[i].fail;
+        memmove(lat + nl, cli[i].lat, cli[i].done * sizeof(uint64_t));
+        nl += cli[i].done;
+    }
+    t = plat_get_ns() - t;
+
+    qsort(lat, nl, sizeof(uint64_t), lg_cmp);
+    printf("%16s  clients= %d  req= %lu  n= %u  sec= %.3f  "
+            "req/s= %.0f  rcpt/s= %.0f\n",
+            MM_PAR, nc, (unsigned long) nl, cfg.n, 1E-9 * t,
+            1E9 * nl / t, 1E9 * nl * cfg.n / t);
+    if (nl > 0) {
+        printf("%16s  latency us: p50= %.1f  p99= %.1f  max= %.1f\n",
+                MM_PAR, 1E-3 * lat[nl / 2], 1E-3 * lat[nl * 99 / 100],
+                1E-3 * lat[nl - 1]);
+    }
+
+    if (local) {
+        srv.stop = 1;
+        pthread_join(sth, NULL);
+        unlink(cfg.path);
+        printf("%16s  batches= %lu  avg= %.1f  max= %lu recipients\n",
+                MM_PAR, (unsigned long) srv.batches,
+                srv.batches ? (double) srv.rcpt / srv.batches : 0.0,
+                (unsigned long) srv.rcpt_max);
+        mm_pkd_unmap(&d);
+        remove(fn);
+        memset(skb, 0, cfg.keys * MM_SK_SZ);
+        free(skb);
+        free(pkb);
+        free(pk);
+    }
+    if (fail) {
+        printf("[FAIL] %d failed requests or keys\n", fail);
+    }
+    free(cli);
+    free(th);
+    free(lat);
+
+    return fail != 0;
+}
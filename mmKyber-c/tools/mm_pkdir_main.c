@@ -0,0 +1,117 @@
+//  mm_pkdir_main.c
+//  === Build a public key directory (mm_pkdir.h) from raw key files.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mm_pkdir.h"
+
+//  map a whole input file read-only
+
+static const uint8_t *map_file(const char *fn, size_t *sz)
+{
+    int fd;
+    struct stat st;
+    void *p;
+
+    fd = open(fn, O_RDONLY);
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return NULL;
+    }
+    p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return NULL;
+    }
+    *sz = st.st_size;
+    return (const uint8_t *) p;
+}
+
+static int usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [-x] [-d <seed_a hex>] <out.pkd> <keys.bin> [<ids.bin>]\n"
+        "  keys.bin   N concatenated %s public keys (%d bytes each)\n"
+        "  ids.bin    N 64-bit little-endian recipient ids (for the index)\n"
+        "  -x         store keys in expanded (pre-unpacked) form\n"
+        "  -d         16-byte seed domain as 32 hex digits\n",
+        prog, MM_PAR, MM_PK_SZ);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    int i, expand = 0;
+    uint8_t dom[16] = { 0 };
+    const uint8_t *keys, *idb = NULL, **pk;
+    uint64_t *ids = NULL;
+    size_t j, n, keys_sz, ids_sz = 0;
+    unsigned x;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (strcmp(argv[i], "-x") == 0) {
+            expand = 1;
+        } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc &&
+                    strlen(argv[i + 1]) == 32) {
+            i++;
+            for (j = 0; j < 16; j++) {
+                if (sscanf(argv[i] + 2 * j, "%2x", &x) != 1) {
+                    return usage(argv[0]);
+                }
+                dom[j] = x;
+            }
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (argc - i < 2 || argc - i > 3) {
+        return usage(argv[0]);
+    }
+
+    keys = map_file(argv[i + 1], &keys_sz);
+    if (keys == NULL || keys_sz % MM_PK_SZ != 0) {
+        fprintf(stderr, "%s: bad key file %s\n", argv[0], argv[i + 1]);
+        return 1;
+    }
+    n = keys_sz / MM_PK_SZ;
+
+    if (argc - i == 3) {
+        idb = map_file(argv[i + 2], &ids_sz);
+        if (idb == NULL || ids_sz != 8 * n) {
+            fprintf(stderr, "%s: bad id file %s\n", argv[0], argv[i + 2]);
+            return 1;
+        }
+        ids = (uint64_t *) malloc(n * sizeof(uint64_t));
+    }
+    pk = (const uint8_t **) malloc(n * sizeof(uint8_t *));
+    if (pk == NULL || (idb != NULL && ids == NULL)) {
+        return 1;
+    }
+    for (j = 0; j < n; j++) {
+        pk[j] = keys + j * MM_PK_SZ;
+        if (ids != NULL) {
+            ids[j] = get64u_le(idb + 8 * j);
+        }
+    }
+
+    if (mm_pkd_build(argv[i], dom, ids, pk, n, expand) != 0) {
+        fprintf(stderr, "%s: failed to build %s (invalid key?)\n",
+                argv[0], argv[i]);
+        return 1;
+    }
+    printf("%s: %zu keys%s%s\n", argv[i], n,
+            expand ? ", expanded" : "", ids != NULL ? ", indexed" : "");
+
+    free(pk);
+    free(ids);
+
+    return 0;
+}
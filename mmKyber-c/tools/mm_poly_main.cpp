@@ -0,0 +1,102 @@
+//  mm_poly_main.cpp
+//  === mm_poly.hpp against mmkyber.c: same bytes on every backend, timings.
+
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include "mmkyber.h"
+}
+#include "mm_poly.hpp"
+
+//  calls per measurement
+#ifndef MM_POLY_REP
+#define MM_POLY_REP 200
+#endif
+
+//  minimum cycles per call of "fn" over 5 runs
+
+#define PT_TIME(cc, fn) {                               \
+    uint64_t t_;                                        \
+    cc = UINT64_MAX;                                    \
+    for (int r_ = 0; r_ < 5; r_++) {                    \
+        t_ = plat_get_cycle();                          \
+        for (int i_ = 0; i_ < MM_POLY_REP; i_++) {      \
+            fn;                                         \
+        }                                               \
+        t_ = (plat_get_cycle() - t_) / MM_POLY_REP;     \
+        if (t_ < cc) {                                  \
+            cc = t_;                                    \
+        }                                               \
+    }                                                   \
+}
+
+static void pt_print(const char *fn, const char *kern, uint64_t c, uint64_t x)
+{
+    printf("%16s  %-6s %-8s C cyc= %9lu  C++ cyc= %9lu\n", MM_PAR, fn, kern,
+            (unsigned long) c, (unsigned long) x);
+}
+
+int main()
+{
+    const char *name[4] = { "generic", "avx2", "avx512", "fma" };
+    const mm_kern_t *sel = mm_kern;
+    static int32_t a_mat[MM_M * MM_N * MM_D], r_u[MM_N][MM_D];
+    static uint8_t pk[2][MM_PK_SZ], sk[2][MM_SK_SZ],
+                    ct[2][MM_CTU_SZ + MM_CTI_SZ];
+#ifdef MM_KEM
+    static uint8_t kk[2][MMKEM_K_SZ];
+#endif
+    uint8_t seed_a[16] = "mm_poly seed A.", seed_k[32] = { 0 },
+            seed_e[32] = { 0 }, mm[MMPKE_M_SZ] = { 0 };
+    const uint8_t *pkp[1] = { pk[0] };
+    uint64_t c, x;
+    int fail;
+
+    mm_setup(a_mat, seed_a);
+    for (int j = 0; j < 4; j++) {
+        if (mm_kern_set(name[j]) != 0) {
+            continue;
+        }
+
+        fail = 0;
+        for (int t = 0; t < 8; t++) {
+            seed_k[0] = t;
+            seed_e[0] = t;
+
+            mm_kgen(pk[0], sk[0], a_mat, seed_k);
+            mm::kgen(pk[1], sk[1], a_mat, seed_k);
+            fail += memcmp(pk[0], pk[1], MM_PK_SZ) != 0;
+            fail += memcmp(sk[0], sk[1], MM_SK_SZ) != 0;
+
+#ifdef MM_KEM
+            (void) mm;
+            mm_encap(ct[0], kk[0], a_mat, pkp, seed_e, 1);
+#else
+            mm_enc(ct[0], a_mat, pkp, mm, seed_e, 1);
+#endif
+            mm::enc_u(ct[1], r_u, a_mat, seed_e);
+            fail += memcmp(ct[0], ct[1], MM_CTU_SZ) != 0;
+
+#ifdef MM_KEM
+            mm::decap(kk[1], sk[0], ct[0], ct[0] + MM_CTU_SZ);
+            fail += memcmp(kk[0], kk[1], MMKEM_K_SZ) != 0;
+#endif
+        }
+        if (fail) {
+            printf("[FAIL] poly %s\n", name[j]);
+        }
+
+        PT_TIME(c, mm_kgen(pk[0], sk[0], a_mat, seed_k));
+        PT_TIME(x, mm::kgen(pk[1], sk[1], a_mat, seed_k));
+        pt_print("kgen", name[j], c, x);
+#ifdef MM_KEM
+        PT_TIME(c, mm_decap(kk[0], sk[0], ct[0], ct[0] + MM_CTU_SZ));
+        PT_TIME(x, mm::decap(kk[1], sk[0], ct[0], ct[0] + MM_CTU_SZ));
+        pt_print("decap", name[j], c, x);
+#endif
+    }
+    mm_kern_set(sel->name);
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+//  mm_redbench_main.c
+//  === Reduction (mm_ring.h) timings, scalar and per kernel backend.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "mm_ring.h"
+#include "mm_kern.h"
+
+//  calls per measurement
+#ifndef MM_REDB_REP
+#define MM_REDB_REP 20000
+#endif
+
+//  minimum cycles per call of "fn" over 5 runs of "rep" calls
+
+#define RB_TIME(cc, rep, fn) {                          \
+    uint64_t t_;                                        \
+    int r_, i_;                                         \
+    cc = UINT64_MAX;                                    \
+    for (r_ = 0; r_ < 5; r_++) {                        \
+        t_ = plat_get_cycle();                          \
+        for (i_ = 0; i_ < (rep); i_++) {                \
+            fn;                                         \
+        }                                               \
+        t_ = (plat_get_cycle() - t_) / (rep);           \
+        if (t_ < cc) {                                  \
+            cc = t_;                                    \
+        }                                               \
+    }                                                   \
+}
+
+static void rb_print(const char *fn, const char *kern, uint64_t cc)
+{
+    printf("%-5s %-12s %-8s cyc= %9lu\n", MM_RED_NAME, fn, kern,
+            (unsigned long) cc);
+}
+
+//  dependent chain of MM_D multiplications (latency)
+
+static int32_t rb_mulq_chain(int32_t x, int32_t c)
+{
+    int i;
+
+    for (i = 0; i < MM_D; i++) {
+        x = mont_mulq(x, c);
+    }
+    return x;
+}
+
+int main()
+{
+    const char *name[4] = { "generic", "avx2", "avx512", "fma" };
+    const mm_kern_t *k;
+    int32_t f[MM_D], g[MM_D], h[MM_D], x = 1;
+    uint64_t cc, s = 1;
+    int i, j;
+
+    for (i = 0; i < MM_D; i++) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        f[i] = (int32_t) ((s >> 32) % MM_Q);
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        g[i] = (int32_t) ((s >> 32) % MM_Q);
+        h[i] = 0;
+    }
+
+    //  scalar code, base flags
+    RB_TIME(cc, MM_REDB_REP, x = rb_mulq_chain(x, f[7]));
+    rb_print("mulq_chain", "scalar", cc);
+    RB_TIME(cc, MM_REDB_REP, polyr_scale(h, g[3], h));
+    rb_print("scale", "scalar", cc);
+    RB_TIME(cc, MM_REDB_REP, polyr_add(h, h, f); polyr_norm(h));
+    rb_print("add_norm", "scalar", cc);
+
+    //  kernels of each backend
+    for (j = 0; j < 4; j++) {
+        k = mm_kern_get(name[j]);
+        if (k == NULL) {
+            continue;
+        }
+        RB_TIME(cc, MM_REDB_REP, k->polyr_ntt_mul_add(h, f, g);
+                                polyr_norm(h));
+        rb_print("mul_add", name[j], cc);
+        RB_TIME(cc, MM_REDB_REP, k->polyr_fntt(h); polyr_norm(h));
+        rb_print("fntt", name[j], cc);
+        RB_TIME(cc, MM_REDB_REP, k->polyr_intt(h));
+        rb_print("intt", name[j], cc);
+    }
+
+    //  keep the results live
+    for (i = 0; i < MM_D; i++) {
+        x ^= h[i];
+    }
+    return x == 0x7FFFFFFF;
+}
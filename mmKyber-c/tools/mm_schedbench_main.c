@@ -0,0 +1,209 @@
+//  mm_schedbench_main.c
+//  === Decapsulation latency under bulk encap / kgen load (mm_sched.h).
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mm_sched.h"
+#include "mmkyber.h"
+
+//  test setup
+
+typedef struct {
+    mm_sched_t *s;
+    const int32_t *a_mat;
+    const uint8_t **pk;
+    size_t n;                       //  recipients per encapsulation
+    volatile int stop;
+    uint64_t jobs;
+} sb_load_t;
+
+//  background load: encapsulations to "n" recipients until stopped
+
+static void *sb_load(void *arg)
+{
+    sb_load_t *l = (sb_load_t *) arg;
+    uint8_t *ct, *kk, seed_e[32] = { 0 };
+
+    ct = (uint8_t *) malloc(MM_CTU_SZ + l->n * MMKEM_CTI_SZ);
+    kk = (uint8_t *) malloc(l->n * MMKEM_K_SZ);
+    if (ct == NULL || kk == NULL) {
+        l->stop = 1;
+    }
+    while (!l->stop) {
+        put64u_le(seed_e, l->jobs++);
+        mm_sched_encap(l->s, ct, kk, l->a_mat, l->pk, seed_e, l->n);
+    }
+    free(ct);
+    free(kk);
+
+    return NULL;
+}
+
+static int sb_cmp(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+
+    return (x > y) - (x < y);
+}
+
+//  "reqs" single decapsulations; latencies sorted into "lat"
+
+static int sb_decaps(   mm_sched_t *s, uint64_t *lat, int reqs,
+                        const uint8_t *sk, const uint8_t *ct,
+                        const uint8_t *kk)
+{
+    const uint8_t *skp[1] = { sk }, *cti[1] = { ct + MM_CTU_SZ };
+    uint8_t k[MMKEM_K_SZ];
+    uint64_t t;
+    int j, fail = 0;
+
+    for (j = 0; j < reqs; j++) {
+        t = plat_get_ns();
+        mm_sched_decap(s, k, skp, ct, cti, 1);
+        lat[j] = plat_get_ns() - t;
+        fail += memcmp(k, kk, MMKEM_K_SZ) != 0;
+    }
+    qsort(lat, reqs, sizeof(uint64_t), sb_cmp);
+
+    return fail;
+}
+
+static int usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [-t threads] [-n recipients] [-k keys] [-r decaps]\n"
+        "  Enrolls \"keys\" key pairs, then measures single decapsulations\n"
+        "  on an idle scheduler and under back-to-back encapsulations to\n"
+        "  \"recipients\" (default: 4 threads, 4096, 4096, 2000).\n",
+        prog);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    static int32_t a_mat[MM_M * MM_N * MM_D];
+    uint8_t seed_a[16] = "xschedbench seed";
+    uint8_t seed_e[32] = { 0 };
+    int i, nt = 4, reqs = 2000, fail = 0;
+    size_t j, keys = 4096;
+    long v;
+    uint8_t *pkb, *skb, *sd, **pko, **sko, *ct, *kk;
+    const uint8_t **pk, **sdp;
+    uint64_t *lat, t;
+    mm_sched_t *s;
+    mm_sched_stat_t st;
+    pthread_t th;
+    sb_load_t ld;
+    const char *cond[2] = { "idle", "loaded" };
+
+    memset(&ld, 0, sizeof(ld));
+    ld.n = 4096;
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (i + 1 >= argc || strlen(argv[i]) != 2) {
+            return usage(argv[0]);
+        }
+        v = atol(argv[++i]);
+        if (v <= 0) {
+            return usage(argv[0]);
+        }
+        switch (argv[i - 1][1]) {
+            case 't':   nt = (int) v;           break;
+            case 'n':   ld.n = (size_t) v;      break;
+            case 'k':   keys = (size_t) v;      break;
+            case 'r':   reqs = (int) v;         break;
+            default:    return usage(argv[0]);
+        }
+    }
+    if (i != argc) {
+        return usage(argv[0]);
+    }
+
+    pkb = (uint8_t *) malloc(keys * MM_PK_SZ);
+    skb = (uint8_t *) malloc(keys * MM_SK_SZ);
+    sd = (uint8_t *) calloc(keys, 32);
+    pko = (uint8_t **) malloc(keys * sizeof(uint8_t *));
+    sko = (uint8_t **) malloc(keys * sizeof(uint8_t *));
+    pk = (const uint8_t **) malloc(ld.n * sizeof(uint8_t *));
+    sdp = (const uint8_t **) malloc(keys * sizeof(uint8_t *));
+    ct = (uint8_t *) malloc(MM_CTU_SZ + MMKEM_CTI_SZ);
+    kk = (uint8_t *) malloc(MMKEM_K_SZ);
+    lat = (uint64_t *) malloc(reqs * sizeof(uint64_t));
+    s = mm_sched_start(nt);
+    if (pkb == NULL || skb == NULL || sd == NULL || pko == NULL ||
+        sko == NULL || pk == NULL || sdp == NULL || ct == NULL ||
+        kk == NULL || lat == NULL || s == NULL) {
+        return 1;
+    }
+    mm_setup(a_mat, seed_a);
+
+    //  bulk enrollment
+    for (j = 0; j < keys; j++) {
+        put64u_le(sd + 32 * j, j);
+        sdp[j] = sd + 32 * j;
+        pko[j] = pkb + j * MM_PK_SZ;
+        sko[j] = skb + j * MM_SK_SZ;
+    }
+    t = plat_get_ns();
+    mm_sched_kgen(s, pko, sko, a_mat, sdp, keys);
+    t = plat_get_ns() - t;
+    printf("%16s  %16s  keys= %zu  threads= %d  keys/s= %.0f\n",
+            MM_PAR, "kgen", keys, nt, 1E9 * keys / t);
+
+    //  recipients cycle through the keys; decap target is key 0
+    for (j = 0; j < ld.n; j++) {
+        pk[j] = pko[j % keys];
+    }
+    mm_encap(ct, kk, a_mat, pk, seed_e, 1);
+
+    ld.s = s;
+    ld.a_mat = a_mat;
+    ld.pk = pk;
+    for (i = 0; i < 2; i++) {
+        if (i == 1) {
+            pthread_create(&th, NULL, sb_load, &ld);
+            while (ld.jobs == 0 && !ld.stop) {
+                sched_yield();
+            }
+        }
+        fail += sb_decaps(s, lat, reqs, skb, ct, kk);
+        printf("%16s  %16s  decap us: p50= %.1f  p99= %.1f  max= %.1f\n",
+                MM_PAR, cond[i], 1E-3 * lat[reqs / 2],
+                1E-3 * lat[reqs * 99 / 100], 1E-3 * lat[reqs - 1]);
+    }
+    ld.stop = 1;
+    pthread_join(th, NULL);
+    printf("%16s  %16s  encaps= %lu  N= %zu\n",
+            MM_PAR, "loaded", (unsigned long) ld.jobs, ld.n);
+
+    for (i = 0; i < mm_sched_threads(s); i++) {
+        mm_sched_stat(s, i, &st);
+        printf("%16s  worker %2d  hi= %7lu  lo= %7lu  steals= %7lu  "
+                "depth_max= %5lu  busy= %6.3f s  idle= %6.3f s\n",
+                MM_PAR, i, (unsigned long) st.tasks[MM_SCHED_HI],
+                (unsigned long) st.tasks[MM_SCHED_LO],
+                (unsigned long) st.steals, (unsigned long) st.depth_max,
+                1E-9 * st.busy_ns, 1E-9 * st.idle_ns);
+    }
+    mm_sched_stop(s);
+
+    if (fail) {
+        printf("[FAIL] %d decapsulations\n", fail);
+    }
+    memset(skb, 0, keys * MM_SK_SZ);
+    free(pkb);
+    free(skb);
+    free(sd);
+    free(pko);
+    free(sko);
+    free(pk);
+    free(sdp);
+    free(ct);
+    free(kk);
+    free(lat);
+
+    return fail != 0;
+}
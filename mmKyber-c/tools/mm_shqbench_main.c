@@ -0,0 +1,317 @@
+//  mm_shqbench_main.c
+//  === Shared-memory queues (mm_shq.h) vs. direct calls, client processes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "mm_shq.h"
+#include "mmkyber.h"
+
+//  per client result, at the end of its data area
+
+typedef struct {
+    uint64_t ops[2];                //  encap, decap completions
+    uint64_t rt[2];                 //  round trip sum
+    uint64_t wait[2];               //  t_start - t_sub sum
+    uint64_t svc[2];                //  t_done - t_start sum
+    uint64_t max[2];                //  max round trip
+    uint64_t t;                     //  wall time
+    uint64_t fail;
+} bench_res_t;
+
+//  data area layout of one buffer set
+
+typedef struct {
+    uint64_t pk, ct, kk, sk, k, sz;
+} bench_buf_t;
+
+static void bench_layout(bench_buf_t *b, uint32_t n)
+{
+    b->pk = 0;
+    b->ct = b->pk + n * MM_PK_SZ;
+    b->kk = b->ct + MM_CTU_SZ + n * MMKEM_CTI_SZ;
+    b->sk = b->kk + n * MMKEM_K_SZ;
+    b->k  = b->sk + MM_SK_SZ;
+    b->sz = (b->k + MMKEM_K_SZ + 63) & ~63ull;
+}
+
+//  client process: "reqs" encapsulations, every 4th followed by a decap
+
+static int bench_client(const char *fn, int reqs, uint32_t n,
+                        int depth, int busy)
+{
+    mm_shq_t q;
+    mm_shq_req_t r;
+    mm_shq_cpl_t c;
+    bench_buf_t b;
+    bench_res_t *res;
+    uint64_t t, rt, base, used;
+    int j, sent, x, fl, u;
+
+    if (mm_shq_open(&q, fn) != 0) {
+        return 1;
+    }
+    bench_layout(&b, n);
+    res = (bench_res_t *) (q.data + depth * b.sz);
+    memset(res, 0, sizeof(bench_res_t));
+    memset(&r, 0, sizeof(r));
+
+    t = plat_get_ns();
+    sent = 0;
+    fl = 0;
+    used = 0;
+    for (j = 0; j < reqs || fl > 0; ) {
+
+        //  keep "depth" buffer sets busy; tag = set << 32 | request
+        while (sent < reqs && fl < depth) {
+            u = 0;
+            while ((used >> u) & 1) {
+                u++;
+            }
+            base = u * b.sz;
+            r.tag = ((uint64_t) u << 32) | sent;
+            r.op = MM_SHQ_ENCAP;
+            r.n = n;
+            r.in = base + b.pk;
+            r.out = base + b.ct;
+            r.key = base + b.kk;
+            put64u_le(r.seed_e, sent);
+            r.t_sub = plat_get_ns();
+            if (mm_shq_submit(&q, &r) != 0) {
+                break;
+            }
+            used |= 1ull << u;
+            sent++;
+            fl++;
+        }
+
+        mm_shq_wait(&q, &c, busy);
+        x = c.tag >> 63;
+        rt = plat_get_ns() - c.t_sub;
+        res->ops[x]++;
+        res->rt[x] += rt;
+        res->wait[x] += c.t_start - c.t_sub;
+        res->svc[x] += c.t_done - c.t_start;
+        res->max[x] = rt > res->max[x] ? rt : res->max[x];
+        res->fail += c.st != MM_SHQ_OK;
+
+        u = (c.tag >> 32) & 0x7F;
+        base = u * b.sz;
+        if (x == 1) {
+            //  decap of recipient 0 matches K_0
+            res->fail += memcmp(q.data + base + b.k, q.data + base + b.kk,
+                                MMKEM_K_SZ) != 0;
+            used &= ~(1ull << u);
+            fl--;
+            continue;
+        }
+        j++;
+        if ((c.tag & 3) != 0) {
+            used &= ~(1ull << u);
+            fl--;
+            continue;
+        }
+        r.tag = c.tag | (1ull << 63);
+        r.op = MM_SHQ_DECAP;
+        r.n = 1;
+        r.in = base + b.sk;
+        r.out = base + b.ct;
+        r.aux = base + b.ct + MM_CTU_SZ;
+        r.key = base + b.k;
+        r.t_sub = plat_get_ns();
+        while (mm_shq_submit(&q, &r) != 0) {
+            mm_shq_wait(&q, &c, busy);      //  not expected: depth < slots
+        }
+    }
+    res->t = plat_get_ns() - t;
+    mm_shq_close(&q);
+
+    return 0;
+}
+
+static int usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [-c clients] [-r requests] [-n recipients] [-d depth]\n"
+        "          [-t workers] [-b] [-p dir]\n"
+        "  -c   client processes (default 4)\n"
+        "  -d   encapsulations in flight per client (default 1)\n"
+        "  -t   worker threads (default: clients)\n"
+        "  -b   busy-poll in workers and clients\n"
+        "  -p   directory for the region files (default /dev/shm)\n",
+        prog);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    static int32_t a_mat[MM_M * MM_N * MM_D];
+    uint8_t seed_a[16] = "xshqbench seed_a", seed_k[32] = { 0 };
+    uint8_t seed_e[32] = { 0 };
+    const char *dir = "/dev/shm";
+    char fn[MM_SHQ_THR_MAX][256];
+    int nc = 4, reqs = 10000, depth = 1, nt = 0, busy = 0;
+    uint32_t i, n = 1;
+    int c, d, st, fail = 0;
+    uint8_t *pkb, *skb, *ct, *kk, k[MMKEM_K_SZ];
+    const uint8_t **pk;
+    mm_shq_t q[MM_SHQ_THR_MAX];
+    mm_shq_pool_t *pool;
+    bench_buf_t b;
+    bench_res_t sum, *res;
+    uint64_t t, t_enc, t_dec;
+    pid_t pid[MM_SHQ_THR_MAX];
+    const char *op[2] = { "encap", "decap" };
+
+    for (c = 1; c < argc && argv[c][0] == '-'; c++) {
+        if (strcmp(argv[c], "-b") == 0) {
+            busy = 1;
+            continue;
+        }
+        if (c + 1 >= argc || strlen(argv[c]) != 2) {
+            return usage(argv[0]);
+        }
+        if (argv[c][1] == 'p') {
+            dir = argv[++c];
+            continue;
+        }
+        d = atoi(argv[++c]);
+        if (d <= 0) {
+            return usage(argv[0]);
+        }
+        switch (argv[c - 1][1]) {
+            case 'c':   nc = d;             break;
+            case 'r':   reqs = d;           break;
+            case 'n':   n = (uint32_t) d;   break;
+            case 'd':   depth = d;          break;
+            case 't':   nt = d;             break;
+            default:    return usage(argv[0]);
+        }
+    }
+    if (c != argc || nc > MM_SHQ_THR_MAX || depth > 64) {
+        return usage(argv[0]);
+    }
+    if (nt == 0) {
+        nt = nc;
+    }
+
+    //  n key pairs, shared by all clients
+    pkb = (uint8_t *) malloc(n * MM_PK_SZ);
+    skb = (uint8_t *) malloc(n * MM_SK_SZ);
+    pk = (const uint8_t **) malloc(n * sizeof(uint8_t *));
+    ct = (uint8_t *) malloc(MM_CTU_SZ + n * MMKEM_CTI_SZ);
+    kk = (uint8_t *) malloc(n * MMKEM_K_SZ);
+    if (pkb == NULL || skb == NULL || pk == NULL ||
+        ct == NULL || kk == NULL) {
+        return 1;
+    }
+    mm_setup(a_mat, seed_a);
+    for (i = 0; i < n; i++) {
+        put64u_le(seed_k, i);
+        mm_kgen(pkb + i * MM_PK_SZ, skb + i * MM_SK_SZ, a_mat, seed_k);
+        pk[i] = pkb + i * MM_PK_SZ;
+    }
+
+    //  direct in-process calls
+    t = plat_get_ns();
+    for (c = 0; c < reqs; c++) {
+        put64u_le(seed_e, c);
+        mm_encap(ct, kk, a_mat, pk, seed_e, n);
+    }
+    t_enc = (plat_get_ns() - t) / reqs;
+    t = plat_get_ns();
+    for (c = 0; c < reqs; c++) {
+        mm_decap(k, skb, ct, ct + MM_CTU_SZ);
+    }
+    t_dec = (plat_get_ns() - t) / reqs;
+    fail += memcmp(k, kk, MMKEM_K_SZ) != 0;
+
+    //  regions: "depth" buffer sets and a result record each
+    bench_layout(&b, n);
+    pool = mm_shq_pool_start(a_mat, nt, busy, 20);
+    if (pool == NULL) {
+        return 1;
+    }
+    for (c = 0; c < nc; c++) {
+        snprintf(fn[c], sizeof(fn[c]), "%s/xshqbench.%d.%d",
+                    dir, (int) getpid(), c);
+        if (mm_shq_create(&q[c], fn[c], 2 * depth + 2,
+                            depth * b.sz + sizeof(bench_res_t)) != 0) {
+            fprintf(stderr, "%s: cannot create %s\n", argv[0], fn[c]);
+            return 1;
+        }
+        for (d = 0; d < depth; d++) {
+            memcpy(q[c].data + d * b.sz + b.pk, pkb, n * MM_PK_SZ);
+            memcpy(q[c].data + d * b.sz + b.sk, skb, MM_SK_SZ);
+        }
+        mm_shq_pool_add(pool, &q[c]);
+    }
+
+    //  client processes
+    for (c = 0; c < nc; c++) {
+        pid[c] = fork();
+        if (pid[c] == 0) {
+            exit(bench_client(fn[c], reqs, n, depth, busy));
+        }
+    }
+    memset(&sum, 0, sizeof(sum));
+    for (c = 0; c < nc; c++) {
+        if (pid[c] < 0 || waitpid(pid[c], &st, 0) < 0 ||
+            !WIFEXITED(st) || WEXITSTATUS(st) != 0) {
+            fail++;
+            continue;
+        }
+        res = (bench_res_t *) (q[c].data + depth * b.sz);
+        for (d = 0; d < 2; d++) {
+            sum.ops[d] += res->ops[d];
+            sum.rt[d] += res->rt[d];
+            sum.wait[d] += res->wait[d];
+            sum.svc[d] += res->svc[d];
+            sum.max[d] = res->max[d] > sum.max[d] ? res->max[d] : sum.max[d];
+        }
+        sum.t = res->t > sum.t ? res->t : sum.t;
+        sum.fail += res->fail;
+    }
+    mm_shq_pool_stop(pool);
+    for (c = 0; c < nc; c++) {
+        mm_shq_close(&q[c]);
+        unlink(fn[c]);
+    }
+
+    printf("%16s  %16s  N= %4u  ns/op= %9lu  (encap)\n",
+            MM_PAR, "direct", n, (unsigned long) t_enc);
+    printf("%16s  %16s  N= %4u  ns/op= %9lu  (decap)\n",
+            MM_PAR, "direct", n, (unsigned long) t_dec);
+    for (d = 0; d < 2; d++) {
+        if (sum.ops[d] == 0) {
+            continue;
+        }
+        printf("%16s  %16s  N= %4u  rt= %9lu  wait= %7lu  svc= %9lu  "
+                "max= %9lu ns  (%s)\n",
+                MM_PAR, "shq", n,
+                (unsigned long) (sum.rt[d] / sum.ops[d]),
+                (unsigned long) (sum.wait[d] / sum.ops[d]),
+                (unsigned long) (sum.svc[d] / sum.ops[d]),
+                (unsigned long) sum.max[d], op[d]);
+    }
+    printf("%16s  %16s  clients= %d  workers= %d  depth= %d  %s  "
+            "encap/s= %.0f\n",
+            MM_PAR, "shq", nc, nt, depth, busy ? "busy" : "idle",
+            sum.t ? 1E9 * sum.ops[0] / sum.t : 0.0);
+
+    fail += sum.fail;
+    if (fail) {
+        printf("[FAIL] %d failed requests\n", fail);
+    }
+    memset(skb, 0, n * MM_SK_SZ);
+    free(pkb);
+    free(skb);
+    free(pk);
+    free(ct);
+    free(kk);
+
+    return fail != 0;
+}
@@ -0,0 +1,102 @@
+//  mm_srvd_main.c
+//  === Batching mmKEM daemon (mm_srv.h) over a public key directory.
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "mm_kern.h"
+#include "mm_srv.h"
+#include "mmkyber.h"
+
+static mm_srv_t srv;
+
+static void on_signal(int sig)
+{
+    (void) sig;
+    srv.stop = 1;
+}
+
+static int usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [-t threads] [-b batch] [-w wait_us] [-q queue] "
+        "[-m mem_mb] <socket> <dir.pkd>\n"
+        "  dir.pkd    public key directory (xpkdir); its seed domain is\n"
+        "             seed_a of the public parameters\n"
+        "  -t         worker threads (default: online cpus)\n"
+        "  -b         run a batch at this many recipients (default 1024)\n"
+        "  -w         .. or when the oldest request is this old (200 us)\n"
+        "  -q         pending requests before EBUSY (default 4096)\n"
+        "  -m         MiB of requests and responses held (default 256)\n",
+        prog);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    static int32_t a_mat[MM_M * MM_N * MM_D];
+    mm_pkd_t d;
+    struct sigaction sa;
+    int i, lfd;
+    long v;
+
+    memset(&d, 0, sizeof(d));
+    mm_srv_init(&srv, a_mat, &d);
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (i + 1 >= argc || strlen(argv[i]) != 2) {
+            return usage(argv[0]);
+        }
+        v = atol(argv[++i]);
+        if (v <= 0) {
+            return usage(argv[0]);
+        }
+        switch (argv[i - 1][1]) {
+            case 't':   srv.threads = (int) v;          break;
+            case 'b':   srv.batch_max = (uint32_t) v;   break;
+            case 'w':   srv.wait_us = (uint32_t) v;     break;
+            case 'q':   srv.queue_max = (uint32_t) v;   break;
+            case 'm':   srv.mem_max = (size_t) v << 20; break;
+            default:    return usage(argv[0]);
+        }
+    }
+    if (argc - i != 2) {
+        return usage(argv[0]);
+    }
+
+    if (mm_pkd_map(&d, argv[i + 1], MM_PKD_POPULATE | MM_PKD_HUGE) != 0) {
+        fprintf(stderr, "%s: cannot map %s\n", argv[0], argv[i + 1]);
+        return 1;
+    }
+    mm_setup(a_mat, d.dom);
+
+    lfd = mm_srv_listen(argv[i]);
+    if (lfd < 0) {
+        fprintf(stderr, "%s: cannot listen on %s\n", argv[0], argv[i]);
+        return 1;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    printf("%s: %s %lu keys, %d threads, batch %u, wait %u us, %s kernels\n",
+            argv[i], MM_PAR, (unsigned long) d.n, srv.threads,
+            srv.batch_max, srv.wait_us, mm_kern->name);
+    fflush(stdout);
+
+    mm_srv_run(&srv, lfd);
+
+    close(lfd);
+    unlink(argv[i]);
+    mm_pkd_unmap(&d);
+
+    printf("%s: %lu requests, %lu batches, %lu recipients (max %lu)\n",
+            argv[i], (unsigned long) srv.reqs, (unsigned long) srv.batches,
+            (unsigned long) srv.rcpt, (unsigned long) srv.rcpt_max);
+
+    return 0;
+}
@@ -0,0 +1,55 @@
+//  mm_tune_main.c
+//  === Offline calibration: write a tuning profile (mm_tune.h).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mm_tune.h"
+
+static int usage(const char *prog)
+{
+    fprintf(stderr,
+        "Usage: %s [-t ms] [-o profile]\n"
+        "  Times kernel backends, decapsulation paths, scheduler threads\n"
+        "  and task sizes for about \"ms\" milliseconds each (default: 20)\n"
+        "  and writes the fastest choice to \"profile\" (default: stdout).\n",
+        prog);
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *out = NULL;
+    unsigned ms = 20;
+    mm_tune_t t;
+    int i;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (i + 1 >= argc || strlen(argv[i]) != 2) {
+            return usage(argv[0]);
+        }
+        switch (argv[i][1]) {
+            case 't':   ms = (unsigned) atol(argv[++i]);    break;
+            case 'o':   out = argv[++i];                    break;
+            default:    return usage(argv[0]);
+        }
+    }
+    if (i != argc || ms == 0) {
+        return usage(argv[0]);
+    }
+
+    if (mm_tune_run(&t, ms, stdout) != 0) {
+        fprintf(stderr, "%s: calibration failed\n", argv[0]);
+        return 1;
+    }
+    printf("%16s  kern= %s  dec= %s  threads= %d  rblk= %zu\n",
+            t.par, t.kern, t.dec_path == MM_DEC_PATH_SB ? "sb" : "ntt",
+            t.threads, t.rblk);
+    if (out != NULL && mm_tune_save(&t, out) != 0) {
+        fprintf(stderr, "%s: cannot write %s\n", argv[0], out);
+        return 1;
+    }
+
+    return 0;
+}